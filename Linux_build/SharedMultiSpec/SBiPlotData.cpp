@@ -18,7 +18,7 @@
 //
 //	Authors:					Larry L. Biehl
 //
-//	Revision date:			02/27/2020
+//	Revision date:			10/18/2026
 //
 //	Language:				C
 //
@@ -110,6 +110,12 @@ Boolean CheckIfStatisticsChannel (
 
 void FillVectorOffsets (
 				GraphPtr								graphRecordPtr);
+
+Boolean FindBiPlotPoint (
+				double								xValue,
+				double								yValue,
+				SInt32								classStartIndex,
+				HSInt32Ptr*							hashSlotPtrPtr);
 								
 SInt16 GetStatisticsChannelFeature (
 				SInt16								channelNumber,
@@ -522,6 +528,34 @@ void BiPlotDataControl (void)
 					gGraphRecordPtr->drawGraphCode = gGraphRecordPtr->graphCodesAvailable;
 					
 					}
+					
+						// Get memory for the hash table used to check for duplicate
+						// points. The table is at least twice the number of points 
+						// so that it never gets more than half full. If the memory is
+						// not available, duplicates will be checked for by searching
+						// the points already loaded for the class.
+						
+				if (continueFlag && totalNumberPixels > 0 && 
+													totalNumberPixels < SInt32_MAX/2)
+					{
+					UInt32		hashTableSize = 1024;
+					
+					while (hashTableSize < 2 * totalNumberPixels)
+						hashTableSize *= 2;
+						
+					gBiPlotDataSpecsPtr->pointHashTablePtr = (HSInt32Ptr)MNewPointer (
+															(SInt64)hashTableSize * sizeof (SInt32));
+					
+					if (gBiPlotDataSpecsPtr->pointHashTablePtr != NULL)
+						{
+						for (UInt32 index=0; index<hashTableSize; index++)
+							gBiPlotDataSpecsPtr->pointHashTablePtr[index] = -1;
+							
+						gBiPlotDataSpecsPtr->pointHashTableMask = hashTableSize - 1;
+							
+						}	// end "if (gBiPlotDataSpecsPtr->pointHashTablePtr != NULL)"
+					
+					}	// end "if (continueFlag && totalNumberPixels > 0 && ..."
 				
 				}	// end "if (continueFlag)" 
 				
@@ -624,6 +658,9 @@ void BiPlotDataControl (void)
 					}	// end "if (...->plotDataCode & (kTrainingType...)" 
 					
 				}	// end "if (continueFlag && (gBiPlotDataSpecsPtr->..." 
+				
+			gBiPlotDataSpecsPtr->pointHashTablePtr = (HSInt32Ptr)CheckAndDisposePtr (
+												(Ptr)gBiPlotDataSpecsPtr->pointHashTablePtr);
 
 			HideStatusDialogItemSet (kStatusLine);
 				
@@ -1971,7 +2008,8 @@ SInt16 BiPlotFieldData (
 											
 	HDoublePtr							bufferDoublePtr;
 	
-	HSInt32Ptr							vectorLengthsPtr;
+	HSInt32Ptr							hashSlotPtr,
+											vectorLengthsPtr;
 											
 	UInt16								*localChannelsPtr;
 											
@@ -1980,7 +2018,8 @@ SInt16 BiPlotFieldData (
 	
 	RgnHandle							rgnHandle;
 	
-	SInt32								column,
+	SInt32								classStartIndex,
+											column,
 											error,
 											index,
 											index2,
@@ -2086,6 +2125,12 @@ SInt16 BiPlotFieldData (
 												gGraphRecordPtr->vectorLengthsHandle);
 		numberPointsInClass = vectorLengthsPtr[classNumberCode];
 		
+				// The points for the class are stored contiguously in the vectors
+				// starting at classStartIndex. Entries in the point hash table with 
+				// an index less than this are for previous classes.
+				
+		classStartIndex = index - numberPointsInClass;
+		
 				// Get point to base of data to start storing new samples at.		
 				// Adjust down by one to represent the last sample in the set.		
 																									
@@ -2209,45 +2254,75 @@ SInt16 BiPlotFieldData (
 							}	// end "else !...->featureTransformationFlag" 
 							
 								// Check if duplicated value.										
-								
-						for (index2=0; index2<numberPointsInClass; index2++)
-							{
-							if (*xBasePtr == xValue && *yBasePtr == yValue)
-								break;
-
-							xBasePtr--;
-							yBasePtr--;
-							
-							}	// end "for (index2=0; index2<..." 
-							
-						if (index2 == numberPointsInClass)
+						
+						if (gBiPlotDataSpecsPtr->pointHashTablePtr != NULL)
 							{
-							SetV (&gGraphRecordPtr->xVector, 
-									index, 
-									xValue, 
-									&error);
+									// Use the hash table to find the point.
+									
+							if (!FindBiPlotPoint (
+											xValue, yValue, classStartIndex, &hashSlotPtr))
+								{
+								SetV (&gGraphRecordPtr->xVector, 
+										index, 
+										xValue, 
+										&error);
+									
+								SetV (&gGraphRecordPtr->yVector, 
+										index, 
+										yValue, 
+										&error);
 								
-							SetV (&gGraphRecordPtr->yVector, 
-									index, 
-									yValue, 
-									&error);
-							
-							numberPointsInClass++;	
-							index++;
+								*hashSlotPtr = index;
+								
+								numberPointsInClass++;	
+								index++;
+								
+								}	// end "if (!FindBiPlotPoint (..."
 							
-							xBasePtr += numberPointsInClass;
-							yBasePtr += numberPointsInClass;
-									
-							}	// end "if (index2 == numberPointsInClass)" 
+							}	// end "if (gBiPlotDataSpecsPtr->pointHashTablePtr != NULL)"
 							
-						else	// index2 < numberPointsInClass 
+						else	// gBiPlotDataSpecsPtr->pointHashTablePtr == NULL
 							{
-									// this is a duplicate point, skip it 						
+							for (index2=0; index2<numberPointsInClass; index2++)
+								{
+								if (*xBasePtr == xValue && *yBasePtr == yValue)
+									break;
+
+								xBasePtr--;
+								yBasePtr--;
+								
+								}	// end "for (index2=0; index2<..." 
+								
+							if (index2 == numberPointsInClass)
+								{
+								SetV (&gGraphRecordPtr->xVector, 
+										index, 
+										xValue, 
+										&error);
 									
-							xBasePtr += index2;
-							yBasePtr += index2;
+								SetV (&gGraphRecordPtr->yVector, 
+										index, 
+										yValue, 
+										&error);
+								
+								numberPointsInClass++;	
+								index++;
+								
+								xBasePtr += numberPointsInClass;
+								yBasePtr += numberPointsInClass;
+										
+								}	// end "if (index2 == numberPointsInClass)" 
+								
+							else	// index2 < numberPointsInClass 
+								{
+										// this is a duplicate point, skip it 						
+										
+								xBasePtr += index2;
+								yBasePtr += index2;
+								
+								}	// end "else index2 < numberPointsInClass" 
 							
-							}	// end "else index2 < numberPointsInClass" 
+							}	// end "else ...->pointHashTablePtr == NULL"
 						
 						}	// end "if (!polygonField || PtInRgn (point, rgnHandle))" 
 						
@@ -2568,6 +2643,103 @@ void FillVectorOffsets (
 
 
 
+//------------------------------------------------------------------------------------
+//                   Copyright 1988-2020 Purdue Research Foundation
+//
+//	Function name:		Boolean FindBiPlotPoint
+//
+//	Software purpose:	The purpose of this routine is to determine whether the input 
+//							x and y values have already been loaded into the graph vectors 
+//							for the current class. The point hash table is searched using
+//							linear probing. Table entries with a vector index less than
+//							the start index for the class belong to previous classes and 
+//							are treated as empty slots.
+//
+//	Parameters in:		x and y values for the point
+//							Index in graph vectors of the first point for the class
+//
+//	Parameters out:	Pointer to the hash table slot to be used for the point if
+//							it is not already in the table.
+//
+// Value Returned:	True if the point has already been loaded for the class
+//							False if not.
+// 
+// Called By:			BiPlotFieldData
+//
+//	Coded By:			agent						Date: 10/18/2026
+//	Revised By:			agent						Date: 10/18/2026
+
+Boolean FindBiPlotPoint (
+				double								xValue,
+				double								yValue,
+				SInt32								classStartIndex,
+				HSInt32Ptr*							hashSlotPtrPtr)
+
+{
+	UInt32								hashWords[4];
+	
+	double								*xVectorPtr,
+											*yVectorPtr;
+	
+	HSInt32Ptr							hashTablePtr;
+	
+	UInt32								hashIndex,
+											hashValue,
+											index,
+											mask;
+	
+	SInt32								vectorIndex;
+	
+	
+	hashTablePtr = gBiPlotDataSpecsPtr->pointHashTablePtr;
+	mask = gBiPlotDataSpecsPtr->pointHashTableMask;
+	xVectorPtr = gGraphRecordPtr->xVector.basePtr;
+	yVectorPtr = gGraphRecordPtr->yVector.basePtr;
+	
+			// Make certain that -0 and +0 hash to the same value since they
+			// compare as being equal.
+			
+	xValue += 0.;
+	yValue += 0.;
+	
+	memcpy (&hashWords[0], &xValue, sizeof (double));
+	memcpy (&hashWords[2], &yValue, sizeof (double));
+	
+	hashValue = 2166136261U;
+	for (index=0; index<4; index++)
+		{
+		hashValue ^= hashWords[index];
+		hashValue *= 16777619U;
+		
+		}	// end "for (index=0; index<4; index++)"
+	
+	hashValue ^= hashValue >> 15;
+	hashIndex = hashValue & mask;
+	
+	while (TRUE)
+		{
+		vectorIndex = hashTablePtr[hashIndex];
+		
+		if (vectorIndex < classStartIndex)
+			{
+					// Empty slot; the point is not in the table for this class.
+					
+			*hashSlotPtrPtr = &hashTablePtr[hashIndex];
+																							return (FALSE);
+			
+			}	// end "if (vectorIndex < classStartIndex)"
+		
+		if (xVectorPtr[vectorIndex] == xValue && yVectorPtr[vectorIndex] == yValue)
+																							return (TRUE);
+			
+		hashIndex = (hashIndex + 1) & mask;
+		
+		}	// end "while (TRUE)"
+	
+}	// end "FindBiPlotPoint"
+
+
+
 //------------------------------------------------------------------------------------
 //                   Copyright 1988-2020 Purdue Research Foundation
 //
@@ -3208,6 +3380,8 @@ Boolean LoadBiPlotDataSpecs (
 			gBiPlotDataSpecsPtr->symbolsHandle = NULL;
 			gBiPlotDataSpecsPtr->windowInfoHandle = windowInfoHandle;
 			gBiPlotDataSpecsPtr->classPtr = NULL;
+			gBiPlotDataSpecsPtr->pointHashTablePtr = NULL;
+			gBiPlotDataSpecsPtr->pointHashTableMask = 0;
 			gBiPlotDataSpecsPtr->symbolsPtr = NULL;
 			
 			gBiPlotDataSpecsPtr->lineStart = 1;
@@ -18,7 +18,7 @@
 //
 //	Authors:					Larry L. Biehl
 //
-//	Revision date:			05/12/2020
+//	Revision date:			10/18/2026
 //
 //	Language:				C
 //
@@ -110,6 +110,16 @@
 //
 //					ListClassificationSummary (in )
 //
+//					ClassifyBatchTargetImages
+//						GetImageInformationPointers (in SUtilities.cpp)
+//						GetClassifyDataBuffers
+//						CreateResultsDiskFiles (in SUtilities.cpp)
+//						ClassifyArea
+//							"see above"
+//						ListClassificationSummary (in )
+//						CreateTrailerFiles
+//						CloseResultsFiles (in SUtilities.cpp)
+//
 //			FisherClsfierControl
 //				SetupClsfierMemory
 //				ReduceMeanVector (in SUtilities.cpp)
@@ -315,6 +325,11 @@ SInt16 ClassifyArea (
 				ClassifierVarPtr					clsfyVariablePtr, 
 				HSInt64Ptr							countVectorPtr);
 
+Boolean ClassifyBatchTargetImages (
+				FileIOInstructionsPtr*			fileIOInstructionsPtrPtr,
+				LCToWindowUnitsVariables* 		lcToWindowUnitsVariablesPtr,
+				ClassifierVarPtr					clsfyVariablePtr);
+
 SInt16 ClassifyPerPointArea (
 				SInt16								classPointer,
 				AreaDescriptionPtr				areaDescriptionPtr, 
@@ -323,6 +338,12 @@ SInt16 ClassifyPerPointArea (
 				ClassifierVarPtr					clsfyVariablePtr, 
 				HSInt64Ptr							countVectorPtr);
 
+SInt16 ClassifyPreviewArea (
+				AreaDescriptionPtr				areaDescriptionPtr,
+				FileIOInstructionsPtr			fileIOInstructionsPtr,
+				LCToWindowUnitsVariables* 		lcToWindowUnitsVariablesPtr,
+				ClassifierVarPtr					clsfyVariablePtr);
+
 SInt16 ClassifyTrainTestFields (
 				AreaDescriptionPtr				areaDescriptionPtr,
 				FileIOInstructionsPtr			fileIOInstructionsPtr,
@@ -1535,7 +1556,7 @@ SInt16 ClassifyArea (
 // Called By:			MaxLikeClsfierControl
 //
 //	Coded By:			Larry L. Biehl			Date: 12/15/1988
-//	Revised By:			Larry L. Biehl			Date: 04/15/2020
+//	Revised By:			agent						Date: 10/18/2026
 
 void ClassifyAreasControl (
 				FileInfoPtr							fileInfoPtr, 
@@ -1613,6 +1634,7 @@ void ClassifyAreasControl (
 	clsfyVariablePtr->backgroundIndexOffset = 0;
 	
 	clsfyVariablePtr->useLeaveOneOutMethodFlag = FALSE;
+	clsfyVariablePtr->previewFlag = FALSE;
 			
 			// Initialize the gAreaDescription structure in case it is used for
 			// classifying the training and/or test fields. 
@@ -1670,6 +1692,15 @@ void ClassifyAreasControl (
 																fileInfoPtr,
 																echoClassifierVarPtr,
 																&fileIOInstructionsPtr);
+	
+			// The image area is classified in one pass through the file.
+			
+	if (continueFlag)
+		{
+		SetUpSequentialReadBuffer (fileIOInstructionsPtr);
+		SetUpChannelLineBlocks (fileIOInstructionsPtr);
+		
+		}	// end "if (continueFlag)"
 		
 			// Get vector for storing the index into countVectorPtr at which		
 			// the counts for a class start.													
@@ -1982,6 +2013,20 @@ void ClassifyAreasControl (
 													1,
 													1,
 													0);
+			
+					// Classify the visible part of the area at the display sampling
+					// interval first so that a quick look is available in the
+					// overlay before the full resolution pass starts.
+			
+			if (continueFlag)
+				{
+				returnCode = ClassifyPreviewArea (&gAreaDescription,
+																fileIOInstructionsPtr,
+																&lcToWindowUnitsVariables,
+																clsfyVariablePtr);
+				continueFlag = (returnCode == noErr);
+				
+				}	// end "if (continueFlag)"
 													
 					// Clear the memory for the counts.										
 			 
@@ -2304,6 +2349,17 @@ void ClassifyAreasControl (
 													gClassifySpecsPtr->classPtr,  
 													(SInt16)gClassifySpecsPtr->numberClasses);
 			
+					// Now run the same classifier over the image area of the other
+					// compatible image windows if requested.
+			
+			if (continueFlag &&
+					returnCode <= 1 &&
+						gClassifySpecsPtr->batchTargetsFlag &&
+							gClassifySpecsPtr->mode != kEchoMode)
+				continueFlag = ClassifyBatchTargetImages (&fileIOInstructionsPtr,
+																		&lcToWindowUnitsVariables,
+																		clsfyVariablePtr);
+			
 			}	// end "if (gClassifySpecsPtr->imageArea && ...)"
 															
 		}	// end "if (continueFlag)" 
@@ -2325,6 +2381,363 @@ void ClassifyAreasControl (
 
 
 
+//------------------------------------------------------------------------------------
+//                   Copyright 1988-2020 Purdue Research Foundation
+//
+//	Function name:		Boolean ClassifyBatchTargetImages
+//
+//	Software purpose:	The purpose of this routine is to classify the image area
+//							for each of the other open image windows that are
+//							compatible with the target image, using the classifier
+//							that has already been set up for the target image. Each
+//							image gets its own set of results files which are named
+//							after the image and a class distribution summary.
+//							Image overlays are only created for the target image.
+//
+//	Parameters in:		Address of pointer to the file IO instructions for the
+//								target image.
+//							Pointer to line-column to window units variables.
+//							Pointer to classifier variable structure.
+//
+//	Parameters out:	Pointer to the file IO instructions last used. The results
+//								files for the batch images are closed; those for the
+//								target image are left open for ClassifyControl.
+//
+// Value Returned:	TRUE if the batch was completed.
+//							FALSE if it was cancelled or an error occurred.
+//
+// Called By:			ClassifyAreasControl
+//
+//	Coded By:			agent						Date: 10/18/2026
+//	Revised By:			agent						Date: 10/18/2026
+
+Boolean ClassifyBatchTargetImages (
+				FileIOInstructionsPtr*			fileIOInstructionsPtrPtr,
+				LCToWindowUnitsVariables* 		lcToWindowUnitsVariablesPtr,
+				ClassifierVarPtr					clsfyVariablePtr)
+
+{
+	DiskFileSummary					savedResultsFileSummary;
+	
+	CMFileStream*						resultsFileStreamPtr;
+	FileInfoPtr							fileInfoPtr,
+											savedFileInfoPtr;
+	HUInt16Ptr							ioBuffer2Ptr;
+	LayerInfoPtr						layerInfoPtr,
+											savedLayerInfoPtr;
+	WindowInfoPtr						compareWindowInfoPtr,
+											savedWindowInfoPtr,
+											windowInfoPtr;
+	WindowPtr							windowPtr;
+
+	Handle								compareWindowInfoHandle,
+											targetWindowInfoHandle;
+
+	SInt32								columnEnd,
+											lineEnd;
+
+	UInt32								index;
+
+	SInt16								handleStatus,
+											returnCode,
+											savedOutputCode,
+											savedOutputForce1Code,
+											window,
+											windowIndex;
+
+	Boolean								continueFlag,
+											includeFlag;
+
+
+	savedWindowInfoPtr = gImageWindowInfoPtr;
+	savedLayerInfoPtr = gImageLayerInfoPtr;
+	savedFileInfoPtr = gImageFileInfoPtr;
+
+	if (savedWindowInfoPtr == NULL || savedFileInfoPtr == NULL)
+																						return (TRUE);
+
+	targetWindowInfoHandle = GetWindowInfoHandle (savedWindowInfoPtr);
+
+			// The image overlay is only drawn for the target image.
+
+	savedOutputCode = gOutputCode;
+	savedOutputForce1Code = gOutputForce1Code;
+	if (gOutputCode & kCreateImageOverlayCode)
+		{
+		gOutputCode -= kCreateImageOverlayCode;
+		gOutputForce1Code = (gOutputCode | 0x0001);
+
+		}	// end "if (gOutputCode & kCreateImageOverlayCode)"
+
+			// Set the results files for the target image aside so that they stay
+			// open for the closing summary that ClassifyControl writes to them.
+
+	savedResultsFileSummary = gResultsFileSummary;
+	gResultsFileSummary.numberFiles = 0;
+	gResultsFileSummary.diskFileListPtr = NULL;
+	gResultsFileSummary.diskFileListH = NULL;
+
+	continueFlag = TRUE;
+	returnCode = noErr;
+	windowIndex = kImageWindowStart;
+	for (window=0; window<gNumberOfIWindows; window++)
+		{
+		windowPtr = gWindowList[windowIndex];
+		windowIndex++;
+
+		compareWindowInfoHandle = GetWindowInfoHandle (windowPtr);
+		compareWindowInfoPtr = (WindowInfoPtr)GetHandlePointer (compareWindowInfoHandle);
+
+				// Use the same rules as for the target image list in the classify
+				// dialog box.
+
+		includeFlag = (compareWindowInfoPtr != NULL &&
+								compareWindowInfoHandle != targetWindowInfoHandle &&
+									compareWindowInfoHandle != gProjectInfoPtr->windowInfoHandle);
+
+		if (includeFlag &&
+				(compareWindowInfoPtr->numberBytes != savedWindowInfoPtr->numberBytes ||
+					compareWindowInfoPtr->totalNumberChannels !=
+														savedWindowInfoPtr->totalNumberChannels ||
+						compareWindowInfoPtr->projectBaseImageFlag))
+			includeFlag = FALSE;
+
+				// Make sure that the requested area overlaps this image.
+
+		if (includeFlag)
+			{
+			lineEnd = MIN (gClassifySpecsPtr->imageLineEnd,
+									(SInt32)compareWindowInfoPtr->maxNumberLines);
+			columnEnd = MIN (gClassifySpecsPtr->imageColumnEnd,
+									(SInt32)compareWindowInfoPtr->maxNumberColumns);
+
+			if (gClassifySpecsPtr->imageLineStart > lineEnd ||
+										gClassifySpecsPtr->imageColumnStart > columnEnd)
+				includeFlag = FALSE;
+
+			}	// end "if (includeFlag)"
+
+		if (includeFlag)
+			{
+					// Close the results files for the previous batch image and
+					// release the io buffers for the previous image.
+
+			CloseResultsFiles ();
+
+			DisposeIOBufferPointers (*fileIOInstructionsPtrPtr,
+												&gOutputBufferPtr,
+												&gInputBufferPtr);
+			*fileIOInstructionsPtrPtr = NULL;
+
+			GetImageInformationPointers (&handleStatus,
+													compareWindowInfoHandle,
+													&windowInfoPtr,
+													&layerInfoPtr,
+													&fileInfoPtr);
+
+			gImageWindowInfoPtr = windowInfoPtr;
+			gImageLayerInfoPtr = layerInfoPtr;
+			gImageFileInfoPtr = fileInfoPtr;
+
+			continueFlag = GetClassifyDataBuffers (&gFileIOInstructions[0],
+																	windowInfoPtr,
+																	layerInfoPtr,
+																	fileInfoPtr,
+																	NULL,
+																	fileIOInstructionsPtrPtr);
+
+			if (continueFlag)
+				{
+				SetUpSequentialReadBuffer (*fileIOInstructionsPtrPtr);
+				SetUpChannelLineBlocks (*fileIOInstructionsPtrPtr);
+				
+				}	// end "if (continueFlag)"
+
+					// Create the results files for this image without asking for
+					// the file names.
+
+			if (continueFlag && (gOutputCode & kResultsFilesCode))
+				{
+				InitializeAreaDescription (&gAreaDescription,
+													gClassifySpecsPtr->imageLineStart,
+													lineEnd,
+													gClassifySpecsPtr->imageColumnStart,
+													columnEnd,
+													gClassifySpecsPtr->imageLineInterval,
+													gClassifySpecsPtr->imageColumnInterval,
+													(SInt32)fileInfoPtr->startLine,
+													(SInt32)fileInfoPtr->startColumn,
+													gClassifySpecsPtr->diskFileFormat);
+
+				continueFlag = CreateResultsDiskFiles (
+											gClassifySpecsPtr->outputStorageType,
+											(SInt16)gProjectInfoPtr->numberStatisticsClasses,
+											(SInt16)gClassifySpecsPtr->numberProbabilityClasses,
+											FALSE);
+
+				}	// end "if (continueFlag && (gOutputCode & ..."
+
+			resultsFileStreamPtr = GetResultsFileStreamPtr (0);
+
+			InitializeAreaDescription (&gAreaDescription,
+													gClassifySpecsPtr->imageLineStart,
+													lineEnd,
+													gClassifySpecsPtr->imageColumnStart,
+													columnEnd,
+													gClassifySpecsPtr->imageLineInterval,
+													gClassifySpecsPtr->imageColumnInterval,
+													1,
+													1,
+													0);
+
+					// Clear the memory for the counts.
+
+			for (index=0; index<=gProjectInfoPtr->numberStatisticsClasses; index++)
+				clsfyVariablePtr->countVectorPtr[index] = 0;
+
+					// List the image being classified and the area.
+
+			char* fileNamePtr = (char*)GetFileNameCPointerFromFileInfo (fileInfoPtr);
+			sprintf ((char*)gTextString,
+						"%s    Batch target image file = '%s'%s",
+						gEndOfLine,
+						fileNamePtr,
+						gEndOfLine);
+
+			continueFlag = OutputString (resultsFileStreamPtr,
+													(char*)gTextString,
+													0,
+													gOutputForce1Code,
+													continueFlag,
+													kUTF8CharString);
+
+			if (resultsFileStreamPtr != NULL)
+				{
+				FileStringPtr filePathPtr = (FileStringPtr)
+									GetFilePathPPointerFromFileStream (resultsFileStreamPtr);
+				continueFlag = ListSpecifiedStringNumber (kClassifyStrID,
+																		IDS_Classify61,
+																		resultsFileStreamPtr,
+																		gOutputForce1Code,
+																		(char*)&filePathPtr[2],
+																		continueFlag,
+																		kUTF8CharString);
+
+				}	// end "if (resultsFileStreamPtr != NULL)"
+
+			sprintf ((char*)gTextString, "    ");
+			continueFlag = OutputString (resultsFileStreamPtr,
+													(char*)gTextString,
+													0,
+													gOutputForce1Code,
+													continueFlag);
+
+			continueFlag = ListLineColumnIntervalString (resultsFileStreamPtr,
+																		gOutputForce1Code,
+																		gAreaDescription.lineStart,
+																		gAreaDescription.lineEnd,
+																		gAreaDescription.lineInterval,
+																		gAreaDescription.columnStart,
+																		gAreaDescription.columnEnd,
+																		gAreaDescription.columnInterval,
+																		continueFlag);
+
+			if (continueFlag && (gOutputFormatCode == kGAIAType))
+				{
+				ioBuffer2Ptr =
+							(HUInt16Ptr)(*fileIOInstructionsPtrPtr)->outputBufferPtrs[0];
+				ioBuffer2Ptr = &ioBuffer2Ptr[gClassifySpecsPtr->outputBufferOffset];
+
+				InitializeGAIALineBytes (ioBuffer2Ptr,
+													(SInt32)gAreaDescription.numSamplesPerChan,
+													1);
+
+				if ((*fileIOInstructionsPtrPtr)->bufferOffset > 0)
+					{
+					ioBuffer2Ptr =
+							(HUInt16Ptr)(*fileIOInstructionsPtrPtr)->outputBufferPtrs[1];
+					ioBuffer2Ptr = &ioBuffer2Ptr[gClassifySpecsPtr->outputBufferOffset];
+
+					InitializeGAIALineBytes (ioBuffer2Ptr,
+														(SInt32)gAreaDescription.numSamplesPerChan,
+														1);
+
+					}	// end "if ((*fileIOInstructionsPtrPtr)->bufferOffset > 0)"
+
+				}	// end "if (continueFlag && (gOutputFormatCode == kGAIAType))"
+
+			if (continueFlag)
+				{
+				if (gClassifySpecsPtr->mode != kSupportVectorMachineMode)
+					clsfyVariablePtr->totalSameDistanceSamples = 0;
+
+				gNextTime = TickCount ();
+				gNextStatusTime = gNextTime;
+
+				returnCode = ClassifyArea (-1,
+													&gAreaDescription,
+													*fileIOInstructionsPtrPtr,
+													lcToWindowUnitsVariablesPtr,
+													clsfyVariablePtr,
+													&clsfyVariablePtr->countVectorPtr[0]);
+				continueFlag = (returnCode <= 1);
+
+				}	// end "if (continueFlag)"
+
+			HideStatusDialogItemSet (kStatusTitle2);
+			HideStatusDialogItemSet (kStatusLine);
+
+			if (continueFlag)
+				continueFlag = ListClassificationSummary (
+																clsfyVariablePtr,
+																resultsFileStreamPtr,
+																&gOutputForce1Code,
+																gClassifySpecsPtr->classPtr,
+																gClassifySpecsPtr->numberClasses);
+
+			if (continueFlag)
+				continueFlag = ListNumberOfSameDistanceSamples (
+														resultsFileStreamPtr,
+														clsfyVariablePtr->totalSameDistanceSamples);
+
+			if (continueFlag)
+				WriteProbabilityGrouping (gClassifySpecsPtr->mode);
+
+			if (continueFlag)
+				continueFlag = CreateTrailerFiles (
+													clsfyVariablePtr,
+													gProjectInfoPtr->numberStatisticsClasses,
+													gClassifySpecsPtr->classPtr,
+													(SInt16)gClassifySpecsPtr->numberClasses);
+
+			UnlockImageInformationHandles (handleStatus, compareWindowInfoHandle);
+
+			if (!continueFlag)
+				break;
+
+			}	// end "if (includeFlag)"
+
+		}	// end "for (window=0; window<gNumberOfIWindows; window++)"
+
+			// Close the results files for the last batch image and make those for
+			// the target image current again.
+
+	CloseResultsFiles ();
+	gResultsFileSummary = savedResultsFileSummary;
+
+	gImageWindowInfoPtr = savedWindowInfoPtr;
+	gImageLayerInfoPtr = savedLayerInfoPtr;
+	gImageFileInfoPtr = savedFileInfoPtr;
+
+	gOutputCode = savedOutputCode;
+	gOutputForce1Code = savedOutputForce1Code;
+
+	return (continueFlag);
+
+}	// end "ClassifyBatchTargetImages"
+
+
+
 //------------------------------------------------------------------------------------
 //                   Copyright 1988-2020 Purdue Research Foundation
 //
@@ -2343,7 +2756,7 @@ void ClassifyAreasControl (
 // Called By:			OnProcClassify in xMainFrame.cpp
 //
 //	Coded By:			Larry L. Biehl			Date: 12/06/1988
-//	Revised By:			Larry L. Biehl			Date: 12/06/2019
+//	Revised By:			agent						Date: 10/18/2026
 
 void ClassifyControl (void)
 
@@ -2735,6 +3148,11 @@ void ClassifyControl (void)
 								break;
 								
 							}	// end "switch (classifyMode)" 
+						
+								// The results files may have been closed if other
+								// image windows were also classified.
+						
+						resultsFileStreamPtr = GetResultsFileStreamPtr (0);
 												
 								// Reset the cancel operation globals.	
 						
@@ -2890,10 +3308,11 @@ void ClassifyControl (void)
 // Value Returned:		
 // 
 // Called By:			ClassifyAreas
+//							ClassifyPreviewArea
 //
 //	Coded By:			Larry L. Biehl			Date: 12/15/1988
 //	Revised By:			Jeon						Date: 03/23/2006
-//	Revised By:			Larry L. Biehl			Date: 05/12/2020
+//	Revised By:			agent						Date: 10/18/2026
 
 SInt16 ClassifyPerPointArea (
 				SInt16								classPointer, 
@@ -2937,9 +3356,14 @@ SInt16 ClassifyPerPointArea (
    										lineCount,
 											line,
 											lineEnd,
-											lineInterval;
-	
-	UInt32								linesLeft,
+											lineInterval,
+											previewLine,
+											previewLineEnd;
+	
+	UInt32								columnInterval,
+											linesLeft,
+											numberPreviewSamples,
+											sample,
 											skipCount,
 											startTick;
 	
@@ -3222,7 +3646,8 @@ SInt16 ClassifyPerPointArea (
 			if (returnCode == 3)
 				break;
 										
-			if (fileIOInstructionsPtr->maskBufferPtr == NULL)
+			if (fileIOInstructionsPtr->maskBufferPtr == NULL &&
+															!clsfyVariablePtr->previewFlag)
 				returnCode = WriteClassificationResults (outputBufferPtr,
 																		areaDescriptionPtr, 
 																		resultsFileStreamPtr, 
@@ -3232,7 +3657,42 @@ SInt16 ClassifyPerPointArea (
 			if (returnCode == 1)
 				break;
 		  			
-			if (gOutputCode & kCreateImageOverlayCode)
+			if (clsfyVariablePtr->previewFlag)
+				{
+						// Spread each preview sample over the block of lines and
+						// columns that it represents so that the quick look has no
+						// gaps. The expansion is done in place from the end of the
+						// line; the buffer holds a full resolution line.
+				
+				columnInterval = (UInt32)areaDescriptionPtr->columnInterval;
+				numberPreviewSamples = MIN (
+							(UInt32)areaDescriptionPtr->numSamplesPerChan * columnInterval,
+							(UInt32)(areaDescriptionPtr->columnEnd - 
+															areaDescriptionPtr->columnStart + 1));
+				
+				for (sample=numberPreviewSamples; sample>0; sample--)
+					outputBufferPtr[sample-1] = outputBufferPtr[(sample-1)/columnInterval];
+				
+				previewLineEnd = MIN (line + lineInterval - 1, lineEnd);
+				for (previewLine=line; previewLine<=previewLineEnd; previewLine++)
+					CopyToOffscreenBuffer (fileIOInstructionsPtr,
+													imageOverlayInfoPtr,
+													gClassifySpecsPtr->imageOverlayIndex,
+													gProjectInfoPtr->overlayImageWindowInfoHandle,
+													previewLine,
+													(UInt32)areaDescriptionPtr->columnStart,
+													1,
+													numberPreviewSamples,
+													areaDescriptionPtr->lineStart,
+													areaDescriptionPtr->rgnHandle,
+													outputBufferPtr,
+													offScreenBufferPtr,
+													1,
+													FALSE);
+				
+				}	// end "if (clsfyVariablePtr->previewFlag)"
+			
+			else if (gOutputCode & kCreateImageOverlayCode)
 				{
 				CopyToOffscreenBuffer (fileIOInstructionsPtr,
 												imageOverlayInfoPtr,
@@ -3363,6 +3823,161 @@ SInt16 ClassifyPerPointArea (
 
 
 
+//------------------------------------------------------------------------------------
+//                   Copyright 1988-2020 Purdue Research Foundation
+//
+//	Function name:		SInt16 ClassifyPreviewArea
+//
+//	Software purpose:	The purpose of this routine is to classify the part of the
+//							image area that is visible in the overlay image window at
+//							the sampling interval currently used for the display. The
+//							results are only drawn into the image overlay; nothing is
+//							written to the results files. The full resolution pass
+//							which follows replaces the quick look line by line.
+//
+//	Parameters in:		Pointer to the area description for the full image area
+//							Pointer to the file IO instructions structure
+//							Pointer to line-column to window units variables
+//							Pointer to temporary classification variable structure
+//
+//	Parameters out:	None
+//
+// Value Returned:	Same codes as ClassifyPerPointArea
+// 
+// Called By:			ClassifyAreasControl
+//
+//	Coded By:			agent						Date: 10/18/2026
+//	Revised By:			agent						Date: 10/18/2026
+
+SInt16 ClassifyPreviewArea (
+				AreaDescriptionPtr				areaDescriptionPtr,
+				FileIOInstructionsPtr			fileIOInstructionsPtr,
+				LCToWindowUnitsVariables* 		lcToWindowUnitsVariablesPtr,
+				ClassifierVarPtr					clsfyVariablePtr)
+	
+{
+	AreaDescription					previewAreaDescription;
+	Rect									windowRect;
+	
+	DisplaySpecsPtr					displaySpecsPtr;
+	WindowInfoPtr						imageWindowInfoPtr;
+	WindowPtr							windowPtr;
+	
+	SInt32								columnEnd,
+											columnInterval,
+											columnStart,
+											lineEnd,
+											lineInterval,
+											lineStart;
+	
+	SInt16								returnCode;
+	
+	
+			// Only rectangular image areas classified at full resolution into an
+			// overlay are previewed. The echo classifier works on cells of lines
+			// and is not included.
+	
+	if (!(gOutputCode & kCreateImageOverlayCode) ||
+				gClassifySpecsPtr->mode == kEchoMode ||
+						gTestFlag ||
+							areaDescriptionPtr->pointType != kRectangleType ||
+								areaDescriptionPtr->lineInterval != 1 ||
+									areaDescriptionPtr->columnInterval != 1 ||
+										fileIOInstructionsPtr->maskBufferPtr != NULL)
+																						return (noErr);
+	
+	windowPtr = GetWindowPtr (gProjectInfoPtr->overlayImageWindowInfoHandle);
+	imageWindowInfoPtr = (WindowInfoPtr)GetHandlePointer (
+													gProjectInfoPtr->overlayImageWindowInfoHandle);
+	if (windowPtr == NULL || imageWindowInfoPtr == NULL)
+																						return (noErr);
+	
+	displaySpecsPtr = (DisplaySpecsPtr)GetHandlePointer (
+															GetDisplaySpecsHandle (imageWindowInfoPtr));
+	if (displaySpecsPtr == NULL ||
+				displaySpecsPtr->magnification <= 0 ||
+						displaySpecsPtr->displayType == kSideSideChannelDisplayType)
+																						return (noErr);
+	
+			// Get the line and column range that is visible in the window.
+	
+	GetWindowClipRectangle (windowPtr, kImageArea, &windowRect);
+	
+	lineStart = (SInt32)(displaySpecsPtr->displayedLineStart +
+								displaySpecsPtr->origin[kVertical] *
+											displaySpecsPtr->displayedLineInterval);
+	lineEnd = lineStart + (SInt32)((windowRect.bottom - windowRect.top) *
+							displaySpecsPtr->displayedLineInterval /
+												displaySpecsPtr->magnification);
+	
+	columnStart = (SInt32)(displaySpecsPtr->displayedColumnStart +
+								displaySpecsPtr->origin[kHorizontal] *
+											displaySpecsPtr->displayedColumnInterval);
+	columnEnd = columnStart + (SInt32)((windowRect.right - windowRect.left) *
+							displaySpecsPtr->displayedColumnInterval /
+												displaySpecsPtr->magnification);
+	
+	lineStart = MAX (lineStart, areaDescriptionPtr->lineStart);
+	lineEnd = MIN (lineEnd, areaDescriptionPtr->lineEnd);
+	columnStart = MAX (columnStart, areaDescriptionPtr->columnStart);
+	columnEnd = MIN (columnEnd, areaDescriptionPtr->columnEnd);
+	
+	if (lineStart > lineEnd || columnStart > columnEnd)
+																						return (noErr);
+	
+			// Sample the image the same way that the display does; one image pixel
+			// for each screen pixel.
+	
+	lineInterval = (SInt32)ceil (
+				displaySpecsPtr->displayedLineInterval / displaySpecsPtr->magnification);
+	lineInterval = MAX (lineInterval, 1);
+	
+	columnInterval = (SInt32)ceil (
+				displaySpecsPtr->displayedColumnInterval / displaySpecsPtr->magnification);
+	columnInterval = MAX (columnInterval, 1);
+	
+			// Nothing would be gained if the preview is the full area.
+	
+	if (lineInterval == 1 && columnInterval == 1 &&
+				lineStart == areaDescriptionPtr->lineStart &&
+					lineEnd == areaDescriptionPtr->lineEnd &&
+						columnStart == areaDescriptionPtr->columnStart &&
+							columnEnd == areaDescriptionPtr->columnEnd)
+																						return (noErr);
+	
+	InitializeAreaDescription (&previewAreaDescription, 
+											lineStart, 
+											lineEnd, 
+											columnStart, 
+											columnEnd, 
+											lineInterval, 
+											columnInterval,
+											1,
+											1,
+											0);
+	
+	gNextTime = TickCount ();
+	gNextStatusTime = gNextTime;
+	
+			// The class counts are cleared again before the full resolution pass.
+	
+	clsfyVariablePtr->previewFlag = TRUE;
+	
+	returnCode = ClassifyPerPointArea (-1, 
+													&previewAreaDescription, 
+													fileIOInstructionsPtr,
+													lcToWindowUnitsVariablesPtr,
+													clsfyVariablePtr, 
+													&clsfyVariablePtr->countVectorPtr[0]);
+	
+	clsfyVariablePtr->previewFlag = FALSE;
+	
+	return (returnCode);
+			
+}	// end "ClassifyPreviewArea" 
+
+
+
 //------------------------------------------------------------------------------------
 //                   Copyright 1988-2020 Purdue Research Foundation
 //
@@ -6685,7 +7300,7 @@ Boolean GetTtInvTransformedCovarianceT (
 // Called By:
 //
 //	Coded By:			Larry L. Biehl			Date: 10/01/1992
-//	Revised By:			Larry L. Biehl			Date: 03/27/2012	
+//	Revised By:			agent						Date: 10/18/2026	
 
 void InitializeClassifierVarStructure (
 				ClassifierVar						*classifierVarPtr)
@@ -6718,11 +7333,16 @@ void InitializeClassifierVarStructure (
 		classifierVarPtr->covariancePtr = NULL;
 		classifierVarPtr->workVectorPtr = NULL;
 		classifierVarPtr->workVector2Ptr = NULL;
+		classifierVarPtr->chanMeanFloatPtr = NULL;
+		classifierVarPtr->covarianceFloatPtr = NULL;
+		classifierVarPtr->workVectorFloatPtr = NULL;
 		classifierVarPtr->countVectorPtr = NULL;
 		classifierVarPtr->countClassIndexPtr = NULL;
 		classifierVarPtr->totalCorrectSamples = 0;
 		classifierVarPtr->totalNumberSamples = 0;
 		classifierVarPtr->totalSameDistanceSamples = -1;
+		classifierVarPtr->float32CheckSamples = 0;
+		classifierVarPtr->float32DifferentSamples = 0;
 		classifierVarPtr->tableWidth = 0;
 		classifierVarPtr->totalCountIndexStart = 0;
 		classifierVarPtr->areaCode = 0;
@@ -7903,7 +8523,7 @@ SInt16 ListTrainTestSummary (
 // Called By:			ClassifyControl
 //
 //	Coded By:			Larry L. Biehl			Date: 12/07/1988
-//	Revised By:			Larry L. Biehl			Date: 09/19/2019
+//	Revised By:			agent						Date: 10/18/2026
 
 Boolean LoadClassifySpecs (
 				FileInfoPtr							fileInfoPtr)
@@ -7959,6 +8579,8 @@ Boolean LoadClassifySpecs (
 			gClassifySpecsPtr->classVectorPtr = NULL;
 			gClassifySpecsPtr->thresholdProbabilityPtr = NULL;
 			gClassifySpecsPtr->symbolsPtr = NULL;
+			gClassifySpecsPtr->batchTargetsFlag = FALSE;
+			gClassifySpecsPtr->float32ComputeFlag = FALSE;
 			gClassifySpecsPtr->imageAreaFlag = TRUE;
 			
 			gClassifySpecsPtr->supportVectorMachineModelAvailableFlag = FALSE;
@@ -8415,7 +9037,7 @@ Boolean LoadThresholdTable (
 // Called By:			ClassifyPerPointArea
 //
 //	Coded By:			Larry L. Biehl			Date: 12/15/1988
-//	Revised By:			Larry L. Biehl			Date: 03/27/2012
+//	Revised By:			agent						Date: 10/18/2026
 
 SInt16 MaximumLikelihoodClassifier (
 				AreaDescriptionPtr				areaDescriptionPtr, 
@@ -8439,9 +9061,17 @@ SInt16 MaximumLikelihoodClassifier (
 	double								discriminantMax,
 											dValue1,
 											dValue2,
+											float32NegRRDivide2Max,
 											neg_rrDivide2,
 											neg_rrDivide2Max;
 	
+	float									*chanMeanFloatPtr,
+											*covarianceFloatPtr,
+											*meanDiffFloatPtr,
+											*workVectorFloatPtr;
+	
+	float									fValue2;
+	
 	SInt16	 							*classPtr,
 											*thresholdProbabilityPtr; 
 												            
@@ -8455,12 +9085,19 @@ SInt16 MaximumLikelihoodClassifier (
 	UInt32								classIndex,
 											feat1,
 											feat2,
+											float32MaxClass,
+											float32SameDistanceCount,
 											maxClass,
 											numberChannels,
 											numberClasses,
+											numberPasses,
 											numberSamplesPerChan,
+											pass,
 											sameDistanceCount,
 											sample;
+	
+	Boolean								float32Flag,
+											useFloatFlag;
 											
 			// For Quiong special case
 			
@@ -8483,11 +9120,21 @@ SInt16 MaximumLikelihoodClassifier (
 	
 	classConstantPtr = 		clsfyVariablePtr->classConstantPtr;
 	workVectorPtr = 			clsfyVariablePtr->workVectorPtr;
+	workVectorFloatPtr =		clsfyVariablePtr->workVectorFloatPtr;
 	thresholdTablePtr =	 	gClassifySpecsPtr->thresholdTablePtr;
 	thresholdProbabilityPtr = gClassifySpecsPtr->thresholdProbabilityPtr;
 	
 	sameDistanceCount =		0;
 	
+			// The single precision computation is only used if the single
+			// precision copies of the class statistics could be created.
+	
+	float32Flag = (clsfyVariablePtr->covarianceFloatPtr != NULL);
+	
+	float32MaxClass = 0;
+	float32NegRRDivide2Max = 0;
+	float32SameDistanceCount = 0;
+	
 	continueFlag = TRUE;
 	
   	if (gTestFlag)
@@ -8520,96 +9167,184 @@ SInt16 MaximumLikelihoodClassifier (
 					// Loop through the classes and get the discriminant value for	
 					// each class.																	
 		
-			discriminantMax = -1e200;
-			covariancePtr = clsfyVariablePtr->covariancePtr;
-			chanMeanPtr = clsfyVariablePtr->chanMeanPtr;
+			numberPasses = 1;
+			if (float32Flag && !clsfyVariablePtr->previewFlag &&
+												sample % kFloat32CheckInterval == 0)
+				numberPasses = 2;
 			
-			for (classIndex=0; classIndex<numberClasses; classIndex++)
+			for (pass=0; pass<numberPasses; pass++)
 				{
-						// Loop through the channels (features) and get the vector  
-						// of data values with the class means subtracted out.		
+						// The first pass uses the single precision class means and
+						// inverse covariances if requested. The second pass is only
+						// done for the pixels used to check the single precision
+						// results against the double precision results.
 						
-				ioBufferReal8Ptr = savedBufferReal8Ptr;
-				meanDiffPtr = workVectorPtr;
-				for (feat1=0; feat1<numberChannels; feat1++)
-					{
-					*meanDiffPtr = *ioBufferReal8Ptr - *chanMeanPtr;
-					
-					ioBufferReal8Ptr++;
-					chanMeanPtr++;
-					meanDiffPtr++;
-					
-					}	// end "for (feature=0; feature<..." 
-					
-						// Compute discriminant value for class "statClassNumber"		
+				useFloatFlag = (float32Flag && pass == 0);
 				
-				dValue1 = 0.;
+				discriminantMax = -1e200;
+				covariancePtr = clsfyVariablePtr->covariancePtr;
+				chanMeanPtr = clsfyVariablePtr->chanMeanPtr;
+				covarianceFloatPtr = clsfyVariablePtr->covarianceFloatPtr;
+				chanMeanFloatPtr = clsfyVariablePtr->chanMeanFloatPtr;
 				
-				for (feat1=0; feat1<numberChannels; feat1++)
+				for (classIndex=0; classIndex<numberClasses; classIndex++)
 					{
-					meanDiffPtr = workVectorPtr;
-					dValue2 = 0.;					
-					for (feat2=0; feat2<feat1; feat2++)
+							// Loop through the channels (features) and get the vector  
+							// of data values with the class means subtracted out.		
+							
+					if (useFloatFlag)
 						{
-						dValue2 -= *covariancePtr * *meanDiffPtr;
-						covariancePtr++;
-						meanDiffPtr++;	
-					
-						}	// end "for (feat2=0; feat2<..." 
+						ioBufferReal8Ptr = savedBufferReal8Ptr;
+						meanDiffFloatPtr = workVectorFloatPtr;
+						for (feat1=0; feat1<numberChannels; feat1++)
+							{
+							*meanDiffFloatPtr =
+										(float)*ioBufferReal8Ptr - *chanMeanFloatPtr;
+							
+							ioBufferReal8Ptr++;
+							chanMeanFloatPtr++;
+							meanDiffFloatPtr++;
+							
+							}	// end "for (feat1=0; feat1<numberChannels; feat1++)"
+							
+								// The sum for each row of the inverse covariance is
+								// done in single precision. The sum over the rows is
+								// done in double precision.
 						
-					dValue2 += dValue2;
-					dValue1 += *meanDiffPtr * (dValue2 - *covariancePtr * *meanDiffPtr);
-					covariancePtr++;
-					
-					}	// end "for (feat1=0; feat1<..." 
-					
-				neg_rrDivide2 = dValue1/2;
-				dValue2 = classConstantPtr[classIndex];
-				
-				if (clsfyVariablePtr->useLeaveOneOutMethodFlag && 
-										classPtr[classIndex] == areaDescriptionPtr->classNumber)
-					{
-					dValue1 = -dValue1;
-					
-					dValue2 = clsfyVariablePtr->classConstantLOO1Ptr[classIndex]*dValue1 +
-						clsfyVariablePtr->classConstantLOO5Ptr[classIndex] * dValue1*dValue1;
-											
-					dValue2 /= 2 * (clsfyVariablePtr->classConstantLOO2Ptr[classIndex] -
-								clsfyVariablePtr->classConstantLOO5Ptr[classIndex] * dValue1);
-					
-					neg_rrDivide2 -= dValue2;
+						dValue1 = 0.;
+						
+						for (feat1=0; feat1<numberChannels; feat1++)
+							{
+							meanDiffFloatPtr = workVectorFloatPtr;
+							fValue2 = 0.;
+							for (feat2=0; feat2<feat1; feat2++)
+								{
+								fValue2 -= *covarianceFloatPtr * *meanDiffFloatPtr;
+								covarianceFloatPtr++;
+								meanDiffFloatPtr++;
+								
+								}	// end "for (feat2=0; feat2<feat1; feat2++)"
+								
+							fValue2 += fValue2;
+							dValue1 += (double)*meanDiffFloatPtr *
+												(fValue2 - *covarianceFloatPtr * *meanDiffFloatPtr);
+							covarianceFloatPtr++;
+							
+							}	// end "for (feat1=0; feat1<numberChannels; feat1++)"
+						
+						}	// end "if (useFloatFlag)"
+						
+					else	// !useFloatFlag
+						{
+						ioBufferReal8Ptr = savedBufferReal8Ptr;
+						meanDiffPtr = workVectorPtr;
+						for (feat1=0; feat1<numberChannels; feat1++)
+							{
+							*meanDiffPtr = *ioBufferReal8Ptr - *chanMeanPtr;
+							
+							ioBufferReal8Ptr++;
+							chanMeanPtr++;
+							meanDiffPtr++;
+							
+							}	// end "for (feature=0; feature<..." 
+							
+								// Compute discriminant value for class "statClassNumber"		
+						
+						dValue1 = 0.;
+						
+						for (feat1=0; feat1<numberChannels; feat1++)
+							{
+							meanDiffPtr = workVectorPtr;
+							dValue2 = 0.;					
+							for (feat2=0; feat2<feat1; feat2++)
+								{
+								dValue2 -= *covariancePtr * *meanDiffPtr;
+								covariancePtr++;
+								meanDiffPtr++;	
+							
+								}	// end "for (feat2=0; feat2<..." 
+								
+							dValue2 += dValue2;
+							dValue1 += *meanDiffPtr * (dValue2 - *covariancePtr * *meanDiffPtr);
+							covariancePtr++;
+							
+							}	// end "for (feat1=0; feat1<..." 
+						
+						}	// end "else !useFloatFlag"
 					
+					neg_rrDivide2 = dValue1/2;
 					dValue2 = classConstantPtr[classIndex];
-											
-					dValue2 -= 
-							.5 * log (1 - clsfyVariablePtr->classConstantLOO3Ptr[classIndex] *
-												dValue1);
-											
-					dValue2 -= .5 * clsfyVariablePtr->classConstantLOO4Ptr[classIndex];
 					
-					}	// end "if (clsfyVariablePtr->useLeaveOneOutMethodFlag)"
+					if (clsfyVariablePtr->useLeaveOneOutMethodFlag && 
+											classPtr[classIndex] == areaDescriptionPtr->classNumber)
+						{
+						dValue1 = -dValue1;
+						
+						dValue2 = clsfyVariablePtr->classConstantLOO1Ptr[classIndex]*dValue1 +
+							clsfyVariablePtr->classConstantLOO5Ptr[classIndex] * dValue1*dValue1;
+												
+						dValue2 /= 2 * (clsfyVariablePtr->classConstantLOO2Ptr[classIndex] -
+									clsfyVariablePtr->classConstantLOO5Ptr[classIndex] * dValue1);
+						
+						neg_rrDivide2 -= dValue2;
+						
+						dValue2 = classConstantPtr[classIndex];
+												
+						dValue2 -= 
+								.5 * log (1 - clsfyVariablePtr->classConstantLOO3Ptr[classIndex] *
+													dValue1);
+												
+						dValue2 -= .5 * clsfyVariablePtr->classConstantLOO4Ptr[classIndex];
+						
+						}	// end "if (clsfyVariablePtr->useLeaveOneOutMethodFlag)"
+						
+					dValue2 += neg_rrDivide2;
 					
-				dValue2 += neg_rrDivide2;
-				
-						// Check if discriminant value for this class is largest.  If	
-						// so, save the value and the class number.							
+							// Check if discriminant value for this class is largest.  If	
+							// so, save the value and the class number.							
+							
+					if (dValue2 > discriminantMax)
+						{
+						discriminantMax = dValue2;
+						neg_rrDivide2Max = neg_rrDivide2;
+						maxClass = classIndex;
+						sameDistanceCount = 0;
 						
-				if (dValue2 > discriminantMax)
+						}	// end "if (dValue1 > discriminantMax)"
+						
+					else if (dValue2 == discriminantMax)
+						sameDistanceCount++;
+					
+					//if (gTestFlag)	
+					//	workVector2Ptr[classIndex] = dValue2;
+		
+					}	// end "for (classIndex=0; classIndex<..."
+					
+				if (numberPasses == 2)
 					{
-					discriminantMax = dValue2;
-					neg_rrDivide2Max = neg_rrDivide2;
-					maxClass = classIndex;
-					sameDistanceCount = 0;
+					if (pass == 0)
+						{
+						float32MaxClass = maxClass;
+						float32NegRRDivide2Max = neg_rrDivide2Max;
+						float32SameDistanceCount = sameDistanceCount;
+						
+						}	// end "if (pass == 0)"
+						
+					else	// pass == 1
+						{
+						clsfyVariablePtr->float32CheckSamples++;
+						if (maxClass != float32MaxClass)
+							clsfyVariablePtr->float32DifferentSamples++;
+							
+						maxClass = float32MaxClass;
+						neg_rrDivide2Max = float32NegRRDivide2Max;
+						sameDistanceCount = float32SameDistanceCount;
+						
+						}	// end "else pass == 1"
 					
-					}	// end "if (dValue1 > discriminantMax)"
+					}	// end "if (numberPasses == 2)"
 					
-				else if (dValue2 == discriminantMax)
-					sameDistanceCount++;
-				
-				//if (gTestFlag)	
-				//	workVector2Ptr[classIndex] = dValue2;
-	
-				}	// end "for (classIndex=0; classIndex<..."
+				}	// end "for (pass=0; pass<numberPasses; pass++)"
 			/*         
          if (gTestFlag)
          	{	
@@ -8743,7 +9478,7 @@ SInt16 MaximumLikelihoodClassifier (
 // Called By:			ClassifyControl
 //
 //	Coded By:			Larry L. Biehl			Date: 12/10/1988
-//	Revised By:			Larry L. Biehl			Date: 01/21/2016
+//	Revised By:			agent						Date: 10/18/2026
 
 void MaxLikeClsfierControl (
 				FileInfoPtr							fileInfoPtr)
@@ -8776,6 +9511,7 @@ void MaxLikeClsfierControl (
 	
 	UInt32								clsfyCovStart,
 											clsfyChanMeanStart,
+											index,
 											numberClsfyCovEntries;
 												
 	SInt16								weightsIndex;
@@ -9033,6 +9769,50 @@ void MaxLikeClsfierControl (
 		classifierVar.classConstantLOO5Ptr = classConstantLOO5Ptr;
 		classifierVar.workVectorPtr = 		gInverseMatrixMemory.pivotPtr;
 		
+				// Get single precision copies of the class means and inverse
+				// covariances if requested. The double precision versions are
+				// used if the memory is not available.
+		
+		if (continueClassifyFlag && gClassifySpecsPtr->float32ComputeFlag)
+			{
+			clsfyCovStart = gClassifySpecsPtr->numberClasses * numberClsfyCovEntries;
+			clsfyChanMeanStart =
+						gClassifySpecsPtr->numberClasses * (UInt32)numberFeatureChannels;
+			
+			classifierVar.covarianceFloatPtr =
+									(float*)MNewPointer (clsfyCovStart * sizeof (float));
+			classifierVar.chanMeanFloatPtr =
+									(float*)MNewPointer (clsfyChanMeanStart * sizeof (float));
+			classifierVar.workVectorFloatPtr =
+							(float*)MNewPointer (numberFeatureChannels * sizeof (float));
+			
+			if (classifierVar.covarianceFloatPtr != NULL &&
+						classifierVar.chanMeanFloatPtr != NULL &&
+								classifierVar.workVectorFloatPtr != NULL)
+				{
+				for (index=0; index<clsfyCovStart; index++)
+					classifierVar.covarianceFloatPtr[index] =
+															(float)classifyCovPtr[index];
+				
+				for (index=0; index<clsfyChanMeanStart; index++)
+					classifierVar.chanMeanFloatPtr[index] =
+															(float)classifyChanMeanPtr[index];
+				
+				}	// end "if (classifierVar.covarianceFloatPtr != NULL && ..."
+			
+			else	// a float pointer is NULL
+				{
+				classifierVar.covarianceFloatPtr = (float*)CheckAndDisposePtr (
+													(Ptr)classifierVar.covarianceFloatPtr);
+				classifierVar.chanMeanFloatPtr = (float*)CheckAndDisposePtr (
+													(Ptr)classifierVar.chanMeanFloatPtr);
+				classifierVar.workVectorFloatPtr = (float*)CheckAndDisposePtr (
+													(Ptr)classifierVar.workVectorFloatPtr);
+				
+				}	// end "else a float pointer is NULL"
+			
+			}	// end "if (continueClassifyFlag && ...->float32ComputeFlag)"
+		
 		if (continueClassifyFlag)
 			{
 					// If thresholding is to be used, get table of threshold 		
@@ -9046,6 +9826,30 @@ void MaxLikeClsfierControl (
 			if (continueFlag)
 				ClassifyAreasControl (fileInfoPtr, &classifierVar);
 			
+					// List how often the single precision computation assigned the
+					// checked pixels to a different class than double precision.
+			
+			if (classifierVar.float32CheckSamples > 0)
+				{
+				sprintf ((char*)gTextString,
+							"%s    Single precision check: %lld of %lld sampled pixels"
+							" (%.3f%%) assigned to a different class than with double"
+							" precision.%s",
+							gEndOfLine,
+							classifierVar.float32DifferentSamples,
+							classifierVar.float32CheckSamples,
+							100. * classifierVar.float32DifferentSamples /
+														classifierVar.float32CheckSamples,
+							gEndOfLine);
+				
+				continueFlag = OutputString (resultsFileStreamPtr,
+														(char*)gTextString,
+														0,
+														gOutputForce1Code,
+														continueFlag);
+				
+				}	// end "if (classifierVar.float32CheckSamples > 0)"
+			
 			}	// end "continueClassifyFlag" 
 				
 		else	// !continueClassifyFlag 
@@ -9074,6 +9878,9 @@ void MaxLikeClsfierControl (
 	CheckAndDisposePtr (classifyCovPtr);
 	CheckAndDisposePtr (classConstantPtr);
 	CheckAndDisposePtr (classConstantLOO1Ptr);
+	CheckAndDisposePtr ((Ptr)classifierVar.chanMeanFloatPtr);
+	CheckAndDisposePtr ((Ptr)classifierVar.covarianceFloatPtr);
+	CheckAndDisposePtr ((Ptr)classifierVar.workVectorFloatPtr);
 	
 	ReleaseMatrixInversionMemory ();
 	
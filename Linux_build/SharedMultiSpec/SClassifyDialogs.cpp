@@ -18,7 +18,7 @@
 //
 //	Authors:					Larry L. Biehl
 //
-//	Revision date:			05/12/2020
+//	Revision date:			10/18/2026
 //
 //	Language:				C
 //
@@ -2439,7 +2439,9 @@ void ClassifyDialogOK (
 				SInt16								listResultsTestCode,
 				SInt16								listResultsTrainingCode,
 				SInt16								parallelPipedCode,
-				SInt16								nearestNeighborKValue)
+				SInt16								nearestNeighborKValue,
+				Boolean								batchTargetsFlag,
+				Boolean								float32ComputeFlag)
 
 {
 	double								thresholdValue;
@@ -2731,6 +2733,16 @@ void ClassifyDialogOK (
 	
 	gClassifySpecsPtr->nearestNeighborKValue = nearestNeighborKValue;
 	
+			// Other compatible image windows can only be classified along with the
+			// image area of the target image.
+	
+	gClassifySpecsPtr->batchTargetsFlag = (batchTargetsFlag && imageAreaFlag);
+	
+			// The single precision computation is only used by the maximum
+			// likelihood and Mahalanobis classifiers.
+	
+	gClassifySpecsPtr->float32ComputeFlag = float32ComputeFlag;
+	
 }	// end "ClassifyDialogOK"
 
                           
@@ -3106,6 +3118,25 @@ SInt16 ClassifyDialogOnTargetFile (
 	
 }	// end "ClassifyDialogOnTargetFile"
 
+
+
+#if defined multispec_wx || defined multispec_win
+void ClassifyDialogSetFloat32ComputeItem (
+				DialogPtr							dialogPtr,
+				SInt16								classificationProcedure)
+	
+{  
+			// The single precision option is only used by the maximum likelihood
+			// and Mahalanobis classifiers.
+			
+	ShowHideDialogItem (dialogPtr,
+								IDC_Float32Compute,
+								(classificationProcedure == kMaxLikeMode ||
+										classificationProcedure == kMahalanobisMode));
+	
+}	// end "ClassifyDialogSetFloat32ComputeItem"
+#endif	// defined multispec_wx || defined multispec_win
+
                           
 	                
 Boolean ClassifyDialogSetLeaveOneOutItems (
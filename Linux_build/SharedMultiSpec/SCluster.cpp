@@ -61,6 +61,9 @@
 //			GetClusterProjectStatistics
 //				GetProjectStatisticsPointers (in SProject.cpp)
 //
+//				GetClusterPassStatistics
+//					GetProjectStatisticsPointers (in SProject.cpp)
+//
 //				GetClusterAreaStatistics
 //					GetProjectStatisticsPointers (in SProject.cpp)
 //
@@ -101,6 +104,7 @@
 	#define	IDC_ImageOverlayCombo			40
 	
 	#define	IDS_Cluster52						52
+	#define	IDS_Cluster53						53
 	
 	#define	IDS_Alert141						141
 	#define	IDS_Alert142						142
@@ -208,6 +212,9 @@ Boolean 	GetClusterAreaStatistics (
 				HUInt16Ptr*							dataClassPtrPtr, 
 				SInt16								firstLineCode);
 									
+Boolean 	GetClusterPassStatistics (
+				SInt16								storageIndex);
+									
 Boolean 	GetClusterProjectStatistics (
 				FileIOInstructionsPtr			fileIOInstructionsPtr, 
 				ProjectInfoPtr						projectClassInfoPtr, 
@@ -4171,6 +4178,221 @@ Boolean GetClusterAreaStatistics (
 
 
 
+//------------------------------------------------------------------------------------
+//                   Copyright 1988-2020 Purdue Research Foundation
+//
+//	Function name:		Boolean GetClusterPassStatistics
+//
+//	Software purpose:	The purpose of this routine is to load the cluster
+//							statistics into the project from the sums, sums of squares,
+//							minimums and maximums that were accumulated for each
+//							cluster during the ISODATA passes. These describe the pixel
+//							assignments of the final pass, so the cluster areas do not
+//							need to be read again. This can only be done when the 
+//							project statistics channels are the cluster channels.
+//
+//	Parameters in:		The index within the class or field statistics structure
+//									at which the cluster statistics are to start.
+//
+//	Parameters out:	None
+//
+// Value Returned:	True if the statistics were loaded
+//							False if the statistics need to be read from the cluster
+//								areas
+// 
+// Called By:			GetClusterProjectStatistics in SCluster.cpp
+//
+//	Coded By:			agent						Date: 10/18/2026
+//	Revised By:			agent						Date: 10/18/2026
+
+Boolean GetClusterPassStatistics (
+				SInt16								storageIndex)
+
+{
+	HChannelStatisticsPtr			areaChanPtr,
+											localChanStatsPtr;
+										
+	HCovarianceStatisticsPtr		areaSumSquaresPtr,
+											localSumSquaresStatsPtr;
+	
+	ClusterType*						currentCluster;
+	HDoublePtr							clusterSumSquarePtr;
+	
+	SInt16								*channelsPtr,
+											*classToFinalClassPtr;
+	
+	SInt32								numberSumSquares;
+	
+	UInt32								channel,
+											covChan,
+											covIndex,
+											numberChannels;
+	
+	SInt16								classFieldCode,
+											finalClass;
+	
+	
+			// Initialize local variables. 													
+	
+	currentCluster = gClusterSpecsPtr->clusterHead;
+	classToFinalClassPtr = gClusterSpecsPtr->clusterClassToFinalClassPtr;
+	numberChannels = (UInt32)gProjectInfoPtr->numberStatisticsChannels;
+	
+	if (gClusterSpecsPtr->mode != kISODATA ||
+				currentCluster == NULL ||
+						currentCluster->minimumPtr == NULL ||
+								classToFinalClassPtr == NULL)
+																							return (FALSE);
+	
+	if (gProjectInfoPtr->statisticsCode == kMeanCovariance &&
+												currentCluster->sumSquarePtr2 == NULL)
+																							return (FALSE);
+	
+	if (numberChannels != (UInt32)gClusterSpecsPtr->numberChannels)
+																							return (FALSE);
+	
+	channelsPtr = (SInt16*)GetHandlePointer (gClusterSpecsPtr->channelsHandle);
+	for (channel=0; channel<numberChannels; channel++)
+		{
+		if ((SInt16)gProjectInfoPtr->channelsPtr[channel] != channelsPtr[channel])
+																							return (FALSE);
+		
+		}	// end "for (channel=0; channel<numberChannels; channel++)"
+	
+	numberSumSquares = gProjectInfoPtr->numberCovarianceEntries;
+	classFieldCode = gProjectInfoPtr->keepClassStatsOnlyFlag + 1;
+	GetProjectStatisticsPointers (classFieldCode, 
+											storageIndex, 
+											&localChanStatsPtr, 
+											&localSumSquaresStatsPtr,
+											NULL,
+											NULL);
+	
+	while (currentCluster != NULL)
+		{
+		finalClass = classToFinalClassPtr[currentCluster->clusterNumber];
+		
+		if (finalClass >= 0 && currentCluster->numPixels > 0)
+			{
+			areaChanPtr = &localChanStatsPtr[finalClass*numberChannels];
+			areaSumSquaresPtr = &localSumSquaresStatsPtr[finalClass*numberSumSquares];
+			clusterSumSquarePtr = currentCluster->sumSquarePtr2;
+			covIndex = 0;
+			
+			for (channel=0; channel<numberChannels; channel++)
+				{
+				areaChanPtr[channel].minimum = MIN (areaChanPtr[channel].minimum, 
+																currentCluster->minimumPtr[channel]);
+				areaChanPtr[channel].maximum = MAX (areaChanPtr[channel].maximum, 
+																currentCluster->maximumPtr[channel]);
+				
+				areaChanPtr[channel].sum += currentCluster->sumPtr[channel];
+				
+						// The cross sums of squares are stored by row of the lower 
+						// triangle including the diagonal.
+				
+				if (gProjectInfoPtr->statisticsCode	== kMeanCovariance)
+					{
+					for (covChan=0; covChan<=channel; covChan++)
+						areaSumSquaresPtr[covIndex++] += clusterSumSquarePtr[covChan];
+						
+					clusterSumSquarePtr += channel + 1;
+						
+					}	// end "if (...->statisticsCode	== kMeanCovariance)"
+					
+				else	// ...->statisticsCode	!= kMeanCovariance
+					areaSumSquaresPtr[covIndex++] += 
+														currentCluster->sumSquarePtr1[channel];
+				
+				}	// end "for (channel=0; channel<numberChannels; channel++)"
+				
+			}	// end "if (finalClass >= 0 && ...)"
+			
+		currentCluster = currentCluster->next;
+		
+		}	// end "while (currentCluster != NULL)"
+	
+	return (TRUE);
+		
+}	// end "GetClusterPassStatistics" 
+
+
+
+//------------------------------------------------------------------------------------
+//                   Copyright 1988-2020 Purdue Research Foundation
+//
+//	Function name:		SInt16 GetClusterPassStatisticsCode
+//
+//	Software purpose:	The purpose of this routine is to determine which statistics
+//							the ISODATA passes need to keep for each cluster so that
+//							the project statistics can be taken from the final pass.
+//							The cross sums of squares are only kept when the project
+//							will store covariances since they have to be updated for
+//							every pixel that changes clusters. Nothing is kept when the
+//							project channels are not the cluster channels; the cluster
+//							areas will be read again in that case.
+//
+//	Parameters in:		None
+//
+//	Parameters out:	None
+//
+// Value Returned:	0 if no statistics are to be kept during the passes
+//							kMeanStdDevOnly if the channel sums of squares are enough
+//							kMeanCovariance if the cross sums of squares are needed
+// 
+// Called By:			GetMemoryForClusters in SClusterIsodata.cpp
+//
+//	Coded By:			agent						Date: 10/18/2026
+//	Revised By:			agent						Date: 10/18/2026
+
+SInt16 GetClusterPassStatisticsCode (void)
+
+{
+	SInt16								*channelsPtr;
+	
+	UInt32								channel,
+											numberChannels;
+	
+	SInt16								statisticsCode;
+	
+	
+	if (gClusterSpecsPtr->saveStatisticsCode <= 0 || gProjectInfoPtr == NULL)
+																							return (0);
+	
+	statisticsCode = gProjectInfoPtr->statisticsCode;
+	
+	if (gClusterSpecsPtr->saveStatisticsCode == 1)
+		{
+				// Statistics saved to a new project will use the cluster channels.
+				// A project that is created for them will store covariances.
+		
+		if (!gProjectInfoPtr->newProjectFlag)
+			statisticsCode = kMeanCovariance;
+		
+		}	// end "if (gClusterSpecsPtr->saveStatisticsCode == 1)"
+	
+	else	// gClusterSpecsPtr->saveStatisticsCode != 1
+		{
+		numberChannels = (UInt32)gProjectInfoPtr->numberStatisticsChannels;
+		if (numberChannels != (UInt32)gClusterSpecsPtr->numberChannels)
+																							return (0);
+		
+		channelsPtr = (SInt16*)GetHandlePointer (gClusterSpecsPtr->channelsHandle);
+		for (channel=0; channel<numberChannels; channel++)
+			{
+			if ((SInt16)gProjectInfoPtr->channelsPtr[channel] != channelsPtr[channel])
+																							return (0);
+			
+			}	// end "for (channel=0; channel<numberChannels; channel++)"
+		
+		}	// end "else gClusterSpecsPtr->saveStatisticsCode != 1"
+	
+	return (statisticsCode);
+		
+}	// end "GetClusterPassStatisticsCode" 
+
+
+
 //------------------------------------------------------------------------------------
 //                   Copyright 1988-2020 Purdue Research Foundation
 //
@@ -4197,7 +4419,7 @@ Boolean GetClusterAreaStatistics (
 // Called By:			SaveClusterStatistics in SCluster.cpp
 //
 //	Coded By:			Larry L. Biehl			Date: 03/18/1991
-//	Revised By:			Larry L. Biehl			Date: 05/18/2018
+//	Revised By:			agent						Date: 10/18/2026
 
 Boolean GetClusterProjectStatistics (
 				FileIOInstructionsPtr			fileIOInstructionsPtr,  
@@ -4307,12 +4529,20 @@ Boolean GetClusterProjectStatistics (
 	
 	if (gClusterSpecsPtr->mode == kISODATA)
 		{
-		if (!GetClusterAreaStatistics (fileIOInstructionsPtr, 
-													projectClassInfoPtr, 
-													fieldStatStorage, 
-													&dataClassPtr, 
-													0))
+				// Use the statistics accumulated during the final pass if they 
+				// apply to the project channels; otherwise read the cluster areas
+				// again.
+				
+		if (!GetClusterPassStatistics (fieldStatStorage))
+			{
+			if (!GetClusterAreaStatistics (fileIOInstructionsPtr, 
+														projectClassInfoPtr, 
+														fieldStatStorage, 
+														&dataClassPtr, 
+														0))
 																							return (FALSE);
+																							
+			}	// end "if (!GetClusterPassStatistics (fieldStatStorage))"
 																					
 		}	// end "if (gClusterSpecsPtr->mode == kISODATA)" 
   	
@@ -4953,7 +5183,7 @@ void KeepLargestClusters (
 //							
 //
 //	Coded By:			Larry L. Biehl			Date: 02/13/2000
-//	Revised By:			Larry L. Biehl			Date: 02/15/2000	
+//	Revised By:			agent						Date: 10/18/2026
 
 Boolean ListClusterInputParameters (
 				FileInfoPtr							fileInfoPtr,
@@ -5040,6 +5270,9 @@ Boolean ListClusterInputParameters (
 			
 			}	// end "if (gClusterSpecsPtr->initializationOption == 2)"
 			
+		else if (gClusterSpecsPtr->initializationOption == 4)	
+			index = IDS_Cluster53;
+			
 		else 		// gClusterSpecsPtr->initializationOption == 3
 			index = IDS_Cluster9;	
 							
@@ -51,6 +51,10 @@
 //
 //				GetOnePassClusterCenters (in SClusterSinglePass.cpp)
 //
+//				GetSampleSeededClusterCenters
+//					GetNextClusterArea (in SCluster.cpp)
+//					GetLineOfData (in SFileIO.cpp)
+//
 //			ListClusterStatistics (in SCluster.cpp)
 //
 //			ISODATACluster
@@ -194,10 +198,13 @@
 #define AddClusterStats(pix, cluster)														\
 	{																									\
 	HDoublePtr   			clusterSumPtr;														\
-	HDoublePtr				clusterSumSquarePtr;												\
-	short int 				channelTemp;														\
+	HDoublePtr				clusterSumSquarePtr,												\
+								crossSumSquarePtr;												\
+	short int 				channelTemp,														\
+								covChanTemp;														\
 	SInt32					numPixTemp;															\
-	HCTypePtr  				pixPtr1;																\
+	HCTypePtr  				pixPtr1,																\
+								pixPtr2;																\
 																										\
 	clusterSumPtr = cluster->sumPtr;															\
 	clusterSumSquarePtr = cluster->sumSquarePtr1;										\
@@ -213,6 +220,22 @@
 		clusterSumSquarePtr++;																	\
 	   pixPtr1++;																					\
 	   }																								\
+	if (cluster->sumSquarePtr2 != NULL)														\
+		{																								\
+		crossSumSquarePtr = cluster->sumSquarePtr2;										\
+		pixPtr1 = pix;																				\
+		for (channelTemp = 0; channelTemp < numberChannels; channelTemp++)		\
+			{																							\
+			pixPtr2 = pix;																			\
+			for (covChanTemp = 0; covChanTemp <= channelTemp; covChanTemp++)		\
+				{																						\
+				*crossSumSquarePtr += (double)*pixPtr1 * *pixPtr2;						\
+				crossSumSquarePtr++;																\
+				pixPtr2++;																			\
+				}																						\
+			pixPtr1++;																				\
+			}																							\
+		}																								\
 	cluster->varianceComputed = FALSE;														\
 	}
 
@@ -221,10 +244,13 @@
 #define SubtractClusterStats(pix, cluster)												\
 	{																									\
 	HDoublePtr   			clusterSumPtr;														\
-	HDoublePtr				clusterSumSquarePtr;												\
-	short int 				channelTemp;														\
+	HDoublePtr				clusterSumSquarePtr,												\
+								crossSumSquarePtr;												\
+	short int 				channelTemp,														\
+								covChanTemp;														\
 	SInt32					numPixTemp;															\
-	HCTypePtr  				pixPtr1;																\
+	HCTypePtr  				pixPtr1,																\
+								pixPtr2;																\
 																										\
 	clusterSumPtr = cluster->sumPtr;															\
 	clusterSumSquarePtr = cluster->sumSquarePtr1;										\
@@ -240,6 +266,22 @@
 		clusterSumSquarePtr++;																	\
 	   pixPtr1++;																					\
 	   }																								\
+	if (cluster->sumSquarePtr2 != NULL)														\
+		{																								\
+		crossSumSquarePtr = cluster->sumSquarePtr2;										\
+		pixPtr1 = pix;																				\
+		for (channelTemp = 0; channelTemp < numberChannels; channelTemp++)		\
+			{																							\
+			pixPtr2 = pix;																			\
+			for (covChanTemp = 0; covChanTemp <= channelTemp; covChanTemp++)		\
+				{																						\
+				*crossSumSquarePtr -= (double)*pixPtr1 * *pixPtr2;						\
+				crossSumSquarePtr++;																\
+				pixPtr2++;																			\
+				}																						\
+			pixPtr1++;																				\
+			}																							\
+		}																								\
 	cluster->varianceComputed = FALSE;														\
 	}
 
@@ -270,6 +312,9 @@ Boolean GetEigenvectorClusterCenters (
 ClusterType* GetMemoryForClusters (
 				SInt16								numberClusters);
 
+Boolean GetSampleSeededClusterCenters (
+				FileIOInstructionsPtr			fileIOInstructionsPtr);
+
 Boolean InitializeClusterCenters (
 				FileIOInstructionsPtr			fileIOInstructionsPtr);
 
@@ -1124,7 +1169,7 @@ Boolean GetEigenvectorClusterCenters (
 // Called By:
 //
 //	Coded By:			Larry L. Biehl			Date: 08/08/1990
-//	Revised By:			Larry L. Biehl			Date: 02/07/2018
+//	Revised By:			agent						Date: 10/18/2026
 
 ClusterType* GetMemoryForClusters (
 				SInt16								numberClusters)
@@ -1140,9 +1185,11 @@ ClusterType* GetMemoryForClusters (
    										channelSumSquaresIndex,
    										cluster,
    										numberBytes,
-   										numberChannelSumsSquares;
+   										numberChannelSumsSquares,
+   										numberCrossSumsSquares;
 	
-   SInt16								numberChannels;
+   SInt16								numberChannels,
+   										passStatisticsCode;
 	
 	
 			// Check input variables.															
@@ -1153,6 +1200,7 @@ ClusterType* GetMemoryForClusters (
 			// Initialize local variables.													
 			
 	numberChannels = gClusterSpecsPtr->numberChannels;
+	passStatisticsCode = 0;
 	
 			// Get memory for the cluster structure;										
 					
@@ -1174,6 +1222,22 @@ ClusterType* GetMemoryForClusters (
 				// statistics are to be saved to a project file.						
 		
 		numberChannelSumsSquares = 3 * numberChannels;
+		
+				// The channel minimums and maximums are kept up to date during the
+				// passes so that the statistics for the project can be taken from
+				// the final pass instead of reading the cluster areas again. The
+				// cross sum of squares is only kept when the project will store
+				// covariances.
+		
+		passStatisticsCode = GetClusterPassStatisticsCode ();
+		
+		numberCrossSumsSquares = 0;
+		if (passStatisticsCode == kMeanCovariance)
+			numberCrossSumsSquares = (SInt32)numberChannels * (numberChannels + 1)/2;
+			
+		if (passStatisticsCode > 0)
+			numberChannelSumsSquares += numberCrossSumsSquares + 2 * numberChannels;
+			
 		numberBytes = 
 			(SInt32)numberClusters * numberChannelSumsSquares  * sizeof (double);
 		sumPtr = (HDoublePtr) MNewPointerClear (numberBytes);
@@ -1210,6 +1274,18 @@ ClusterType* GetMemoryForClusters (
 		newCluster->variancePtr = &newCluster->sumPtr[numberChannels];
 		newCluster->sumSquarePtr1 = &newCluster->variancePtr[numberChannels];
 		newCluster->sumSquarePtr2 = NULL;
+		newCluster->minimumPtr = NULL;
+		newCluster->maximumPtr = NULL;
+		
+		if (passStatisticsCode > 0)
+			{
+			newCluster->minimumPtr = &newCluster->sumSquarePtr1[numberChannels];
+			newCluster->maximumPtr = &newCluster->minimumPtr[numberChannels];
+			
+			if (numberCrossSumsSquares > 0)
+				newCluster->sumSquarePtr2 = &newCluster->maximumPtr[numberChannels];
+			
+			}	// end "if (passStatisticsCode > 0)"
 		
 		if (cluster != numberClusters)
 			newCluster->next = &clusterHead[cluster];
@@ -1228,6 +1304,339 @@ ClusterType* GetMemoryForClusters (
 
 
 
+//------------------------------------------------------------------------------------
+//                   Copyright 1988-2020 Purdue Research Foundation
+//
+//	Function name:		Boolean GetSampleSeededClusterCenters
+//
+//	Software purpose:	The purpose of this routine is to determine the initial
+//							cluster centers from a systematic sample of the pixels in the
+//							cluster areas. The first center is taken from the middle of
+//							the sample; each additional center is drawn from the sample
+//							with a probability proportional to its squared distance to
+//							the nearest center already chosen (k-means++ seeding).
+//
+//	Parameters in:		None
+//
+//	Parameters out:	None
+//
+// Value Returned:	None			
+// 
+// Called By:			InitializeClusterCenters in SClusterIsodata.cpp
+//
+//	Coded By:			agent						Date: 10/18/2026
+//	Revised By:			agent						Date: 10/18/2026
+
+Boolean GetSampleSeededClusterCenters (
+				FileIOInstructionsPtr			fileIOInstructionsPtr)
+
+{
+	ldiv_t								lDivideStruct;
+	
+	double								currentDistance,
+											randomValue,
+											targetDistance,
+											totalDistance;
+	
+	ClusterType							*currentCluster;
+	
+	Point									point;
+	
+	HCTypePtr							currentPixel,
+											outputBufferPtr;
+	
+	HDoublePtr							distancePtr,
+											samplePtr;
+	
+	UInt16*								channelsPtr;
+	
+	RgnHandle							rgnHandle;
+	
+	SInt64								pixelCount,
+											sampleInterval;
+	
+	SInt32								line,
+											lineEnd,
+											lineInterval,
+											lineStart;
+	
+	UInt32								bytesNeeded,
+											centerIndex,
+											column,
+											columnEnd,
+											columnInterval,
+											columnStart,
+											columnWidth,
+											firstColumn,
+											index,
+											numberSamples,
+											numberSeedSamples,
+											sample;
+	
+	SInt16								areaNumber,
+											channel,
+											cluster,
+											errCode,
+											lastClassIndex,
+											lastFieldIndex,
+											numberChannels,
+											numberClusters,
+											totalNumberAreas;
+	
+	Boolean								continueFlag,
+											polygonFieldFlag;
+	
+	
+			// Check input variables.															
+	
+	if (gClusterSpecsPtr == NULL || gClusterSpecsPtr->clusterHead == NULL)
+																					return (FALSE);
+	
+			// Initialize local variables.													
+	
+	channelsPtr = (UInt16*)GetHandlePointer (gClusterSpecsPtr->channelsHandle);
+	columnInterval = gClusterSpecsPtr->clusterColumnInterval;
+	lineInterval = gClusterSpecsPtr->clusterLineInterval;
+	numberChannels = gClusterSpecsPtr->numberChannels;
+	numberClusters = gClusterSpecsPtr->maxNumberClusters;
+	totalNumberAreas = gClusterSpecsPtr->totalNumberAreas;
+	outputBufferPtr = (CType*)gOutputBufferPtr;
+	lastClassIndex = -1;
+	lastFieldIndex = -1;
+	continueFlag = TRUE;
+	distancePtr = NULL;
+	pixelCount = 0;
+	numberSeedSamples = 0;
+	
+			// Spread the sample evenly over all pixels to be clustered so that
+			// each area contributes in proportion to its size.
+	
+	sampleInterval = 
+				gClusterSpecsPtr->totalNumberClusterPixels/kMaxNumberSeedSamples + 1;
+	
+	bytesNeeded = (UInt32)kMaxNumberSeedSamples * (numberChannels + 1) *
+																				sizeof (double);
+	samplePtr = (HDoublePtr)MNewPointer (bytesNeeded);
+	if (samplePtr == NULL)
+																					return (FALSE);
+	
+	distancePtr = &samplePtr[(UInt32)kMaxNumberSeedSamples * numberChannels];
+	
+	LoadDItemStringNumber (kClusterStrID,
+									IDS_Cluster18, // "Determining Initial Clusters"
+									gStatusDialogPtr, 
+									IDC_Status11, 
+									(Str255*)&gTextString);
+	
+	gNextTime = TickCount ();
+	
+			// Loop by number of cluster areas to collect the sample.				
+	
+	for (areaNumber=1; areaNumber<=totalNumberAreas; areaNumber++)
+		{
+		if (!GetNextClusterArea (gProjectInfoPtr, 
+											channelsPtr,
+											numberChannels, 
+											areaNumber, 
+											&gNextMinutesLeftTime, 
+											&lastClassIndex, 
+											&lastFieldIndex, 
+											NULL))
+			{
+			continueFlag = FALSE;
+			break;
+			
+			}	// end "if (!GetNextClusterArea (..."
+		
+		lineStart = gAreaDescription.lineStart;
+		lineEnd = gAreaDescription.lineEnd;
+		columnStart = gAreaDescription.columnStart;
+		columnEnd = gAreaDescription.columnEnd;
+		columnWidth = columnEnd - columnStart + 1;
+		polygonFieldFlag = gAreaDescription.polygonFieldFlag;
+		rgnHandle = gAreaDescription.rgnHandle;
+		firstColumn = columnStart;
+		
+		errCode = SetUpFileIOInstructions (fileIOInstructionsPtr,
+														&gAreaDescription,
+														numberChannels,
+														channelsPtr,
+														kDetermineSpecialBILFlag);
+		
+		if (lineEnd == 0)
+			lineStart = 1;
+		
+		for (line=lineStart; line<=lineEnd; line+=lineInterval)
+			{
+			if (TickCount () >= gNextTime)
+				{
+				if (!CheckSomeEvents (osMask+keyDownMask+updateMask+mDownMask+mUpMask))
+					{
+					continueFlag = FALSE;
+					break;
+					
+					}	// end "if (!CheckSomeEvents (..."
+					
+				}	// end "if (TickCount () >= gNextTime)"
+			
+			point.v = (SInt16)line;
+			
+			errCode = GetLineOfData (fileIOInstructionsPtr,
+												line, 
+												firstColumn,
+												columnEnd,
+												columnInterval,
+												gInputBufferPtr,
+												(HUCharPtr)outputBufferPtr);
+			
+			if (errCode < noErr)
+				{
+				continueFlag = FALSE;
+				break;
+				
+				}	// end "if (errCode < noErr)"
+			
+			if (errCode != kSkipLine)
+				{
+				currentPixel = outputBufferPtr;
+				column = firstColumn;
+				
+				if (gAreaDescription.pointType == kMaskType)
+					numberSamples = fileIOInstructionsPtr->numberOutputBufferSamples;
+					
+				else	// pointType != kMaskType
+					numberSamples =
+								(columnEnd - firstColumn + columnInterval)/columnInterval;
+				
+				for (sample=1; sample<=numberSamples; sample++)
+					{
+					point.h = (SInt16)column;
+					
+					if (!polygonFieldFlag || PtInRgn (point, rgnHandle))
+						{
+						if (pixelCount % sampleInterval == 0 &&
+													numberSeedSamples < kMaxNumberSeedSamples)
+							{
+							index = numberSeedSamples * numberChannels;
+							for (channel=0; channel<numberChannels; channel++)
+								samplePtr[index+channel] = (double)currentPixel[channel];
+							
+							numberSeedSamples++;
+							
+							}	// end "if (pixelCount % sampleInterval == 0 && ..."
+						
+						pixelCount++;
+						
+						}	// end "if (!polygonFieldFlag || PtInRgn (point, rgnHandle))"
+					
+					currentPixel += numberChannels;
+					column += columnInterval;
+					
+					}	// end "for (sample=1; sample<=numberSamples; sample++)"
+				
+				if (gAreaDescription.pointType != kMaskType)
+					{
+					firstColumn = columnStart + column - columnEnd - 1;
+					if (firstColumn > columnEnd)
+						{
+						lDivideStruct = ldiv (firstColumn-columnStart, columnWidth);
+						firstColumn = columnStart + lDivideStruct.rem;
+						
+						}	// end "if (firstColumn > columnEnd)"
+					
+					}	// end "if (gAreaDescription.pointType != kMaskType)"
+				
+				}	// end "if (errCode != kSkipLine)"
+			
+			}	// end "for (line=lineStart; line<=lineEnd; line+=lineInterval)"
+		
+		CloseUpFileIOInstructions (fileIOInstructionsPtr, &gAreaDescription);
+		
+		CloseUpAreaDescription (&gAreaDescription);
+		
+		if (!continueFlag)
+			break;
+		
+		}	// end "for (areaNumber=1; areaNumber<=totalNumberAreas; ..."
+	
+	if (numberSeedSamples == 0)
+		continueFlag = FALSE;
+	
+	if (continueFlag)
+		{
+				// Use a fixed seed so that repeated runs with the same settings
+				// start from the same centers.
+		
+		srand (1);
+		
+		centerIndex = numberSeedSamples / 2;
+		currentCluster = gClusterSpecsPtr->clusterEigenCenterHead;
+		for (cluster=1; cluster<=numberClusters; cluster++)
+			{
+			index = centerIndex * numberChannels;
+			for (channel=0; channel<numberChannels; channel++)
+				currentCluster->meanPtr[channel] = 
+													(CMeanType)samplePtr[index+channel];
+			
+					// Update the squared distance from each sample to its nearest
+					// center and get the total for the sampling of the next center.
+			
+			totalDistance = 0;
+			for (sample=0; sample<numberSeedSamples; sample++)
+				{
+				Distance (currentCluster, 
+								&samplePtr[sample*numberChannels], 
+								currentDistance);
+				
+				if (cluster == 1 || currentDistance < distancePtr[sample])
+					distancePtr[sample] = currentDistance;
+				
+				totalDistance += distancePtr[sample];
+				
+				}	// end "for (sample=0; sample<numberSeedSamples; sample++)"
+			
+			if (totalDistance > 0)
+				{
+				randomValue = ((double)rand () * ((double)RAND_MAX + 1) + rand ()) /
+									(((double)RAND_MAX + 1) * ((double)RAND_MAX + 1));
+				targetDistance = randomValue * totalDistance;
+				
+				centerIndex = numberSeedSamples - 1;
+				for (sample=0; sample<numberSeedSamples; sample++)
+					{
+					targetDistance -= distancePtr[sample];
+					if (targetDistance < 0 && distancePtr[sample] > 0)
+						{
+						centerIndex = sample;
+						break;
+						
+						}	// end "if (targetDistance < 0 && ..."
+					
+					}	// end "for (sample=0; sample<numberSeedSamples; sample++)"
+				
+				}	// end "if (totalDistance > 0)"
+			
+			else	// totalDistance == 0
+						// All samples are already at a center; spread the rest 
+						// through the sample.
+				centerIndex = (UInt32)(((SInt64)cluster * numberSeedSamples) / 
+																				numberClusters);
+			
+			centerIndex = MIN (centerIndex, numberSeedSamples - 1);
+			currentCluster = currentCluster->next;
+			
+			}	// end "for (cluster=1; cluster<=numberClusters; cluster++)"
+		
+		}	// end "if (continueFlag)"
+	
+	samplePtr = CheckAndDisposePtr (samplePtr);
+	
+	return (continueFlag);
+
+}	// end "GetSampleSeededClusterCenters"
+
+
+
 //------------------------------------------------------------------------------------
 //                   Copyright 1988-2020 Purdue Research Foundation
 //
@@ -1246,7 +1655,7 @@ ClusterType* GetMemoryForClusters (
 // Called By:
 //
 //	Coded By:			Larry L. Biehl			Date: 08/07/1990
-//	Revised By:			Larry L. Biehl			Date: 11/16/1999	
+//	Revised By:			agent						Date: 10/18/2026
 
 Boolean InitializeClusterCenters (
 				FileIOInstructionsPtr			fileIOInstructionsPtr)
@@ -1268,6 +1677,7 @@ Boolean InitializeClusterCenters (
 		{
 		case 1:		// Along principal eigenvector
 		case 2:		// Within eigenvector volume 
+		case 4:		// Seeded from a pixel sample
 	
 					// Get memory for the stats for the number of cluster 		
 					// classes that have been requested.	
@@ -1297,7 +1707,11 @@ Boolean InitializeClusterCenters (
 	     			
 	     		}	// end "if (gClusterSpecsPtr->projectClassMeansCode == 1)"
 		
-			continueFlag = GetEigenvectorClusterCenters (fileIOInstructionsPtr);
+			if (gClusterSpecsPtr->initializationOption == 4)
+				continueFlag = GetSampleSeededClusterCenters (fileIOInstructionsPtr);
+				
+			else	// initializationOption != 4
+				continueFlag = GetEigenvectorClusterCenters (fileIOInstructionsPtr);
 			break;
 		
 		case 3:		// One pass cluster centers 
@@ -1339,7 +1753,7 @@ Boolean InitializeClusterCenters (
 // Called By:
 //
 //	Coded By:			Larry L. Biehl			Date: 08/06/1990
-//	Revised By:			Larry L. Biehl			Date: 02/22/2020
+//	Revised By:			agent						Date: 10/18/2026
 
 SInt16 ISODATACluster (
 				FileIOInstructionsPtr			fileIOInstructionsPtr)
@@ -1361,6 +1775,8 @@ SInt16 ISODATACluster (
 	SInt64								changeThreshold,
 											numberChanges;
    		
+	time_t								startTime;
+   		
 	ClusterType							*currentCluster;	// Cluster currently working on.	
 									
    CMFileStream*						clResultsFileStreamPtr;
@@ -1391,6 +1807,7 @@ SInt16 ISODATACluster (
 	minimumClusterSize = gClusterSpecsPtr->minClusterSize;
 	passNumber = 0;
 	returnCode = 1;
+	startTime = time (NULL);
 	
 	activeImageWindowInfoHandle = FindProjectBaseImageWindowInfoHandle ();
 	
@@ -1558,8 +1975,10 @@ SInt16 ISODATACluster (
 												gClusterSpecsPtr->totalNumberClusterPixels);				
 			 
 	sprintf ((char*)gTextString,
-		"    Clustering completed after %d passes and %s of %s pixels changed.%s",
+		"    Clustering completed after %d passes (%u seconds) and %s of %s pixels"
+		" changed.%s",
 			passNumber, 
+			(unsigned int)GetTotalTime (startTime),
 			numberChangesString, 
 			totalNumberClusterPixelsString,
 			gEndOfLine);
@@ -1634,7 +2053,7 @@ SInt16 ISODATACluster (
 // Called By:
 //
 //	Coded By:			Larry L. Biehl			Date: 08/06/1990
-//	Revised By:			Larry L. Biehl			Date: 10/26/1999	
+//	Revised By:			agent						Date: 10/18/2026
 
 Boolean ISODATAClusterControl (
 				FileInfoPtr							fileInfoPtr)
@@ -1649,6 +2068,8 @@ Boolean ISODATAClusterControl (
 								      
 	HUCharPtr							classifyBufferPtr;
 	
+	time_t								startTime;
+	
 	Boolean								continueFlag;
 	
    
@@ -1674,7 +2095,22 @@ Boolean ISODATAClusterControl (
 		{			
 				// Initialize the cluster centers according to the request.			
 				
+		startTime = time (NULL);
 		continueFlag = InitializeClusterCenters (fileIOInstructionsPtr);
+		
+				// List the time taken to find the initial centers so that the
+				// initialization options can be compared.
+		
+		sprintf ((char*)gTextString,
+					"    Initial cluster centers determined in %u seconds.%s",
+					(unsigned int)GetTotalTime (startTime),
+					gEndOfLine);
+		
+		continueFlag = OutputString (resultsFileStreamPtr, 
+												(char*)gTextString, 
+												0, 
+												gOutputForce1Code, 
+												continueFlag);
 
    			// List initial cluster statistics. 										
    	
@@ -2396,7 +2832,7 @@ Boolean ISODATAClusterDialog (
 // Called By:			ClusterDialog   in SCluster.cpp
 //
 //	Coded By:			Larry L. Biehl			Date: 03/23/1999
-//	Revised By:			Larry L. Biehl			Date: 02/28/2020
+//	Revised By:			agent						Date: 10/18/2026
 
 void ISODATAClusterDialogInitialize (
 				DialogPtr							dialogPtr,
@@ -2448,6 +2884,12 @@ void ISODATAClusterDialogInitialize (
 	*useCorrelationMatrixFlagPtr = gClusterSpecsPtr->useCorrelationMatrixFlag;
 	
 	#if defined multispec_mac 
+				// The Mac dialog does not have a control for the pixel sample
+				// seeds option.
+				
+		if (*initializationOptionPtr == 4)
+			*initializationOptionPtr = 2;
+		
 		HideDialogItem (dialogPtr, 7);
 		if (*initializationOptionPtr == 3)
 			SetDLogControlHilite (dialogPtr, 7, 255);
@@ -2910,7 +3352,7 @@ void ISODATAClusterDialogOnTrainingAreas (
 // Called By:
 //
 //	Coded By:			Larry L. Biehl			Date: 08/06/1990
-//	Revised By:			Larry L. Biehl			Date: 05/12/2020
+//	Revised By:			agent						Date: 10/18/2026
 
 SInt16 ISODATAClusterPass (
 				FileIOInstructionsPtr			fileIOInstructionsPtr,
@@ -2944,6 +3386,9 @@ SInt16 ISODATAClusterPass (
 																	//	pixel.
    			  							outputBufferPtr;	// ptr to all pixels.
    			  					
+	HDoublePtr							clusterMaximumPtr,
+											clusterMinimumPtr;
+   			  					
 	HUInt16Ptr							dataClassPtr,
 											savedDataClassPtr;
 											
@@ -2983,6 +3428,7 @@ SInt16 ISODATAClusterPass (
 											skipCount;
 	
    SInt16								areaNumber,
+											channel,
 											errCode,
 											fieldNumber,
 											lastClassIndex,
@@ -3055,6 +3501,28 @@ SInt16 ISODATAClusterPass (
 	double magnification = lcToWindowUnitsVariablesPtr->magnification;
 	nextStatusAtLeastLineIncrement = (int)((10 * lineInterval) / magnification);
 	nextStatusAtLeastLineIncrement = MAX (nextStatusAtLeastLineIncrement, 10);
+	
+			// The channel minimums and maximums cannot be backed out when a pixel
+			// changes clusters; start them over for each pass so that they
+			// describe the assignments made in the last pass.
+	
+	if (clusterHead->minimumPtr != NULL)
+		{
+		currentCluster = clusterHead;
+		while (currentCluster != NULL)
+			{
+			for (channel=0; channel<numberChannels; channel++)
+				{
+				currentCluster->minimumPtr[channel] = DBL_MAX;
+				currentCluster->maximumPtr[channel] = -DBL_MAX;
+				
+				}	// end "for (channel=0; channel<numberChannels; channel++)"
+				
+			currentCluster = currentCluster->next;
+			
+			}	// end "while (currentCluster != NULL)"
+			
+		}	// end "if (clusterHead->minimumPtr != NULL)"
 		
 			// Loop by number of cluster areas.												
 			
@@ -3275,6 +3743,21 @@ SInt16 ISODATAClusterPass (
 					      
 				         }	// end "if (*dataClassPtr != ..." 
 				         
+				     	if (closestCluster->minimumPtr != NULL)
+				     		{
+				     		clusterMinimumPtr = closestCluster->minimumPtr;
+				     		clusterMaximumPtr = closestCluster->maximumPtr;
+				     		for (channel=0; channel<numberChannels; channel++)
+				     			{
+				     			clusterMinimumPtr[channel] = 
+				     						MIN (clusterMinimumPtr[channel], currentPixel[channel]);
+				     			clusterMaximumPtr[channel] = 
+				     						MAX (clusterMaximumPtr[channel], currentPixel[channel]);
+				     			
+				     			}	// end "for (channel=0; channel<numberChannels; ..."
+				     			
+				     		}	// end "if (closestCluster->minimumPtr != NULL)"
+				         
 				         	// Ready for next pixel.											
 				         	
 						dataClassPtr++;
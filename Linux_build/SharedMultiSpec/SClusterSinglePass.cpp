@@ -114,6 +114,8 @@
 	clusterSumSquarePtr = gClusterHead->sumSquarePtr1 = 								\
 											&gClusterHead->variancePtr[numberChannels];	\
 	gClusterHead->sumSquarePtr2 = NULL;														\
+	gClusterHead->minimumPtr = NULL;															\
+	gClusterHead->maximumPtr = NULL;															\
 	pixPtr1 = pix;																					\
 	for (channelTemp = 0; channelTemp < numberChannels; channelTemp++)			\
 		{																								\
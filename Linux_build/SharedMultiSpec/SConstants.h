@@ -651,6 +651,7 @@
 #define	kNITFType							42
 #define	kPCIDSKType							43
 #define	kSRTMHGTType						44
+#define	kMultiSpecStackType				45
 
 #define	kArcViewDefaultSupportType		1024
 
@@ -972,6 +973,10 @@
 #define	kCEMMode								9
 #define	kParallelPipedMode				10
 
+		// Interval between the pixels that are also classified with double precision
+		// when the single precision maximum likelihood computation is used.
+#define	kFloat32CheckInterval			64
+
 		// Support Vector Machine Classifier Constants.
 #define	kC_SVC_Type						0
 #define	kNU_SVC_Type					1
@@ -1007,6 +1012,9 @@
 #define	kSinglePass						1
 #define	kISODATA							2
 
+		//		Maximum number of pixels sampled to seed the ISODATA cluster centers
+#define	kMaxNumberSeedSamples		20000
+
 		// Display Processor Constants 
 		
 		//   Display min-max enhancement codes.											
@@ -1897,6 +1905,41 @@
 #define	kThermalWavelengths					6
 #define	kThermalBandWidths					7
 
+		// Spectral profile cache for selection graphs. Each cache block holds
+		// the BIS real8 data for a run of columns within one line.
+#define	kProfileCacheBlockColumns			128
+#define	kProfileCacheNumberBlocks			16
+
+		// Block row cache for blocked (tiled) image files. The byte budget is
+		// shared by all of the channel layers in a file.
+#define	kBlockRowCacheNumberSlots			8
+#define	kBlockRowCacheBytes					33554432
+
+		// Shared line cache for files that are not blocked. Lines larger than
+		// kLineCacheEntryBytesLimit are not cached.
+#define	kLineCacheEntryBytesLimit			65536
+#define	kLineCacheNumberEntries				512
+#define	kLineCacheNumberFiles				8
+
+		// Number of hash buckets for the shared line cache entries. It needs to
+		// be 2 to the kLineCacheHashBits power.
+#define	kLineCacheHashBits					10
+#define	kLineCacheHashSize					1024
+
+		// Read-ahead buffer for sequential full scene passes through files that
+		// are not blocked.
+#define	kSequentialReadBufferBytes			4194304
+
+		// Memory shared by the line blocks for each channel being read from a
+		// band sequential file.
+#define	kChannelLineBlockBytes				16777216
+
+		// Gzip compressed image files. A checkpoint is saved about every
+		// kGzipCheckpointSpan uncompressed bytes.
+#define	kGzipCheckpointSpan					4194304
+#define	kGzipInputBufferBytes				65536
+#define	kGzipWindowBytes						32768
+
 		// Macros 
 #define	MAX(a, b) (a > b ? a : b) 
 #define	MIN(a, b) (a < b ? a : b)
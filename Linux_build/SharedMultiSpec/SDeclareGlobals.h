@@ -1215,6 +1215,10 @@ SInt32							gSelectionOutputBufOffset = 0;
 		// Units are in ticks or 1/60's of a second.					
 SInt32							gTimeOffset = kFrontTimeOffset;   
 
+		// Incremented each time the project fields change so that the field
+		// outlines cached for the image windows are converted again.
+UInt32							gFieldOutlineGeneration = 1;
+
 		// Maximum number of channels combinations to be considered in				
 		// the Separability processor.														
 UInt32							gMaxNumberChannelCombinations = UInt32_MAX;
@@ -145,6 +145,7 @@ typedef struct HistogramSpecs HistogramSpecs, *HistogramSpecsPtr;
 typedef struct HistogramSummary HistogramSummary, *HistogramSummaryPtr;
 typedef struct LayerInfo LayerInfo, *LayerInfoPtr; 
 typedef struct MaskInfo MaskInfo, *MaskInfoPtr; 
+typedef struct MaskRun MaskRun, *MaskRunPtr; 
 typedef struct	PlanarCoordinateSystemInfo	PlanarCoordinateSystemInfo, *PlanarCoordinateSystemInfoPtr;  
 typedef struct ProjectClassNames ProjectClassNames, *PClassNamesPtr;
 typedef struct ProjectFieldIdentifiers ProjectFieldIdentifiers, *PFieldIdentifiersPtr;
@@ -1503,6 +1504,11 @@ typedef struct BiPlotDataSpecs
 	
 	SInt16*					classPtr;
 	
+			// Open addressing hash table of indices into the graph x and y vectors.
+			// It is used to check for duplicate points within a class while the
+			// data values are being loaded.
+	HSInt32Ptr				pointHashTablePtr;
+	
 	UCharPtr					symbolsPtr;
 	
 	SInt32					lineStart;
@@ -1513,6 +1519,9 @@ typedef struct BiPlotDataSpecs
 	SInt32					columnInterval;
 	UInt32					numberClasses;
 	
+			// Mask for the point hash table index. The table size is a power of 2.
+	UInt32					pointHashTableMask;
+	
 	SInt16					fileInfoVersion;
 	SInt16					classSet;
 	SInt16					displayPixelCode;
@@ -1593,6 +1602,19 @@ typedef struct ChannelDescription
 	} ChannelDescription, *ChannelDescriptionPtr;
 	
 	
+		// Block of consecutive lines for one channel of a band sequential file.
+		
+typedef struct ChannelLineBlock
+	{
+	SInt64					posOff;
+	FileInfoPtr				fileInfoPtr;
+	UInt32					count;
+	UInt32					lastUse;
+	SInt16					channelNumber;
+	
+	} ChannelLineBlock, *ChannelLineBlockPtr;
+	
+	
 typedef struct ChannelStatistics
 	{
 	double				mean;
@@ -1718,6 +1740,13 @@ typedef struct ClassifySpecs
 	
 	Boolean					supportVectorMachineModelAvailableFlag;
 	
+			// TRUE if the image area is also to be classified for the other open
+			// image windows that are compatible with the target image.
+	Boolean					batchTargetsFlag;
+	
+			// TRUE if the maximum likelihood discriminant is to be computed with
+			// single precision (float) class means and inverse covariances.
+	Boolean					float32ComputeFlag;
 	Boolean					imageAreaFlag;
 	Boolean					testFldsFlag;
 	Boolean					thresholdFlag;
@@ -1744,6 +1773,12 @@ typedef struct ClassifierVar
 	HDoublePtr			covariancePtr;
 	HDoublePtr			workVectorPtr;
 	HDoublePtr			workVector2Ptr;
+	
+			// Single precision copies of the class means and inverse covariances
+			// and the work vector used for them in the maximum likelihood classifier.
+	float*				chanMeanFloatPtr;
+	float*				covarianceFloatPtr;
+	float*				workVectorFloatPtr;
 	HUInt16Ptr			symbolToClassPtr;
 	HSInt64Ptr			countVectorPtr;
 	HSInt32Ptr			countClassIndexPtr;
@@ -1751,6 +1786,11 @@ typedef struct ClassifierVar
 	SInt64				totalCorrectSamples;
 	SInt64				totalNumberSamples;
 	SInt64				totalSameDistanceSamples;
+	
+			// Number of pixels checked against the double precision computation and
+			// the number of those that were assigned to a different class.
+	SInt64				float32CheckSamples;
+	SInt64				float32DifferentSamples;
 	UInt32				numberKappaColumns;
 	UInt32				tableWidth;
 	UInt32				totalCountIndexStart;
@@ -1765,6 +1805,7 @@ typedef struct ClassifierVar
 	SInt16				tableType;
 	SInt16				unitsCode;
 	SInt16				summaryUnitsCode;
+	Boolean				previewFlag;
 	Boolean				thresholdFlag;
 	Boolean				useLeaveOneOutMethodFlag;
 	
@@ -1888,6 +1929,7 @@ typedef struct ClusterSpecs
 			//		=1, Along first eigenvectors.
 			//		=2, Within eigenvector volume.
 			//		=3, One pass cluster
+			//		=4, k-means++ seeds from a pixel sample
 	SInt16							initializationOption;
 	
 			// Variable to indicate where cluster output is to be placed.			
@@ -1935,6 +1977,10 @@ typedef struct ClusterType
    														// channel squares.					
    HDoublePtr				sumSquarePtr2; 		// Pointer to start of sum of		
    														// covariance squares.				
+   HDoublePtr				minimumPtr;				// Pointer to start of channel
+   														// minimums for the last pass.
+   HDoublePtr				maximumPtr;				// Pointer to start of channel
+   														// maximums for the last pass.
 	SInt16					clusterNumber;			// Cluster class identifier.
 	SInt16					projectStatClassNumber;	// Index to project class info in needed.		
    Boolean					varianceComputed;		// Flag indicating whether			
@@ -2896,6 +2942,10 @@ typedef struct MFileInfo
 	Boolean							descriptionsFlag;
 	Boolean							treatLinesAsBottomToTopFlag;
 	Boolean							groupChangedFlag;
+
+			// This flag indicates that the header information was read from an ENVI
+			// header file that MultiSpec wrote next to the image file.
+	Boolean							multiSpecHeaderFileFlag;
 	Boolean							nonContiguousStripsFlag;
 	Boolean							noDataValueFlag;
 	Boolean							signedDataFlag;
@@ -2919,6 +2969,23 @@ typedef struct FileIOBuffer
 	} FileIOBuffer, *FileIOBufferPtr;
 	
 
+		// This structure links a file stream used by a set of file IO
+		// instructions to its file in the shared line cache so that GetLine does
+		// not need to compare the file paths for each line.
+	
+typedef struct LineCacheStream
+	{
+	CMFileStream*						fileStreamPtr;
+	
+			// Serial number of the line cache file when the link was made. The link
+			// is not valid if the file has been dropped from the cache since then.
+	UInt32								fileSerialNumber;
+	
+	SInt16								fileIndex;
+	
+	} LineCacheStream, *LineCacheStreamPtr;
+	
+
 typedef struct FileIOInstructions
 	{
 	ThreadID								asyncIOThread;
@@ -2981,10 +3048,46 @@ typedef struct FileIOInstructions
 			// Mask Information.
 			
 	HUInt16Ptr							maskBufferPtr;
+	HUInt16Ptr							maskBufferStartPtr;
+	HUInt32Ptr							maskLineRunIndexPtr;
+	MaskRunPtr							maskRunPtr;
 	UInt32								maskColumnStart;
 	UInt32								maskValueRequest;
+	UInt32								numberMaskBufferColumns;
 	UInt32								numberMaskColumnsPerLine;
 	
+			// Read-ahead buffer for sequential passes through the image file.
+			// It is only allocated for processors which request it.
+			
+	HUCharPtr							sequentialBufferPtr;
+	FileInfoPtr							sequentialFileInfoPtr;
+	SInt64								sequentialBufferPosOff;
+	SInt64								sequentialLastEnd;
+	UInt32								sequentialBufferBytes;
+	UInt32								sequentialBytesInBuffer;
+	UInt32								sequentialRequestCount;
+	
+			// Line blocks for each channel being read from band sequential files.
+			
+	ChannelLineBlockPtr				channelLineBlockPtr;
+	HUCharPtr							channelLineBlockBufferPtr;
+	UInt32								channelLineBlockBytes;
+	UInt32								channelLineBlockUseCount;
+	UInt32								numberChannelLineBlocks;
+	
+			// Links to the files in the shared line cache for the file streams
+			// being read.
+			
+	LineCacheStream					lineCacheStreams[kLineCacheNumberFiles];
+	UInt32								numberLineCacheStreams;
+	
+			// Flag indicating that lines read from the file are to be added to the
+			// shared line cache as the next ones to be replaced. It is set for
+			// processors that make a sequential pass through the whole image so
+			// that they do not push out the lines that the windows are using.
+			
+	Boolean								lineCacheLowPriorityFlag;
+	
 	} FileIOInstructions, *FileIOInstructionsPtr;
 	
 	
@@ -3106,6 +3209,43 @@ typedef struct GridCoordinateSystemInfo
 	
 	} GridCoordinateSystemInfo, *GridCoordinateSystemInfoPtr;
 	
+	
+		// Access point into a gzip compressed image file. Raw inflation can 
+		// start at inOffset in the compressed file (less 1 byte if bits is not
+		// 0) to produce the uncompressed data starting at outOffset.
+		
+typedef struct GzipCheckpoint
+	{
+	SInt64								inOffset;
+	SInt64								outOffset;
+	SInt32								bits;
+	
+	} GzipCheckpoint, *GzipCheckpointPtr;
+	
+	
+		// Index and inflation state for reading a gzip compressed image file
+		// as if it were not compressed. The 32K dictionary window for each 
+		// checkpoint is stored in windowsPtr.
+		
+typedef struct GzipIndex
+	{
+	SInt64								compressedSize;
+	SInt64								markerOffset;
+	SInt64								streamOutOffset;
+	SInt64								uncompressedSize;
+	
+	GzipCheckpointPtr					checkpointPtr;
+	HUCharPtr							inputBufferPtr;
+	HUCharPtr							skipBufferPtr;
+	HUCharPtr							windowsPtr;
+	void*									streamPtr;
+	
+	UInt32								numberCheckpoints;
+	
+	Boolean								rawStreamFlag;
+	
+	} GzipIndex, *GzipIndexPtr;
+	
 
 typedef struct HdfDataSets 
 	{
@@ -3154,6 +3294,17 @@ typedef struct HierarchalFileFormat
 	UInt32							lastColumnRead;
 	UInt32							numberBlocksRead;
 	
+			// Block rows read from disk during the current set of file IO
+			// instructions. A slot is empty if its count is 0. The least
+			// recently used slot is replaced when all slots are in use.
+			
+	HUCharPtr						blockRowCachePtrs[kBlockRowCacheNumberSlots];
+	SInt64							blockRowCachePosOff[kBlockRowCacheNumberSlots];
+	UInt32							blockRowCacheBytes[kBlockRowCacheNumberSlots];
+	UInt32							blockRowCacheCount[kBlockRowCacheNumberSlots];
+	UInt32							blockRowCacheLastUse[kBlockRowCacheNumberSlots];
+	UInt32							blockRowCacheUseCount;
+	
 	} HierarchalFileFormat, *HierarchalFileFormatPtr;
 		
 		
@@ -3580,6 +3731,116 @@ typedef struct LCToWindowUnitsVariables
 	} LCToWindowUnitsVariables, *LCToWindowUnitsVariablesPtr;
 	
 	
+		// This structure holds the polygon field outlines and label points for
+		// an image window in window units. The points do not include the channel
+		// window offset for side by side displays.
+	
+typedef struct FieldOutlineCache
+	{
+			// Variables the label points and the outline points were last
+			// converted with. They are different in the wx version.
+	LCToWindowUnitsVariables		labelVariables;
+	LCToWindowUnitsVariables		pointsVariables;
+	
+	LongPoint*							labelPointsPtr;
+	LongPoint*							pointsPtr;
+	
+			// Flags indicating whether the label point and the outline points
+			// for each field are valid.
+	Boolean*								labelValidPtr;
+	Boolean*								pointsValidPtr;
+	
+			// Value of gFieldOutlineGeneration when the cache was last used. The
+			// fields have been edited since then if it is different.
+	UInt32								fieldsGeneration;
+	
+	SInt16								numberStorageFields;
+	SInt16								numberStoragePoints;
+	
+	} FieldOutlineCache, *FieldOutlineCachePtr;
+	
+	
+		// This structure defines one file for the shared line cache. The file
+		// is identified by its full path so that windows and processors that
+		// have their own file stream for the same file can share lines.
+	
+typedef struct LineCacheFile
+	{
+	#if defined multispec_mac
+		FSRef								fsRef;
+	#endif	// defined multispec_mac
+	
+	#if defined multispec_win || defined multispec_wx
+		char								filePath[_MAX_PATH];
+	#endif	// defined multispec_win || defined multispec_wx
+	
+	UInt32								lastUse;
+	
+			// Serial number assigned when the file is added to the cache.
+	UInt32								serialNumber;
+	
+	Boolean								inUseFlag;
+	
+	} LineCacheFile, *LineCacheFilePtr;
+	
+	
+		// This structure defines one entry in the shared line cache. It holds
+		// the bytes read from the file at the given position. The entries are
+		// found through hash buckets keyed on the file and position and are
+		// kept in a least recently used list.
+	
+typedef struct LineCacheEntry
+	{
+	SInt64								posOff;
+	
+	HUCharPtr							dataPtr;
+	
+			// Number of bytes of data in the entry. 0 indicates that the entry
+			// is empty.
+	UInt32								count;
+	
+			// Number of bytes allocated for dataPtr.
+	UInt32								bufferBytes;
+	
+	SInt16								fileIndex;
+	
+			// Index of the next entry in the same hash bucket. -1 indicates the
+			// end of the chain.
+	SInt16								hashNext;
+	
+			// Indices of the next less recently used and the next more recently
+			// used entries. -1 indicates the end of the list.
+	SInt16								lruNext;
+	SInt16								lruPrevious;
+	
+	} LineCacheEntry, *LineCacheEntryPtr;
+	
+	
+		// This structure defines the shared line cache used by GetLine for
+		// files that are not blocked.
+	
+typedef struct LineCache
+	{
+	LineCacheEntry						entries[kLineCacheNumberEntries];
+	LineCacheFile						files[kLineCacheNumberFiles];
+	
+			// First entry in each hash bucket. -1 indicates an empty bucket.
+	SInt16								hashBuckets[kLineCacheHashSize];
+	
+	UInt32								nextSerialNumber;
+	UInt32								numberFilesInUse;
+	UInt32								useCount;
+	
+			// Most and least recently used entries. Empty entries are kept at
+			// the least recently used end so that they are used first.
+	SInt16								lruFirst;
+	SInt16								lruLast;
+	
+	Boolean								initializedFlag;
+	
+	} LineCache, *LineCachePtr;
+	
+	
 typedef struct ListDataSpecs
 	{
 			// Pointer to the list of pointers to the channels to be listed. 		
@@ -3799,15 +4060,36 @@ typedef struct MaskInfo
 	Handle							maskHandle;
 	Handle							maskValueToFieldHandle;
 	
+			// Run length index of the mask. maskRunHandle contains the runs of
+			// nonzero mask values for all lines in column order and
+			// maskLineRunIndexHandle contains the index to the first run for each
+			// line (numberLines+1 entries). These are NULL if the index was not
+			// built; the full mask buffer is always available.
+	Handle							maskLineRunIndexHandle;
+	Handle							maskRunHandle;
+	
 	UInt32							fileLayer;
 	UInt32							maxMaskValue;
 	UInt32							numberColumns;
 	UInt32							numberLines;
 	UInt32							numberLayers;
+	UInt32							numberMaskRuns;
 	UInt32							startColumn;
 	UInt32							startLine;
 	
 	} MaskInfo, *MaskInfoPtr;
+
+
+typedef struct MaskRun
+	{
+			// First and last column of the run relative to the start of the mask
+			// buffer line. Column 0 of the buffer line is the line flag.
+	UInt32							startColumn;
+	UInt32							endColumn;
+	
+	UInt32							maskValue;
+	
+	} MaskRun, *MaskRunPtr;
 	
 
 typedef struct NonProjProcessorSpecs
@@ -4019,12 +4301,28 @@ typedef struct ProjectInfo
 	struct svm_model*				svmModel;
 	struct svm_node*				svm_x;
 
-				// used in KNN classify training
+				// Training pixel matrix used by the KNN and SVM classifiers. It is
+				// also used for the class data values for feature extraction and
+				// leave-one-out statistics when loaded.
 
 	knnType*							knnDistancesPtr;
 	UInt16*							knnLabelsPtr;
 	double*							knnDataValuesPtr;
 	int 								knnCounter;
+	
+				// Hashed indexes of the class storage numbers and field numbers by
+				// name. They are used to check for duplicate names and are rebuilt
+				// when the numbers of classes or fields differ from those they
+				// were built for.
+	
+	SInt16*							classNameIndexPtr;
+	SInt16*							fieldNameIndexPtr;
+	UInt32							classNameIndexSize;
+	UInt32							fieldNameIndexSize;
+	SInt16							nameIndexStatisticsClasses;
+	SInt16							nameIndexStatisticsFields;
+	SInt16							nameIndexStorageClasses;
+	SInt16							nameIndexStorageFields;
 
 	UInt8								imageFileName[256];
 	
@@ -4519,9 +4817,30 @@ typedef struct SelectionIOInfo
 			// Handle to graphics record.
 																	
 	Handle				ioBufferHandle;
+	
+			// Handle to the spectral profile cache. It contains 
+			// kProfileCacheNumberBlocks blocks of kProfileCacheBlockColumns
+			// columns for all channels in BIS real8 format.
+			
+	Handle				profileCacheHandle;
 	Handle				sumSquaresHandle;
+	
+			// Image window that the data in the profile cache represent.
+			
+	WindowPtr			profileCacheWindow;
 	SInt32				bufferSize;
+	
+			// The line and column block for the data in each profile cache slot.
+			// A line value of -1 indicates that the slot is empty.
+			
+	SInt32				profileCacheColumnBlock[kProfileCacheNumberBlocks];
+	SInt32				profileCacheLine[kProfileCacheNumberBlocks];
+	
 	SInt32				outputBufferOffset;
+	
+			// Slot in the profile cache to be used for the next block read.
+			
+	SInt16				profileCacheNextSlot;
 
 			// Flag indicating when the memory for the selection graph 				
 			// parameters need to be checked.
@@ -4755,6 +5074,18 @@ typedef struct StatHistogramSpecs
 			// Pointer to the histogram information.										
 	HUInt32Ptr							histogramDataPtr;
 	
+			// Per training field histogram accumulators used when the histograms are
+			// listed with class/field grouping.  Each field is read once for all
+			// features; the columns for the later channel sets are then merged from
+			// these accumulators instead of reading the field again.
+	Ptr									fieldHistogramBufferPtr;
+	HistogramSummaryPtr				fieldHistogramRangePtr;
+	HUInt32Ptr							fieldHistogramDataPtr;
+	UInt32*								fieldHistogramCountPtr;
+	SInt32*								fieldHistogramSlotPtr;
+	SInt32								numberFieldHistogramSlots;
+	SInt32								numberFieldHistogramSlotsUsed;
+	
 			// Used for pointer to vector stored in feature handle.
 	UInt16*								featurePtr;
 	
@@ -5005,6 +5336,9 @@ typedef struct WindowInfo
 			// Pointer to statistics file information for image window. 			
 	CMFileStream*			supportFileStreamPtr;
 	
+			// Pointer to the field outlines in window units for the project.
+	FieldOutlineCachePtr	fieldOutlineCachePtr;
+	
 			// Pointer to mask file information for image window. 			
 	CMFileStream*			maskFileStreamPtr;
 	
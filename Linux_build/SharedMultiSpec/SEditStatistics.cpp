@@ -18,7 +18,7 @@
 //
 //	Authors:					Larry L. Biehl
 //
-//	Revision date:			11/19/2019
+//	Revision date:			10/18/2026
 //
 //	Language:				C
 //
@@ -1077,7 +1077,7 @@ void ClearProjectMaskStatistics (void)
 // Called By:	
 //
 //	Coded By:			Larry L. Biehl			Date:  2/15/1989
-//	Revised By:			Larry L. Biehl			Date: 12/28/1995			
+//	Revised By:			agent						Date: 10/18/2026			
 // TODO: For Linux
 
 void CutClass (
@@ -1104,6 +1104,10 @@ void CutClass (
 		classStorage = gProjectInfoPtr->storageClass[removeClass];
 		classNamesPtr = gProjectInfoPtr->classNamesPtr;
 		
+				// The class name index will be rebuilt the next time it is needed.
+				
+		InvalidateProjectNameIndexes ();
+		
 				// Update the project structure variables.								
 				
 		gProjectInfoPtr->numberStatisticsClasses--;
@@ -1328,7 +1332,7 @@ void CutEmptyClassesFromProject ()
 // Called By:
 //
 //	Coded By:			Larry L. Biehl			Date:  2/21/1989
-//	Revised By:			Larry L. Biehl			Date: 12/08/1993			
+//	Revised By:			agent						Date: 10/18/2026			
 
 void CutField (
 				SInt16								removeField, 
@@ -1351,6 +1355,10 @@ void CutField (
 		classNamesPtr = gProjectInfoPtr->classNamesPtr;
 		fieldType = gProjectInfoPtr->fieldIdentPtr[removeField].fieldType;
 		
+				// The field name index will be rebuilt the next time it is needed.
+				
+		InvalidateProjectNameIndexes ();
+		
 				// Update the field structure variables.									
 		
 		previousFieldNumber = 
@@ -2192,7 +2200,7 @@ void DoStatisticsWUndo (void)
 // Called By:			StatisticsWControlEvent	in SStatistics.cpp
 //
 //	Coded By:			Larry L. Biehl			Date: 02/13/1989
-//	Revised By:			Larry L. Biehl			Date: 05/02/2019
+//	Revised By:			agent						Date: 10/18/2026
 
 Boolean EditClassFieldDialog (
 				SInt16								classFieldFlag, 
@@ -2541,6 +2549,10 @@ Boolean EditClassFieldDialog (
 				ForceFieldOutlineUpdate (TRUE);
 			
 			}	// end "if (classFieldFlag == 3)"
+		
+				// A class or field name may have changed.
+				
+		InvalidateProjectNameIndexes ();
 					
 					      
 				// Indicate that the project has been changed.					
@@ -3098,7 +3110,7 @@ SInt64 GetTotalNumberPixelsInField (
 // Called By:	
 //
 //	Coded By:			Larry L. Biehl			Date:  2/22/1989
-//	Revised By:			Larry L. Biehl			Date: 01/13/1994			
+//	Revised By:			agent						Date: 10/18/2026			
 
 void PasteClassFields (void)
 
@@ -3118,6 +3130,8 @@ void PasteClassFields (void)
 	if (currentStorageClass >= 0 &&
 							currentStorageClass < gProjectInfoPtr->numberStorageClasses)
 		{
+		InvalidateProjectNameIndexes ();
+		
 		pasteClassStorage = gProjectInfoPtr->editClassStorageNumber;
 		addField = gProjectInfoPtr->classNamesPtr[pasteClassStorage].firstFieldNumber;
 		
@@ -3165,7 +3179,7 @@ void PasteClassFields (void)
 // Called By:	
 //
 //	Coded By:			Larry L. Biehl			Date:  2/22/1989
-//	Revised By:			Larry L. Biehl			Date:  3/09/1990			
+//	Revised By:			agent						Date: 10/18/2026			
 
 void PasteField (void)
 
@@ -3194,6 +3208,8 @@ void PasteField (void)
 			gProjectInfoPtr->fieldIdentPtr[addField].classStorage = currentStorageClass;
 			AddField (addField, currentStorageClass);
 			
+			InvalidateProjectNameIndexes ();
+			
 			}	// end "if (currentStorageClass >= 0 && ..."
 		
 		}	// end "if (addField >= 0 && ..."
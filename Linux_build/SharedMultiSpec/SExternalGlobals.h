@@ -1091,6 +1091,10 @@ extern SInt32							gSelectionOutputBufOffset;
 		// Use for determining when to check for command-. for stopping.			
 extern SInt32							gTimeOffset;
 
+		// Incremented each time the project fields change so that the field
+		// outlines cached for the image windows are converted again.
+extern UInt32							gFieldOutlineGeneration;
+
 		// Maximum number of channels combinations to be considered in				
 		// the Separability processor.														
 extern UInt32							gMaxNumberChannelCombinations;
@@ -18,7 +18,7 @@
 //
 //	Authors:					Larry L. Biehl
 //
-//	Revision date:			04/17/2020
+//	Revision date:			10/18/2026
 //
 //	Language:				C
 //
@@ -351,6 +351,10 @@ void AreasToThematicFileControl (void)
 //							class to the respective class number.  The pixels in
 //							the input image file will have been set to a background
 //							value.
+//							The field boundaries are loaded once. The output image is
+//							then filled in memory by bands of lines with all of the
+//							fields that overlap each band and the band is written to the
+//							file with one sequential write.
 //
 //	Parameters in:				
 //
@@ -368,34 +372,45 @@ Boolean ConvertImagePixelsToClassNumbers (
 				ReformatOptionsPtr				reformatOptionsPtr)
 			
 {
-	AreaDescription					areaDescription;
 	SInt64								writePosOff;
 	Point									point;
 	RgnHandle							rgnHandle;
 	
+	AreaDescriptionPtr				areaDescriptionPtr,
+											fieldAreaDescriptionPtr;
 	CMFileStream*						outFileStreamPtr;
-	FileIOInstructionsPtr			fileIOInstructionsPtr;
 	HPClassNamesPtr					classNamesPtr;
 	HPFieldIdentifiersPtr			fieldIdentPtr;
 	
 	HUInt16Ptr							maskBufferPtr,
 											savedMaskBufferPtr;
 											
-	HUCharPtr				 			ioOutBufferPtr;
+	HUCharPtr				 			bandBufferPtr,
+											ioOutBufferPtr;
 											
-	SInt32								columnEnd,
+	SInt32								bandLineEnd,
+											bandLineStart,
+											columnEnd,
 											columnInterval,
 											columnStart,
-											imageColumnEnd,
+											firstWriteLine,
 											imageColumnStart,
 											imageLineNumber,
+											lastWriteLine,
 											lineEnd,
 											lineInterval,
 											lineStart,
+											numberBandLines,
 											numberFieldColumns,
-											numberImageColumns;
+											numberFieldLines,
+											numberImageColumns,
+											numberImageLines,
+											outputLine,
+											outputLineEnd,
+											outputLineStart;
 
-	UInt32								classIndex,
+	UInt32								area,
+											classIndex,
 											count,
 											fieldColumnEnd,
 											fieldColumnStart,
@@ -404,6 +419,7 @@ Boolean ConvertImagePixelsToClassNumbers (
 											line,
 											maskColumnStart,
 											maskRequestValue,
+											numberAreas,
 											numberMaskColumns,
 											sample;
 	
@@ -418,8 +434,7 @@ Boolean ConvertImagePixelsToClassNumbers (
 											statClassNumber;
 											
 	Boolean								continueFlag,
-											includePixelFlag,
-											skipLineFlag;
+											includePixelFlag;
 
 	unsigned char						backgroundValue;
 
@@ -434,6 +449,7 @@ Boolean ConvertImagePixelsToClassNumbers (
 	outFileStreamPtr = GetFileStreamPointer (outFileInfoPtr);													
 							
 	numberImageColumns = outFileInfoPtr->numberColumns;
+	numberImageLines = outFileInfoPtr->numberLines;
 	
 	lineStart = reformatOptionsPtr->lineStart;
 	lineEnd = reformatOptionsPtr->lineEnd;
@@ -448,47 +464,46 @@ Boolean ConvertImagePixelsToClassNumbers (
 	
 	continueFlag = TRUE;
 	errCode = noErr;
+	numberAreas = 0;
+	bandBufferPtr = NULL;
 	
 	classNamesPtr = gProjectInfoPtr->classNamesPtr;
 	
-	InitializeAreaDescription (&areaDescription);
+			// Get the number of fields that may be used to allocate the vector of
+			// area descriptions.
+	
+	numberFields = 0;
+	for (classIndex=0; classIndex<reformatOptionsPtr->numberClasses; classIndex++)
+		{
+		classStorage = gProjectInfoPtr->storageClass[
+													reformatOptionsPtr->classPtr[classIndex] - 1];
+		
+		if (requestedFieldType & kTrainingType) 
+			numberFields += classNamesPtr[classStorage].numberOfTrainFields;
+		
+		if (requestedFieldType & kTestingType) 
+			numberFields += classNamesPtr[classStorage].numberOfTestFields;
+		
+		}	// end "for (classIndex=0; classIndex<..."
+		
+	areaDescriptionPtr = (AreaDescriptionPtr)MNewPointer (
+										(SInt64)MAX (numberFields, 1) * sizeof (AreaDescription));
+	
+	if (areaDescriptionPtr == NULL)
+																						return (FALSE);
 			
 			// Set up status dialog.  Load in number of classes.						
 				
 	LoadDItemValue (gStatusDialogPtr, 
 							IDC_Status5, 
 							(SInt32)reformatOptionsPtr->numberClasses);
-		 
-	SetUpGeneralFileIOInstructions (&gFileIOInstructions[0],
-												NULL,	
-												NULL,
-												outFileInfoPtr,
-												1,
-												NULL,
-												(HUCharPtr)reformatOptionsPtr->ioOutBufferPtr,
-												(HUCharPtr)reformatOptionsPtr->ioOutBufferPtr,
-												NULL,
-												0,
-												kDoNotPackData,
-												kDoNotForceBISFormat,	
-												kDoNotForceBytes,
-												&fileIOInstructionsPtr);  
-	
-	SetUpFileIOInstructions (fileIOInstructionsPtr,
-										NULL,
-										lineStart,
-										lineEnd,
-										lineInterval,
-										columnStart,
-										columnEnd,
-										columnInterval,
-										1,
-										NULL,
-										kSetSpecialBILFlagFalse);
 										
 	gNextStatusTime = TickCount ();
 	gNextTime = TickCount ();
 	
+			// Load the boundaries for all of the fields to be used in the class
+			// and field order that they are to be written to the output image.
+	
 	for (classIndex=0; classIndex<reformatOptionsPtr->numberClasses; classIndex++)
 		{
 		statClassNumber = reformatOptionsPtr->classPtr[classIndex];
@@ -549,235 +564,275 @@ Boolean ConvertImagePixelsToClassNumbers (
 						// Check for cluster type of fields; there are no field		
 						// definitions for cluster type fields.	
 						
-				pointType = fieldIdentPtr->pointType;					
-						
-				if (pointType != kClusterType)
+				if (fieldIdentPtr->pointType != kClusterType)
 					{
 							// Get the field coordinates.										
-							
-					GetFieldBoundary (gProjectInfoPtr, &areaDescription, fieldNumber);
-						
-					rgnHandle = areaDescription.rgnHandle;
 					
-							// Take into account requested image area less than		
-							// entire scene.														
+					fieldAreaDescriptionPtr = &areaDescriptionPtr[numberAreas];
+					InitializeAreaDescription (fieldAreaDescriptionPtr);
+					numberAreas++;
 							
-					fieldLineStart = MAX (areaDescription.lineStart, lineStart);
-					fieldLineEnd = MIN (areaDescription.lineEnd, lineEnd);
-					fieldColumnStart = MAX (areaDescription.columnStart, columnStart);
-					fieldColumnEnd = MIN (areaDescription.columnEnd, columnEnd);
-					
-					fieldLineStart = 
-						((fieldLineStart-1)/lineInterval) * lineInterval + lineInterval;
-					fieldColumnStart = ((fieldColumnStart-1)/columnInterval) *
-																	columnInterval + columnInterval;
-					
-					numberFieldColumns = (fieldColumnEnd -
-											fieldColumnStart + columnInterval)/columnInterval;
-					numberFieldColumns = MAX (0, numberFieldColumns);
-					
-					imageLineNumber = (fieldLineStart - lineStart)/lineInterval;
-					imageColumnStart = (fieldColumnStart - columnStart)/columnInterval;
-					imageColumnEnd = imageColumnStart + numberFieldColumns - 1;
-						
-					maskBufferPtr = NULL;
-		
-							// Set output file pointer to correct position for 		
-							// reading and writing the output data.						
-							// The output data is first read as a starting point		
-							// so that we handle polygonal areas properly.				
+					GetFieldBoundary (gProjectInfoPtr, 
+											fieldAreaDescriptionPtr, 
+											fieldNumber);
 					
-					writePosOff = outFileInfoPtr->numberHeaderBytes +
-												imageLineNumber*numberImageColumns +
-																				imageColumnStart;
+					fieldAreaDescriptionPtr->classNumber = statClassNumber;
 							
-							// Set up mask parameters if needed.
-							
-					if (pointType == kMaskType)
+					if (fieldAreaDescriptionPtr->pointType == kMaskType &&
+												fieldAreaDescriptionPtr->maskInfoPtr == NULL)
 						{
-						if (areaDescription.maskInfoPtr == NULL)
-							{
-							continueFlag = FALSE;
-							break;
-							
-							}	// end "if (areaDescription.maskInfoPtr == NULL)"
+						continueFlag = FALSE;
+						break;
 						
-								// Get the mask buffer.
-																										
-						savedMaskBufferPtr = (HUInt16Ptr)GetHandlePointer (
-												areaDescription.maskInfoPtr->maskHandle, kLock);
+						}	// end "if (fieldAreaDescriptionPtr->pointType == kMaskType && ..."
 						
-						numberMaskColumns = areaDescription.maskInfoPtr->numberColumns + 1;
-												
-								// Adjust if needed for any change between columnStart and
-								// fieldColumnStart.
-								
-						maskColumnStart = areaDescription.maskColumnStart + 
-												fieldColumnStart - areaDescription.columnStart;
-												
-								// Adjust maskBufferPtr to correspond with start of field
-								// line start.
-											
-						savedMaskBufferPtr += (areaDescription.maskLineStart + 
-										fieldLineStart - areaDescription.lineStart - 1) * 
-																						numberMaskColumns;
-																						
-								// Now make 'numberMaskColumns' represent the number of
-								// columns to skip taking into account the line interval.
+					}	// end "if (fieldIdentPtr->pointType != kClusterType)" 
+					
+				fieldCount++;								
 								
-						numberMaskColumns *= lineInterval;
-						
-								// Get the mask value that corresponds to this class and field.
-												
-						maskRequestValue = areaDescription.maskValueRequest;
-						
-						}	// end "if (pointType == kMaskType)"
+				}	// end "if (fieldIdentPtr->field..." 
+				
+			fieldNumber = fieldIdentPtr->nextField;
 			
-					if (!continueFlag)
-						break;
-
-							// Loop through lines for area to be assigned.			
+			}	// end "while ((fieldNumber != -1) && ..." 
+			
+		if (!continueFlag)
+			break;
+			
+		}	// end "for (classIndex=0; classIndex<..." 
+		
+	if (continueFlag)
+		{
+				// Get the buffer for a band of output lines. Limit the band to about
+				// 4 megabytes.
 				
-					for (line=fieldLineStart; 
-							line<=fieldLineEnd; 
-							line+=lineInterval)
-						{						
-						skipLineFlag = FALSE;
-						if (pointType == kMaskType)
-							{
-							maskBufferPtr = savedMaskBufferPtr;
-							
-							if (*maskBufferPtr == 0)
-								skipLineFlag = TRUE;
-								
-							maskBufferPtr += maskColumnStart;
-								
-							}	// end "if (pointType == kMaskType)"
+		numberBandLines = MAX (1, 4194304 / MAX (numberImageColumns, 1));
+		numberBandLines = MIN (numberBandLines, numberImageLines);
+		
+		bandBufferPtr = (HUCharPtr)MNewPointer (
+										(SInt64)numberBandLines * numberImageColumns);
+		
+		continueFlag = (bandBufferPtr != NULL);
+		
+		}	// end "if (continueFlag)"
+		
+	GetHandlePointer (gProjectInfoPtr->trainingMask.maskHandle, kLock);
+	GetHandlePointer (gProjectInfoPtr->testMask.maskHandle, kLock);
+	
+			// Fill in the output image one band of lines at a time.
+	
+	bandLineStart = 0;
+	while (continueFlag && bandLineStart < numberImageLines)
+		{
+		bandLineEnd = MIN (bandLineStart + numberBandLines, numberImageLines) - 1;
+		
+		memset (bandBufferPtr, 
+					backgroundValue, 
+					(size_t)(bandLineEnd - bandLineStart + 1) * numberImageColumns);
+		
+		firstWriteLine = bandLineEnd + 1;
+		lastWriteLine = -1;
+		
+		for (area=0; area<numberAreas; area++)
+			{
+			fieldAreaDescriptionPtr = &areaDescriptionPtr[area];
+			
+			pointType = fieldAreaDescriptionPtr->pointType;
+			statClassNumber = fieldAreaDescriptionPtr->classNumber;
+			rgnHandle = fieldAreaDescriptionPtr->rgnHandle;
+			
+					// Take into account requested image area less than		
+					// entire scene.														
+					
+			fieldLineStart = MAX (fieldAreaDescriptionPtr->lineStart, lineStart);
+			fieldLineEnd = MIN (fieldAreaDescriptionPtr->lineEnd, lineEnd);
+			fieldColumnStart = MAX (fieldAreaDescriptionPtr->columnStart, columnStart);
+			fieldColumnEnd = MIN (fieldAreaDescriptionPtr->columnEnd, columnEnd);
+			
+			fieldLineStart = 
+				((fieldLineStart-1)/lineInterval) * lineInterval + lineInterval;
+			fieldColumnStart = ((fieldColumnStart-1)/columnInterval) *
+															columnInterval + columnInterval;
+			
+			numberFieldColumns = (fieldColumnEnd -
+									fieldColumnStart + columnInterval)/columnInterval;
+			numberFieldLines = ((SInt32)fieldLineEnd -
+									(SInt32)fieldLineStart + lineInterval)/lineInterval;
+			
+			if (numberFieldColumns <= 0 || numberFieldLines <= 0)
+				continue;
+			
+			imageLineNumber = (fieldLineStart - lineStart)/lineInterval;
+			imageColumnStart = (fieldColumnStart - columnStart)/columnInterval;
+			
+					// Get the output lines of the field that are within this band.
+					
+			outputLineStart = MAX (imageLineNumber, bandLineStart);
+			outputLineEnd = MIN (imageLineNumber + numberFieldLines - 1, bandLineEnd);
+			
+			if (outputLineStart > outputLineEnd)
+				continue;
+				
+			line = fieldLineStart + (outputLineStart - imageLineNumber) * lineInterval;
+			
+					// Set up mask parameters if needed.
+					
+			maskBufferPtr = NULL;
+			savedMaskBufferPtr = NULL;
+			numberMaskColumns = 0;
+			maskColumnStart = 0;
+			maskRequestValue = 0;
+			
+			if (pointType == kMaskType)
+				{
+				savedMaskBufferPtr = (HUInt16Ptr)GetHandlePointer (
+										fieldAreaDescriptionPtr->maskInfoPtr->maskHandle);
+				
+				numberMaskColumns = fieldAreaDescriptionPtr->maskInfoPtr->numberColumns + 1;
+										
+						// Adjust if needed for any change between columnStart and
+						// fieldColumnStart.
 						
-						if (!skipLineFlag)
-							{
-							ioOutBufferPtr = (HUCharPtr)reformatOptionsPtr->ioOutBufferPtr;
-								
-									// If this is a polygonal field, initialize the			
-									// output buffer to that already existing for that		
-									// area.																
-									
-							if (pointType == kPolygonType || pointType == kMaskType)
-								{
-								errCode = GetLine (fileIOInstructionsPtr,
-															outFileInfoPtr,
-															imageLineNumber+1,
-															0,
-															(UInt32)imageColumnStart+1,
-															(UInt32)imageColumnEnd+1,
-															&count,
-															(HUCharPtr)ioOutBufferPtr);
-									
-								}	// end "if (pointType == kPolygonType || ..." 
-								
-						   		// Set line and column number in point						
+				maskColumnStart = fieldAreaDescriptionPtr->maskColumnStart + 
+										fieldColumnStart - fieldAreaDescriptionPtr->columnStart;
 										
-							point.v = (SInt16)line;
-							point.h = (SInt16)fieldColumnStart;
-	
-									// Loop through the number of samples in the line of 	
-									// data for this field.											
-							
-							for (sample=fieldColumnStart; 
-									sample<=fieldColumnEnd; 
-									sample+=columnInterval)
-								{
-								includePixelFlag = FALSE;
-								if (pointType == kRectangleType)
-									includePixelFlag = TRUE;
+						// Adjust maskBufferPtr to correspond with the first line of the
+						// field in this band.
 									
-								else if (pointType == kPolygonType && 
-																	PtInRgn (point, rgnHandle))
-									includePixelFlag = TRUE;
-								
-								else if (pointType == kMaskType && 
-																*maskBufferPtr == maskRequestValue)
-									includePixelFlag = TRUE;
-									
-								if (includePixelFlag)
-									*ioOutBufferPtr = (UInt8)statClassNumber;
+				savedMaskBufferPtr += (fieldAreaDescriptionPtr->maskLineStart + 
+								line - fieldAreaDescriptionPtr->lineStart - 1) * 
+																				numberMaskColumns;
+																				
+						// Now make 'numberMaskColumns' represent the number of
+						// columns to skip taking into account the line interval.
+						
+				numberMaskColumns *= lineInterval;
+				
+						// Get the mask value that corresponds to this class and field.
 										
-								ioOutBufferPtr++;
-								
-								point.h += (SInt16)columnInterval;
+				maskRequestValue = fieldAreaDescriptionPtr->maskValueRequest;
+				
+				}	// end "if (pointType == kMaskType)"
+
+					// Loop through lines for area to be assigned.			
+		
+			for (outputLine=outputLineStart; outputLine<=outputLineEnd; outputLine++)
+				{
+				if (pointType == kMaskType)
+					{
+					maskBufferPtr = savedMaskBufferPtr;
+					savedMaskBufferPtr += numberMaskColumns;
+					
+					if (*maskBufferPtr == 0)
+						{
+						line += lineInterval;
+						continue;
+						
+						}	// end "if (*maskBufferPtr == 0)"
+						
+					maskBufferPtr += maskColumnStart;
+						
+					}	// end "if (pointType == kMaskType)"
+					
+				ioOutBufferPtr = &bandBufferPtr[
+							(outputLine - bandLineStart) * numberImageColumns + imageColumnStart];
+				
+				if (pointType == kRectangleType)
+					memset (ioOutBufferPtr, (UInt8)statClassNumber, numberFieldColumns);
+					
+				else	// pointType != kRectangleType
+					{
+							// Set line and column number in point						
 								
-								if (pointType == kMaskType)
-									maskBufferPtr += columnInterval;
-										
-								}	// end "for (sample=fieldColumnStart; ..."
+					point.v = (SInt16)line;
+					point.h = (SInt16)fieldColumnStart;
 
-								// Set pointer to correct location for writing.
+							// Loop through the number of samples in the line of 	
+							// data for this field.											
+					
+					for (sample=fieldColumnStart; 
+							sample<=fieldColumnEnd; 
+							sample+=columnInterval)
+						{
+						includePixelFlag = FALSE;
+						if (pointType == kPolygonType && PtInRgn (point, rgnHandle))
+							includePixelFlag = TRUE;
 						
-							if (errCode == noErr)	
-								errCode = MSetMarker (outFileStreamPtr, 
-																fsFromStart, 
-																writePosOff,
-																kErrorMessages);
-				
-									// Write buffer to appropriate location in the 			
-									// output disk file.												
-									
-							ioOutBufferPtr = (HUCharPtr)reformatOptionsPtr->ioOutBufferPtr;
-							count = numberFieldColumns;
+						else if (pointType == kMaskType && 
+														*maskBufferPtr == maskRequestValue)
+							includePixelFlag = TRUE;
 							
-							if (errCode == noErr && count > 0)
-								errCode = MWriteData (outFileStreamPtr, 
-																&count, 
-																ioOutBufferPtr,
-																kErrorMessages);
-															
-							}	// end "if (!skipLineFlag)"
-							
-								// Ready counter for next position to write to file.	
+						if (includePixelFlag)
+							*ioOutBufferPtr = (UInt8)statClassNumber;
 								
-						writePosOff += numberImageColumns;
-			
-						if (pointType == kMaskType)
-							savedMaskBufferPtr += numberMaskColumns;
+						ioOutBufferPtr++;
+						
+						point.h += (SInt16)columnInterval;
 						
-								// Update output image line position counter.			
+						if (pointType == kMaskType)
+							maskBufferPtr += columnInterval;
 								
-						imageLineNumber++;
-							
-						if (errCode != noErr)
-							{
-							continueFlag = FALSE;
-							break;
-							
-							}	// end "if (errCode != noErr)" 
-							
-						}	// end "for (line=areaDescriptionPtr-> ..." 
-					
-					if (areaDescription.maskInfoPtr != NULL)																					
-						CheckAndUnlockHandle (areaDescription.maskInfoPtr->maskHandle);
-					
-							// Dispose of the region if it exists.							
-	
-					CloseUpAreaDescription (&areaDescription);
+						}	// end "for (sample=fieldColumnStart; ..."
 						
-					}	// end "if (pointType != kClusterType)" 
+					}	// end "else pointType != kRectangleType"
 					
-				fieldCount++;								
+				firstWriteLine = MIN (firstWriteLine, outputLine);
+				lastWriteLine = MAX (lastWriteLine, outputLine);
+				
+				line += lineInterval;
+					
+				}	// end "for (outputLine=outputLineStart; ..." 
+				
+			}	// end "for (area=0; area<numberAreas; area++)"
+			
+				// Write the lines in the band that include field pixels to the 
+				// output disk file.
+				
+		if (lastWriteLine >= firstWriteLine)
+			{
+			writePosOff = outFileInfoPtr->numberHeaderBytes +
+								(SInt64)firstWriteLine * numberImageColumns;
 								
-				}	// end "if (fieldIdentPtr->field..." 
+			errCode = MSetMarker (outFileStreamPtr, 
+											fsFromStart, 
+											writePosOff,
+											kErrorMessages);
+			
+			ioOutBufferPtr = &bandBufferPtr[
+								(firstWriteLine - bandLineStart) * numberImageColumns];
+			count = (lastWriteLine - firstWriteLine + 1) * numberImageColumns;
+			
+			if (errCode == noErr)
+				errCode = MWriteData (outFileStreamPtr, 
+												&count, 
+												ioOutBufferPtr,
+												kErrorMessages);
+												
+			if (errCode != noErr)
+				continueFlag = FALSE;
 				
-			fieldNumber = fieldIdentPtr->nextField;
+			}	// end "if (lastWriteLine >= firstWriteLine)"
 			
-			}	// end "while ((fieldNumber != -1) && ..." 
+				// Allow for updates in the window or for the user to exit the routine.				
+		
+		if (continueFlag && TickCount () >= gNextTime)
+			continueFlag = CheckSomeEvents (
+											osMask+keyDownMask+updateMask+mDownMask+mUpMask);
 			
-		if (!continueFlag)
-			break;
+		bandLineStart = bandLineEnd + 1;
 			
-		}	// end "for (classIndex=0; classIndex<..." 
+		}	// end "while (continueFlag && bandLineStart < numberImageLines)"
+		
+	CheckAndUnlockHandle (gProjectInfoPtr->trainingMask.maskHandle);
+	CheckAndUnlockHandle (gProjectInfoPtr->testMask.maskHandle);
 	
-	CloseUpFileIOInstructions (fileIOInstructionsPtr, NULL);	
-
-	CloseUpGeneralFileIOInstructions (fileIOInstructionsPtr);
+			// Dispose of the regions if they exist.
+			
+	for (area=0; area<numberAreas; area++)
+		CloseUpAreaDescription (&areaDescriptionPtr[area]);
+	
+	CheckAndDisposePtr ((Ptr)areaDescriptionPtr);
+	CheckAndDisposePtr ((Ptr)bandBufferPtr);
 					
 	return (continueFlag);
 		
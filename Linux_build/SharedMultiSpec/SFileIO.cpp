@@ -18,7 +18,7 @@
 //
 //	Authors:					Larry L. Biehl
 //
-//	Revision date:			05/03/2020
+//	Revision date:			10/18/2026
 //
 //	Language:				C
 //
@@ -125,6 +125,10 @@
 extern Handle 			gCustomNavOpenList;
 extern Handle 			gCustomNavPut;	
 
+		// Shared line cache used by GetLine for files that are not blocked.
+		
+LineCache				gLineCache;
+
 							
 
 		// Prototype descriptions for routines in this file that are only		
@@ -146,6 +150,18 @@ void 		CloseUpHeirarchalFileIOParameters (
 				FileInfoPtr							fileInfoPtr, 
 				UInt16*								channelListPtr,
 				UInt16								numberChannels);
+				
+Boolean	CopyFromBlockRowCache (
+				HierarchalFileFormatPtr			hfaPtr,
+				SInt64								posOff,
+				UInt32								count,
+				HUCharPtr							bufferPtr);
+				
+Boolean	CopyFromLineCache (
+				SInt16								fileIndex,
+				SInt64								posOff,
+				UInt32								count,
+				HUCharPtr							bufferPtr);
 									
 Boolean	CreateTRLSupportFile (
 				CMFileStream*						trailerStreamPtr, 
@@ -154,6 +170,9 @@ Boolean	CreateTRLSupportFile (
 				char*									classNameTablePtr,
 				SInt16								trailerCode,
 				Boolean								writeClassNamesFlag);
+
+void		DisposeBlockRowCache (
+				HierarchalFileFormatPtr			hfaPtr);
 							
 SInt16	GetGDALLineOfData (
 				FileInfoPtr							fileInfoPtr,	
@@ -168,6 +187,18 @@ SInt16	GetGDALLineOfData (
 								
 Boolean	GetFileDlgDetermineLinkVisibility ();
 
+SInt16	GetLineCacheFileIndex (
+				CMFileStream*						fileStreamPtr,
+				Boolean								addFlag);
+
+UInt32	GetLineCacheHashIndex (
+				SInt16								fileIndex,
+				SInt64								posOff);
+
+SInt16	GetLineCacheStreamFileIndex (
+				FileIOInstructionsPtr			fileIOInstructionsPtr,
+				CMFileStream*						fileStreamPtr);
+
 SInt16	GetFileTypeAndCreator (
 				CMFileStream*						fileStreamPtr);
 							
@@ -271,6 +302,17 @@ UInt32 	PackMaskData (
 				UInt32								numberOutBytes,
 				SInt32								maskValueRequest);
 							
+UInt32 	PackMaskRunData (
+				MaskRunPtr							maskRunPtr,
+				UInt32								numberMaskRuns,
+				UInt32								maskColumnStart,
+				UInt32								numberChannels,
+				UInt32								numberInputSamples,
+				UInt32								columnInterval,
+				HUCharPtr							dataBufferPtr,
+				UInt32								numberOutBytes,
+				SInt32								maskValueRequest);
+							
 void		PackNonBISData (
 				UInt32								columnOffset,
 				UInt32								columnInterval,
@@ -298,6 +340,66 @@ void 		PackBlockedData (
 				HierarchalFileFormatPtr			hfaPtr,
 				HUCharPtr							outputBufferPtr);
 
+void		InitializeLineCache (void);
+
+void		MoveLineCacheEntry (
+				SInt16								entryIndex,
+				Boolean								lastFlag);
+
+void		ReadAdjacentChannelStrips (
+				FileInfoPtr							fileInfoPtr,
+				CMFileStream*						fileStreamPtr,
+				SInt16								channelNumber,
+				UInt32								lineNumber,
+				SInt64								nextPosOff);
+
+Boolean	ReadChannelLineBlock (
+				FileIOInstructionsPtr			fileIOInstructionsPtr,
+				FileInfoPtr							fileInfoPtr,
+				CMFileStream*						fileStreamPtr,
+				SInt16								channelNumber,
+				UInt32								lineNumber,
+				SInt64								posOff,
+				UInt32								count,
+				HUCharPtr							bufferPtr);
+
+Boolean	ReadFromSequentialBuffer (
+				FileIOInstructionsPtr			fileIOInstructionsPtr,
+				FileInfoPtr							fileInfoPtr,
+				CMFileStream*						fileStreamPtr,
+				SInt64								posOff,
+				UInt32								count,
+				HUCharPtr							bufferPtr);
+
+void		ReleaseLineCacheEntries (
+				SInt16								fileIndex);
+
+void		ReleaseLineCacheFile (
+				CMFileStream*						fileStreamPtr);
+
+void		RemoveLineCacheEntry (
+				SInt16								entryIndex);
+
+SInt32	ReserveBlockRowCacheSlot (
+				FileInfoPtr							fileInfoPtr,
+				HierarchalFileFormatPtr			hfaPtr,
+				SInt64								posOff,
+				UInt32								count);
+
+void		SaveToBlockRowCache (
+				FileInfoPtr							fileInfoPtr,
+				HierarchalFileFormatPtr			hfaPtr,
+				SInt64								posOff,
+				UInt32								count,
+				HUCharPtr							bufferPtr);
+
+void		SaveToLineCache (
+				SInt16								fileIndex,
+				SInt64								posOff,
+				UInt32								count,
+				HUCharPtr							bufferPtr,
+				Boolean								lowPriorityFlag);
+
 SInt16 	SetUpDataConversionCode (
 				LayerInfoPtr						layerInfoPtr,
 				FileInfoPtr							fileInfoPtr,
@@ -769,6 +871,8 @@ void CloseFile (
       #if defined multispec_win || defined multispec_wx
 			fileStreamPtr->MCloseFile ();
 		#endif	// defined multispec_win || defined multispec_wx
+		
+		ReleaseLineCacheFile (fileStreamPtr);
 			
 		}	// end "if (fileStreamPtr != NULL)" 
 	
@@ -829,7 +933,13 @@ void CloseUpFileIOInstructions (
 		if (fileIOInstructionsPtr->maskBufferPtr != NULL && areaDescriptionPtr != NULL)
 			{
 			CheckAndUnlockHandle (areaDescriptionPtr->maskInfoPtr->maskHandle);
+			CheckAndUnlockHandle (
+								areaDescriptionPtr->maskInfoPtr->maskLineRunIndexHandle);
+			CheckAndUnlockHandle (areaDescriptionPtr->maskInfoPtr->maskRunHandle);
 			fileIOInstructionsPtr->maskBufferPtr = NULL;
+			fileIOInstructionsPtr->maskBufferStartPtr = NULL;
+			fileIOInstructionsPtr->maskLineRunIndexPtr = NULL;
+			fileIOInstructionsPtr->maskRunPtr = NULL;
 			
 			}	// end "if (fileIOInstructionsPtr->maskBufferPtr != NULL && ..."
 			
@@ -867,7 +977,7 @@ void CloseUpFileIOInstructions (
 // Called By:			
 //
 //	Coded By:			Larry L. Biehl			Date: 10/14/1999
-//	Revised By:			Larry L. Biehl			Date: 10/26/2007
+//	Revised By:			agent						Date: 10/18/2026
 
 void CloseUpGeneralFileIOInstructions (
 				FileIOInstructionsPtr			fileIOInstructionsPtr)
@@ -900,6 +1010,19 @@ void CloseUpGeneralFileIOInstructions (
 		fileIOInstructionsPtr->tiledBufferPtrs[0] = NULL;
 		fileIOInstructionsPtr->tiledBufferPtrs[1] = NULL;
 		
+		fileIOInstructionsPtr->sequentialBufferPtr = (HUCharPtr)CheckAndDisposePtr (
+										(Ptr)fileIOInstructionsPtr->sequentialBufferPtr);
+		fileIOInstructionsPtr->sequentialBufferBytes = 0;
+		fileIOInstructionsPtr->sequentialBytesInBuffer = 0;
+		fileIOInstructionsPtr->sequentialFileInfoPtr = NULL;
+		
+		fileIOInstructionsPtr->channelLineBlockPtr = 
+				(ChannelLineBlockPtr)CheckAndDisposePtr (
+										(Ptr)fileIOInstructionsPtr->channelLineBlockPtr);
+		fileIOInstructionsPtr->channelLineBlockBufferPtr = (HUCharPtr)CheckAndDisposePtr (
+										(Ptr)fileIOInstructionsPtr->channelLineBlockBufferPtr);
+		fileIOInstructionsPtr->numberChannelLineBlocks = 0;
+		
 		fileIOInstructionsPtr->bufferOffset = 0;
 		
 		fileIOInstructionsPtr->numberChannels = 0;
@@ -1002,6 +1125,8 @@ void CloseUpHeirarchalFileIOParameters (
 				
 				localHfaPtr->tiledBufferPtr = NULL;	
 				
+				DisposeBlockRowCache (localHfaPtr);
+				
 				localHfaPtr->firstLineRead = 0;
 				localHfaPtr->lastLineRead = 0;	
 				localHfaPtr->firstColumnStartByte = 0;
@@ -1634,6 +1759,125 @@ Boolean CopyFileStream (
 }	// end "CopyFileStream"
 
 
+
+//------------------------------------------------------------------------------------
+//                   Copyright 1988-2020 Purdue Research Foundation
+//
+//	Function name:		Boolean CopyFromBlockRowCache
+//
+//	Software purpose:	The purpose of this routine is to copy the requested block row
+//							from the block row cache for the input hierarchal file 
+//							structure into the input buffer if it is in the cache.
+//
+//	Parameters in:		Pointer to hierarchal file structure
+//							File position offset of the block row
+//							Number of bytes in the block row
+//
+//	Parameters out:	Block row data
+//
+//	Value Returned:	TRUE if the block row was in the cache
+//							FALSE if the block row was not in the cache
+//
+// Called By:			GetLine in SFileIO.cpp
+//
+//	Coded By:			agent						Date: 10/18/2026
+//	Revised By:			agent						Date: 10/18/2026
+
+Boolean CopyFromBlockRowCache (
+				HierarchalFileFormatPtr			hfaPtr,
+				SInt64								posOff,
+				UInt32								count,
+				HUCharPtr							bufferPtr)
+
+{
+	UInt32								slot;
+	
+	
+	for (slot=0; slot<kBlockRowCacheNumberSlots; slot++)
+		{
+		if (hfaPtr->blockRowCacheCount[slot] == count &&
+											hfaPtr->blockRowCachePosOff[slot] == posOff &&
+																	count > 0)
+			{
+			BlockMoveData (hfaPtr->blockRowCachePtrs[slot], bufferPtr, count);
+			
+			hfaPtr->blockRowCacheUseCount++;
+			hfaPtr->blockRowCacheLastUse[slot] = hfaPtr->blockRowCacheUseCount;
+																						return (TRUE);
+																					
+			}	// end "if (hfaPtr->blockRowCacheCount[slot] == count && ..."
+		
+		}	// end "for (slot=0; slot<kBlockRowCacheNumberSlots; slot++)"
+		
+	return (FALSE);
+		
+}	// end "CopyFromBlockRowCache"
+
+
+//------------------------------------------------------------------------------------
+//                   Copyright 1988-2020 Purdue Research Foundation
+//
+//	Function name:		Boolean CopyFromLineCache
+//
+//	Software purpose:	The purpose of this routine is to copy the bytes at the
+//							requested position in the file from the shared line cache
+//							into the input buffer if they are in the cache. Only the
+//							entries in the hash bucket for the file position are checked.
+//
+//	Parameters in:		Index of the file in the shared line cache
+//							File position offset of the bytes
+//							Number of bytes
+//
+//	Parameters out:	Bytes from the file
+//
+//	Value Returned:	TRUE if the bytes were in the cache
+//							FALSE if the bytes were not in the cache
+//
+// Called By:			GetLine in SFileIO.cpp
+//
+//	Coded By:			agent						Date: 10/18/2026
+//	Revised By:			agent						Date: 10/18/2026
+
+Boolean CopyFromLineCache (
+				SInt16								fileIndex,
+				SInt64								posOff,
+				UInt32								count,
+				HUCharPtr							bufferPtr)
+
+{
+	LineCacheEntryPtr					lineCacheEntryPtr;
+	
+	SInt16								entryIndex;
+	
+	
+	if (count == 0)
+																						return (FALSE);
+	
+	entryIndex = gLineCache.hashBuckets[GetLineCacheHashIndex (fileIndex, posOff)];
+	while (entryIndex >= 0)
+		{
+		lineCacheEntryPtr = &gLineCache.entries[entryIndex];
+		
+		if (lineCacheEntryPtr->posOff == posOff &&
+					lineCacheEntryPtr->count == count &&
+							lineCacheEntryPtr->fileIndex == fileIndex)
+			{
+			BlockMoveData (lineCacheEntryPtr->dataPtr, bufferPtr, count);
+			
+			MoveLineCacheEntry (entryIndex, FALSE);
+																						return (TRUE);
+																					
+			}	// end "if (lineCacheEntryPtr->posOff == posOff && ..."
+			
+		entryIndex = lineCacheEntryPtr->hashNext;
+		
+		}	// end "while (entryIndex >= 0)"
+		
+	return (FALSE);
+		
+}	// end "CopyFromLineCache"
+
+
 /*
 //------------------------------------------------------------------------------------
 //                   Copyright 1988-2020 Purdue Research Foundation
@@ -3118,6 +3362,55 @@ void DiskFullAlert (
 
 
 
+//------------------------------------------------------------------------------------
+//                   Copyright 1988-2020 Purdue Research Foundation
+//
+//	Function name:		void DisposeBlockRowCache
+//
+//	Software purpose:	The purpose of this routine is to release the memory for the
+//							block row cache in the input hierarchal file structure and
+//							mark all of the cache slots as empty.
+//
+//	Parameters in:		Pointer to hierarchal file structure
+//
+//	Parameters out:	None
+//
+//	Value Returned:	None
+//
+// Called By:			CloseUpHeirarchalFileIOParameters in SFileIO.cpp
+//
+//	Coded By:			agent						Date: 10/18/2026
+//	Revised By:			agent						Date: 10/18/2026
+
+void DisposeBlockRowCache (
+				HierarchalFileFormatPtr			hfaPtr)
+
+{
+	UInt32								slot;
+	
+	
+	if (hfaPtr != NULL)
+		{
+		for (slot=0; slot<kBlockRowCacheNumberSlots; slot++)
+			{
+			hfaPtr->blockRowCachePtrs[slot] = (HUCharPtr)CheckAndDisposePtr (
+															(Ptr)hfaPtr->blockRowCachePtrs[slot]);
+			
+			hfaPtr->blockRowCachePosOff[slot] = 0;
+			hfaPtr->blockRowCacheBytes[slot] = 0;
+			hfaPtr->blockRowCacheCount[slot] = 0;
+			hfaPtr->blockRowCacheLastUse[slot] = 0;
+			
+			}	// end "for (slot=0; slot<kBlockRowCacheNumberSlots; slot++)"
+			
+		hfaPtr->blockRowCacheUseCount = 0;
+		
+		}	// end "if (hfaPtr != NULL)"
+		
+}	// end "DisposeBlockRowCache"
+
+
+
 //------------------------------------------------------------------------------------
 //                   Copyright 1988-2020 Purdue Research Foundation
 //
@@ -5767,7 +6060,7 @@ Boolean GetFSSpecFlag (
 //							ConvertShapeToClassNumber in SShapeToThematic.cpp
 //
 //	Coded By:			Larry L. Biehl			Date: 03/23/1988
-//	Revised By:			Larry L. Biehl			Date: 06/06/2012
+//	Revised By:			agent						Date: 10/18/2026
 
 SInt16 GetLine (
 				FileIOInstructionsPtr			fileIOInstructionsPtr,
@@ -5789,10 +6082,12 @@ SInt16 GetLine (
 	UInt32								channelStartIndex,
 											count,
 											readLineNumber,
+											requestedCount,
 											segmentedEndOffset,
 											segmentedStartOffset;
 	
-	SInt16								errCode = noErr;
+	SInt16								errCode = noErr,
+											lineCacheFileIndex = -1;
 	
 	#if include_hdf_capability
 		SInt16								hdfErrCode;
@@ -5930,14 +6225,93 @@ SInt16 GetLine (
 															&count,
 															&endHalfByte);
 															
-				errCode = MSetMarker (
+						// Block rows that were already read for another area or
+						// pass during this set of file IO instructions are copied
+						// from the block row cache. Lines of files that are not
+						// blocked may have been read already by another window or
+						// processor for the same file; these are copied from the 
+						// shared line cache. Processors making a sequential pass 
+						// through the whole image may have set up a read-ahead buffer;
+						// lines served from it are not added to the shared line cache.
+						// Processors that set up channel line blocks read lines of band
+						// sequential files in blocks of lines for each channel.
+						
+				if (!fileInfoPtr->blockedFlag && count <= kLineCacheEntryBytesLimit)
+					lineCacheFileIndex = GetLineCacheStreamFileIndex (
+																fileIOInstructionsPtr, fileStreamPtr);
+															
+				if (fileInfoPtr->blockedFlag && 
+							CopyFromBlockRowCache (hfaPtr, posOff, count, readBufferPtr))
+					errCode = noErr;
+					
+				else if (!fileInfoPtr->blockedFlag &&
+							ReadChannelLineBlock (fileIOInstructionsPtr,
+															fileInfoPtr,
+															fileStreamPtr,
+															channelNumber,
+															readLineNumber,
+															posOff, 
+															count, 
+															readBufferPtr))
+					errCode = noErr;
+					
+				else if (!fileInfoPtr->blockedFlag &&
+							ReadFromSequentialBuffer (fileIOInstructionsPtr,
+																fileInfoPtr,
+																fileStreamPtr,
+																posOff, 
+																count, 
+																readBufferPtr))
+					errCode = noErr;
+						
+				else if (lineCacheFileIndex >= 0 &&
+							CopyFromLineCache (
+										lineCacheFileIndex, posOff, count, readBufferPtr))
+					errCode = noErr;
+					
+				else	// block row or line is not in cache
+					{
+					requestedCount = count;
+					errCode = MSetMarker (
 										fileStreamPtr, fsFromStart, posOff, kNoErrorMessages);
 
-				if (errCode == noErr)
-					errCode = MReadData (fileStreamPtr, 
-														&count, 
-														readBufferPtr, 
-														kNoErrorMessages);
+					if (errCode == noErr)
+						errCode = MReadData (fileStreamPtr, 
+															&count, 
+															readBufferPtr, 
+															kNoErrorMessages);
+															
+					if (errCode == noErr && fileInfoPtr->blockedFlag)
+						{
+						SaveToBlockRowCache (fileInfoPtr,
+														hfaPtr, 
+														posOff, 
+														requestedCount, 
+														readBufferPtr);
+						
+								// For planar TIFF strips, pick up the strips for the
+								// same block row of the following channels if they come
+								// next in the file.
+								
+						if (fileInfoPtr->bandInterleave == kBSQ && 
+										fileInfoPtr->nonContiguousStripsFlag &&
+												count == requestedCount)
+							ReadAdjacentChannelStrips (fileInfoPtr,
+																fileStreamPtr,
+																channelNumber,
+																readLineNumber,
+																posOff + count);
+						
+						}	// end "if (errCode == noErr && fileInfoPtr->blockedFlag)"
+						
+					else if (errCode == noErr && count == requestedCount)
+						SaveToLineCache (lineCacheFileIndex,
+												posOff,
+												count,
+												readBufferPtr,
+												fileIOInstructionsPtr->lineCacheLowPriorityFlag);
+					
+					}	// end "else block row or line is not in cache"
 														
 				if (errCode == noErr && fileInfoPtr->blockedFlag)
 					{
@@ -6091,112 +6465,411 @@ SInt16 GetLine (
 //------------------------------------------------------------------------------------
 //                   Copyright 1988-2020 Purdue Research Foundation
 //
-//	Function name:		SInt16 GetLineOfData
+//	Function name:		SInt16 GetLineCacheFileIndex
 //
-//	Software purpose:	The purpose of this routine is to read
-//							all data for a requested line and requested
-//							channels of image data into a buffer that has been
-//							provided.  If the channel list pointer is NULL, then
-//							load the data in for all channels.
+//	Software purpose:	The purpose of this routine is to find the index in the shared
+//							line cache for the file represented by the input file stream.
+//							Files are matched by their full path so that separate file
+//							streams for the same file share the cache. If requested, the
+//							file is added to the cache when it is not there already;
+//							the least recently used file is dropped if all file slots
+//							are in use.
 //
-//	Parameters in:				
+//	Parameters in:		Pointer to file stream
+//							Flag indicating whether the file is to be added
 //
-//	Parameters out:	Number of samples loaded into buffer
+//	Parameters out:	None
 //
-//	Value Returned:	Error code for file operations. 
+//	Value Returned:	Index of the file in the shared line cache
+//							-1 if the file is not in the cache
 //
-// Called By:		
+// Called By:			GetLine in SFileIO.cpp
+//							ReleaseLineCacheFile in SFileIO.cpp
 //
-//	Coded By:			Larry L. Biehl			Date: 12/15/1988
-//	Revised By:			Larry L. Biehl			Date: 12/11/2012
+//	Coded By:			agent						Date: 10/18/2026
+//	Revised By:			agent						Date: 10/18/2026
 
-SInt16 GetLineOfData (
-				FileIOInstructionsPtr			fileIOInstructionsPtr,
-				UInt32								lineNumber, 
-				UInt32								columnStart, 
-				UInt32								columnEnd, 
-				UInt32								columnInterval,
-				HUCharPtr							fileIOBufferPtr, 
-				HUCharPtr							dataBufferPtr)
+SInt16 GetLineCacheFileIndex (
+				CMFileStream*						fileStreamPtr,
+				Boolean								addFlag)
 
-{                                                
-	FileInfoPtr							fileInfoPtr,
-											localFileInfoPtr;
-	
-	HUCharPtr							ioBufferPtr;
-											
-	LayerInfoPtr						layerInfoPtr;
+{
+	LineCacheFilePtr					lineCacheFilePtr;
 	
-	UInt16*								channelListPtr;
+	#if defined multispec_win || defined multispec_wx
+		char*									filePathPtr;
+	#endif	// defined multispec_win || defined multispec_wx
 	
-	WindowInfoPtr						windowInfoPtr; 
+	UInt32								index,
+											useIndex;
 	
-	UInt32								bytesChannelOffset,
-											columnOffset,
-											fileNumberChannels,
-											index,
-											numberChannels,
-											numberColumnsPerChannel,
-											numberSamples,
-											numberSamplesRead;
+	Boolean								matchFlag = FALSE;
 	
-	SInt16								channel,
-											errCode,
-											fileInfoIndex,
-											numberBytes;
-											
-	UInt16								forceOutByteCode;
-											
-	Boolean								callPackLineOfDataFlag,
-											differentBuffersFlag,
-											oneReadFlag,
-											packDataFlag,
-											signedDataFlag,
-											toBISFormatFlag,
-											useMultipleChannelGDALFlag;
-
 	
-	if (lineNumber <= 0  || fileIOBufferPtr == NULL)
-																							return (-1);
-		
-			// Initialize some local variables.												
-		
-	numberSamples = columnEnd - columnStart + 1;
+	if (fileStreamPtr == NULL)
+																						return (-1);
+																					
+	if (!addFlag && gLineCache.numberFilesInUse == 0)
+																						return (-1);
 	
-	useMultipleChannelGDALFlag = FALSE;
-	channelListPtr = fileIOInstructionsPtr->channelListPtr;
-	numberChannels = fileIOInstructionsPtr->numberChannels;
-	windowInfoPtr = fileIOInstructionsPtr->windowInfoPtr;
-	layerInfoPtr = fileIOInstructionsPtr->layerInfoPtr;
-	fileInfoPtr = fileIOInstructionsPtr->fileInfoPtr;
-	packDataFlag = fileIOInstructionsPtr->packDataFlag; 
-	toBISFormatFlag = fileIOInstructionsPtr->forceBISFormatFlag, 
-	forceOutByteCode = fileIOInstructionsPtr->forceByteCode;
-	oneReadFlag = fileIOInstructionsPtr->oneReadFlag;
-	callPackLineOfDataFlag = fileIOInstructionsPtr->callPackLineOfDataFlag;
-	differentBuffersFlag = fileIOInstructionsPtr->differentBuffersFlag;		
+	#if defined multispec_win || defined multispec_wx
+				// The first 2 bytes of the path contain the length.
+				
+		filePathPtr = (char*)GetFilePathPPointerFromFileStream (fileStreamPtr);
+		if (filePathPtr == NULL)
+																						return (-1);
+																					
+		filePathPtr = &filePathPtr[2];
+		if (filePathPtr[0] == 0 || strlen (filePathPtr) >= _MAX_PATH)
+																						return (-1);
+	#endif	// defined multispec_win || defined multispec_wx
 	
-	if (oneReadFlag)
+	useIndex = 0;
+	for (index=0; index<kLineCacheNumberFiles; index++)
 		{
-		columnOffset = columnStart - 1;
-		numberColumnsPerChannel = fileInfoPtr->numberColumns;
+		lineCacheFilePtr = &gLineCache.files[index];
 		
-		}	// end "if (oneReadFlag)"
+		if (lineCacheFilePtr->inUseFlag)
+			{
+			#if defined multispec_mac
+				matchFlag = (FSCompareFSRefs (&lineCacheFilePtr->fsRef, 
+														&fileStreamPtr->fsRef) == noErr);
+			#endif	// defined multispec_mac
+			
+			#if defined multispec_win || defined multispec_wx
+				matchFlag = (strcmp (lineCacheFilePtr->filePath, filePathPtr) == 0);
+			#endif	// defined multispec_win || defined multispec_wx
+			
+			if (matchFlag)
+				{
+				gLineCache.useCount++;
+				lineCacheFilePtr->lastUse = gLineCache.useCount;
+																				return ((SInt16)index);
+																				
+				}	// end "if (matchFlag)"
+			
+			}	// end "if (lineCacheFilePtr->inUseFlag)"
+			
+				// Keep track of an unused file slot or the least recently used one.
+			
+		if (gLineCache.files[useIndex].inUseFlag &&
+					(!lineCacheFilePtr->inUseFlag ||
+							lineCacheFilePtr->lastUse < gLineCache.files[useIndex].lastUse))
+			useIndex = index;
 		
-	else	// !oneReadFlag
-		{
-		columnOffset = 0;
-		numberColumnsPerChannel = numberSamples;
+		}	// end "for (index=0; index<kLineCacheNumberFiles; index++)"
 		
-		}	// end "else !oneReadFlag"
-																						
-	if (fileIOInstructionsPtr->maskBufferPtr != NULL)
+	if (!addFlag)
+																						return (-1);
+	
+	if (!gLineCache.initializedFlag)
+		InitializeLineCache ();
+	
+	if (gLineCache.files[useIndex].inUseFlag)
+		ReleaseLineCacheEntries ((SInt16)useIndex);
+		
+	lineCacheFilePtr = &gLineCache.files[useIndex];
+	
+	#if defined multispec_mac
+		lineCacheFilePtr->fsRef = fileStreamPtr->fsRef;
+	#endif	// defined multispec_mac
+	
+	#if defined multispec_win || defined multispec_wx
+		strcpy (lineCacheFilePtr->filePath, filePathPtr);
+	#endif	// defined multispec_win || defined multispec_wx
+	
+	gLineCache.nextSerialNumber++;
+	if (gLineCache.nextSerialNumber == 0)
+		gLineCache.nextSerialNumber = 1;
+	lineCacheFilePtr->serialNumber = gLineCache.nextSerialNumber;
+	
+	lineCacheFilePtr->inUseFlag = TRUE;
+	gLineCache.numberFilesInUse++;
+	
+	gLineCache.useCount++;
+	lineCacheFilePtr->lastUse = gLineCache.useCount;
+	
+	return ((SInt16)useIndex);
+	
+}	// end "GetLineCacheFileIndex"
+
+
+
+//------------------------------------------------------------------------------------
+//                   Copyright 1988-2020 Purdue Research Foundation
+//
+//	Function name:		UInt32 GetLineCacheHashIndex
+//
+//	Software purpose:	The purpose of this routine is to get the hash bucket in the
+//							shared line cache for the bytes at the input file position.
+//							Lines are at multiples of the line length in the file, so the
+//							position is mixed with a multiplicative hash and the high bits
+//							are used.
+//
+//	Parameters in:		Index of the file in the shared line cache
+//							File position offset of the bytes
+//
+//	Parameters out:	None
+//
+//	Value Returned:	Index of the hash bucket
+//
+// Called By:			CopyFromLineCache in SFileIO.cpp
+//							RemoveLineCacheEntry in SFileIO.cpp
+//							SaveToLineCache in SFileIO.cpp
+//
+//	Coded By:			agent						Date: 10/18/2026
+//	Revised By:			agent						Date: 10/18/2026
+
+UInt32 GetLineCacheHashIndex (
+				SInt16								fileIndex,
+				SInt64								posOff)
+
+{
+	UInt32								hashValue;
+	
+	
+	hashValue = (UInt32)posOff ^ (UInt32)(posOff >> 32);
+	hashValue ^= (UInt32)fileIndex * 0x9e3779b1;
+	hashValue *= 0x85ebca6b;
+	
+	return (hashValue >> (32 - kLineCacheHashBits));
+	
+}	// end "GetLineCacheHashIndex"
+
+
+
+//------------------------------------------------------------------------------------
+//                   Copyright 1988-2020 Purdue Research Foundation
+//
+//	Function name:		SInt16 GetLineCacheStreamFileIndex
+//
+//	Software purpose:	The purpose of this routine is to find the index in the shared
+//							line cache for the input file stream. The file IO instructions
+//							keep the index found for each file stream that they read from,
+//							so the file paths only need to be compared the first time that
+//							a line is read from the stream or after the file has been
+//							dropped from the cache.
+//
+//	Parameters in:		Pointer to file IO instructions structure
+//							Pointer to file stream
+//
+//	Parameters out:	None
+//
+//	Value Returned:	Index of the file in the shared line cache
+//							-1 if the file could not be added to the cache
+//
+// Called By:			GetLine in SFileIO.cpp
+//
+//	Coded By:			agent						Date: 10/18/2026
+//	Revised By:			agent						Date: 10/18/2026
+
+SInt16 GetLineCacheStreamFileIndex (
+				FileIOInstructionsPtr			fileIOInstructionsPtr,
+				CMFileStream*						fileStreamPtr)
+
+{
+	LineCacheFilePtr					lineCacheFilePtr;
+	LineCacheStreamPtr				lineCacheStreamPtr;
+	
+	UInt32								index;
+	
+	SInt16								fileIndex;
+	
+	
+	for (index=0; index<fileIOInstructionsPtr->numberLineCacheStreams; index++)
+		{
+		lineCacheStreamPtr = &fileIOInstructionsPtr->lineCacheStreams[index];
+		
+		if (lineCacheStreamPtr->fileStreamPtr == fileStreamPtr)
+			{
+			fileIndex = lineCacheStreamPtr->fileIndex;
+			lineCacheFilePtr = &gLineCache.files[fileIndex];
+			
+			if (lineCacheFilePtr->inUseFlag &&
+					lineCacheFilePtr->serialNumber == lineCacheStreamPtr->fileSerialNumber)
+				{
+				gLineCache.useCount++;
+				lineCacheFilePtr->lastUse = gLineCache.useCount;
+																				return (fileIndex);
+																				
+				}	// end "if (lineCacheFilePtr->inUseFlag && ..."
+				
+			break;
+			
+			}	// end "if (lineCacheStreamPtr->fileStreamPtr == fileStreamPtr)"
+		
+		}	// end "for (index=0; index<...->numberLineCacheStreams; index++)"
+		
+	fileIndex = GetLineCacheFileIndex (fileStreamPtr, TRUE);
+	
+	if (fileIndex >= 0)
+		{
+				// Save the link for the file stream. If the file stream was not
+				// linked before and all of the links are in use, the last one is
+				// replaced.
+		
+		if (index == fileIOInstructionsPtr->numberLineCacheStreams)
+			{
+			if (index < kLineCacheNumberFiles)
+				fileIOInstructionsPtr->numberLineCacheStreams++;
+				
+			else	// index >= kLineCacheNumberFiles
+				index = kLineCacheNumberFiles - 1;
+			
+			}	// end "if (index == ...->numberLineCacheStreams)"
+		
+		lineCacheStreamPtr = &fileIOInstructionsPtr->lineCacheStreams[index];
+		lineCacheStreamPtr->fileStreamPtr = fileStreamPtr;
+		lineCacheStreamPtr->fileIndex = fileIndex;
+		lineCacheStreamPtr->fileSerialNumber = gLineCache.files[fileIndex].serialNumber;
+		
+		}	// end "if (fileIndex >= 0)"
+	
+	return (fileIndex);
+	
+}	// end "GetLineCacheStreamFileIndex"
+
+
+
+//------------------------------------------------------------------------------------
+//                   Copyright 1988-2020 Purdue Research Foundation
+//
+//	Function name:		SInt16 GetLineOfData
+//
+//	Software purpose:	The purpose of this routine is to read
+//							all data for a requested line and requested
+//							channels of image data into a buffer that has been
+//							provided.  If the channel list pointer is NULL, then
+//							load the data in for all channels.
+//
+//	Parameters in:				
+//
+//	Parameters out:	Number of samples loaded into buffer
+//
+//	Value Returned:	Error code for file operations. 
+//
+// Called By:		
+//
+//	Coded By:			Larry L. Biehl			Date: 12/15/1988
+//	Revised By:			Larry L. Biehl			Date: 12/11/2012
+
+SInt16 GetLineOfData (
+				FileIOInstructionsPtr			fileIOInstructionsPtr,
+				UInt32								lineNumber, 
+				UInt32								columnStart, 
+				UInt32								columnEnd, 
+				UInt32								columnInterval,
+				HUCharPtr							fileIOBufferPtr, 
+				HUCharPtr							dataBufferPtr)
+
+{                                                
+	FileInfoPtr							fileInfoPtr,
+											localFileInfoPtr;
+	
+	HUCharPtr							ioBufferPtr;
+											
+	LayerInfoPtr						layerInfoPtr;
+	MaskRunPtr							maskRunPtr;
+	
+	UInt16*								channelListPtr;
+	
+	WindowInfoPtr						windowInfoPtr; 
+	
+	UInt32								bytesChannelOffset,
+											columnOffset,
+											fileNumberChannels,
+											index,
+											maskLineIndex,
+											numberChannels,
+											numberColumnsPerChannel,
+											numberMaskRuns,
+											numberSamples,
+											numberSamplesRead;
+	
+	SInt16								channel,
+											errCode,
+											fileInfoIndex,
+											numberBytes;
+											
+	UInt16								forceOutByteCode;
+											
+	Boolean								callPackLineOfDataFlag,
+											differentBuffersFlag,
+											oneReadFlag,
+											packDataFlag,
+											signedDataFlag,
+											toBISFormatFlag,
+											useMultipleChannelGDALFlag;
+
+	
+	if (lineNumber <= 0  || fileIOBufferPtr == NULL)
+																							return (-1);
+		
+			// Initialize some local variables.												
+		
+	numberSamples = columnEnd - columnStart + 1;
+	
+	useMultipleChannelGDALFlag = FALSE;
+	maskRunPtr = NULL;
+	numberMaskRuns = 0;
+	channelListPtr = fileIOInstructionsPtr->channelListPtr;
+	numberChannels = fileIOInstructionsPtr->numberChannels;
+	windowInfoPtr = fileIOInstructionsPtr->windowInfoPtr;
+	layerInfoPtr = fileIOInstructionsPtr->layerInfoPtr;
+	fileInfoPtr = fileIOInstructionsPtr->fileInfoPtr;
+	packDataFlag = fileIOInstructionsPtr->packDataFlag; 
+	toBISFormatFlag = fileIOInstructionsPtr->forceBISFormatFlag, 
+	forceOutByteCode = fileIOInstructionsPtr->forceByteCode;
+	oneReadFlag = fileIOInstructionsPtr->oneReadFlag;
+	callPackLineOfDataFlag = fileIOInstructionsPtr->callPackLineOfDataFlag;
+	differentBuffersFlag = fileIOInstructionsPtr->differentBuffersFlag;		
+	
+	if (oneReadFlag)
+		{
+		columnOffset = columnStart - 1;
+		numberColumnsPerChannel = fileInfoPtr->numberColumns;
+		
+		}	// end "if (oneReadFlag)"
+		
+	else	// !oneReadFlag
+		{
+		columnOffset = 0;
+		numberColumnsPerChannel = numberSamples;
+		
+		}	// end "else !oneReadFlag"
+																						
+	if (fileIOInstructionsPtr->maskBufferPtr != NULL)
 		{
-		if (!DetermineIfMaskDataInLine (fileIOInstructionsPtr->maskBufferPtr,
-													fileIOInstructionsPtr->maskColumnStart,
-													numberSamples,
-													columnInterval,
-													fileIOInstructionsPtr->maskValueRequest))
+		if (fileIOInstructionsPtr->maskLineRunIndexPtr != NULL)
+			{
+					// Use the run length index for the mask line. The line is found
+					// from the current position of the mask buffer pointer since the
+					// calling routines step that pointer from line to line.
+					
+			maskLineIndex = (UInt32)((fileIOInstructionsPtr->maskBufferPtr -
+													fileIOInstructionsPtr->maskBufferStartPtr) /
+															fileIOInstructionsPtr->numberMaskBufferColumns);
+			
+			maskRunPtr = &fileIOInstructionsPtr->maskRunPtr[
+								fileIOInstructionsPtr->maskLineRunIndexPtr[maskLineIndex]];
+			numberMaskRuns = fileIOInstructionsPtr->maskLineRunIndexPtr[maskLineIndex+1] -
+								fileIOInstructionsPtr->maskLineRunIndexPtr[maskLineIndex];
+			
+			if (!DetermineIfMaskRunsInLine (maskRunPtr,
+														numberMaskRuns,
+														fileIOInstructionsPtr->maskColumnStart,
+														numberSamples,
+														columnInterval,
+														fileIOInstructionsPtr->maskValueRequest))
+																							return (2);
+			
+			}	// end "if (fileIOInstructionsPtr->maskLineRunIndexPtr != NULL)"
+			
+		else if (!DetermineIfMaskDataInLine (fileIOInstructionsPtr->maskBufferPtr,
+															fileIOInstructionsPtr->maskColumnStart,
+															numberSamples,
+															columnInterval,
+															fileIOInstructionsPtr->maskValueRequest))
 																							return (2);
 																						
 		}	// end "if (fileIOInstructionsPtr->maskBufferPtr != NULL)"
@@ -6440,7 +7113,19 @@ SInt16 GetLineOfData (
 			// by the mask. Note that this is currently only set up for BIS output
 			// data.
 							
-	if (fileIOInstructionsPtr->maskBufferPtr != NULL)
+	if (maskRunPtr != NULL)
+		fileIOInstructionsPtr->numberOutputBufferSamples = PackMaskRunData (
+														maskRunPtr,
+														numberMaskRuns,
+														fileIOInstructionsPtr->maskColumnStart,
+														numberChannels,
+														numberSamples,
+														columnInterval,
+														dataBufferPtr,
+														numberBytes,
+														fileIOInstructionsPtr->maskValueRequest);
+							
+	else if (fileIOInstructionsPtr->maskBufferPtr != NULL)
 		fileIOInstructionsPtr->numberOutputBufferSamples = PackMaskData (
 														fileIOInstructionsPtr->maskBufferPtr,
 														fileIOInstructionsPtr->maskColumnStart,
@@ -7800,6 +8485,61 @@ void InitializeFileStream (
 
 
 
+//------------------------------------------------------------------------------------
+//                   Copyright 1988-2020 Purdue Research Foundation
+//
+//	Function name:		void InitializeLineCache
+//
+//	Software purpose:	The purpose of this routine is to initialize the hash buckets
+//							and the least recently used list for the shared line cache.
+//							It is called before the first file is added to the cache.
+//
+//	Parameters in:		None
+//
+//	Parameters out:	None
+//
+//	Value Returned:	None
+//
+// Called By:			GetLineCacheFileIndex in SFileIO.cpp
+//
+//	Coded By:			agent						Date: 10/18/2026
+//	Revised By:			agent						Date: 10/18/2026
+
+void InitializeLineCache (void)
+
+{
+	LineCacheEntryPtr					lineCacheEntryPtr;
+	
+	SInt16								index;
+	
+	
+	for (index=0; index<kLineCacheHashSize; index++)
+		gLineCache.hashBuckets[index] = -1;
+	
+	lineCacheEntryPtr = gLineCache.entries;
+	for (index=0; index<kLineCacheNumberEntries; index++)
+		{
+		lineCacheEntryPtr->count = 0;
+		lineCacheEntryPtr->fileIndex = -1;
+		lineCacheEntryPtr->hashNext = -1;
+		lineCacheEntryPtr->lruPrevious = index - 1;
+		lineCacheEntryPtr->lruNext = index + 1;
+		
+		lineCacheEntryPtr++;
+		
+		}	// end "for (index=0; index<kLineCacheNumberEntries; index++)"
+		
+	gLineCache.entries[kLineCacheNumberEntries-1].lruNext = -1;
+	
+	gLineCache.lruFirst = 0;
+	gLineCache.lruLast = kLineCacheNumberEntries - 1;
+	
+	gLineCache.initializedFlag = TRUE;
+	
+}	// end "InitializeLineCache"
+
+
+
 //------------------------------------------------------------------------------------
 //                   Copyright 1988-2020 Purdue Research Foundation
 //
@@ -8814,34 +9554,121 @@ Boolean	LoadNewErdasHeader (
 //------------------------------------------------------------------------------------
 //                   Copyright 1988-2020 Purdue Research Foundation
 //
-//	Function name:		SInt16 MDeleteFile
+//	Function name:		void MoveLineCacheEntry
 //
-//	Software purpose:	The purpose of this routine is to delete the specified file.
+//	Software purpose:	The purpose of this routine is to move the input entry in the
+//							shared line cache to the most recently used end of the list or
+//							to the least recently used end where it will be the next one
+//							to be replaced.
 //
-//	Parameters in:		None
+//	Parameters in:		Index of the entry
+//							Flag indicating whether the entry is to be moved to the least
+//								recently used end
 //
 //	Parameters out:	None
 //
-// Value Returned:	Error code for file operations.
+//	Value Returned:	None
 //
-// Called By:			
+// Called By:			CopyFromLineCache in SFileIO.cpp
+//							ReleaseLineCacheEntries in SFileIO.cpp
+//							SaveToLineCache in SFileIO.cpp
 //
-//	Coded By:			Larry L. Biehl			Date: 08/15/2010
-//	Revised By:			Larry L. Biehl			Date: 08/16/2010
+//	Coded By:			agent						Date: 10/18/2026
+//	Revised By:			agent						Date: 10/18/2026
 
-SInt16 MDeleteFile (
-				CMFileStream* 						fileStreamPtr,
-				SInt16								messageCode)
+void MoveLineCacheEntry (
+				SInt16								entryIndex,
+				Boolean								lastFlag)
 
 {
-	SInt16								errCode = noErr;
+	LineCacheEntryPtr					lineCacheEntryPtr;
 	
-	if (fileStreamPtr != NULL)
+	
+	if ((lastFlag && gLineCache.lruLast == entryIndex) ||
+							(!lastFlag && gLineCache.lruFirst == entryIndex))
+																							return;
+	
+	lineCacheEntryPtr = &gLineCache.entries[entryIndex];
+	
+			// Remove the entry from the list.
+			
+	if (lineCacheEntryPtr->lruPrevious >= 0)
+		gLineCache.entries[lineCacheEntryPtr->lruPrevious].lruNext =
+																		lineCacheEntryPtr->lruNext;
+	else	// lineCacheEntryPtr->lruPrevious < 0
+		gLineCache.lruFirst = lineCacheEntryPtr->lruNext;
+	
+	if (lineCacheEntryPtr->lruNext >= 0)
+		gLineCache.entries[lineCacheEntryPtr->lruNext].lruPrevious =
+																	lineCacheEntryPtr->lruPrevious;
+	else	// lineCacheEntryPtr->lruNext < 0
+		gLineCache.lruLast = lineCacheEntryPtr->lruPrevious;
+	
+			// Put it back at the requested end.
+			
+	if (lastFlag)
 		{
-   	CloseFile (fileStreamPtr);
-   	
-		#if defined multispec_mac
-			SInt32								parID;
+		lineCacheEntryPtr->lruPrevious = gLineCache.lruLast;
+		lineCacheEntryPtr->lruNext = -1;
+		
+		if (gLineCache.lruLast >= 0)
+			gLineCache.entries[gLineCache.lruLast].lruNext = entryIndex;
+		else	// gLineCache.lruLast < 0
+			gLineCache.lruFirst = entryIndex;
+			
+		gLineCache.lruLast = entryIndex;
+		
+		}	// end "if (lastFlag)"
+		
+	else	// !lastFlag
+		{
+		lineCacheEntryPtr->lruPrevious = -1;
+		lineCacheEntryPtr->lruNext = gLineCache.lruFirst;
+		
+		if (gLineCache.lruFirst >= 0)
+			gLineCache.entries[gLineCache.lruFirst].lruPrevious = entryIndex;
+		else	// gLineCache.lruFirst < 0
+			gLineCache.lruLast = entryIndex;
+			
+		gLineCache.lruFirst = entryIndex;
+		
+		}	// end "else !lastFlag"
+	
+}	// end "MoveLineCacheEntry"
+
+
+
+//------------------------------------------------------------------------------------
+//                   Copyright 1988-2020 Purdue Research Foundation
+//
+//	Function name:		SInt16 MDeleteFile
+//
+//	Software purpose:	The purpose of this routine is to delete the specified file.
+//
+//	Parameters in:		None
+//
+//	Parameters out:	None
+//
+// Value Returned:	Error code for file operations.
+//
+// Called By:			
+//
+//	Coded By:			Larry L. Biehl			Date: 08/15/2010
+//	Revised By:			Larry L. Biehl			Date: 08/16/2010
+
+SInt16 MDeleteFile (
+				CMFileStream* 						fileStreamPtr,
+				SInt16								messageCode)
+
+{
+	SInt16								errCode = noErr;
+	
+	if (fileStreamPtr != NULL)
+		{
+   	CloseFile (fileStreamPtr);
+   	
+		#if defined multispec_mac
+			SInt32								parID;
 		
 			if (fileStreamPtr->fSSpecFlag)
 				parID = fileStreamPtr->parID;
@@ -9118,6 +9945,10 @@ SInt16 MWriteData (
 {  
 	SInt16								errCode;
 	
+	
+			// Make sure that no lines of this file stay in the shared line cache.
+			
+	ReleaseLineCacheFile (fileStreamPtr);
 	                  
 	#if defined multispec_mac
    	if (gHasHFSPlusAPIs) 
@@ -12841,6 +13672,110 @@ UInt32 PackMaskData (
 
 
 
+//------------------------------------------------------------------------------------
+//                   Copyright 1988-2020 Purdue Research Foundation
+//
+//	Function name:		UInt32 PackMaskRunData
+//
+//	Software purpose:	The purpose of this routine is to reduce the input line of data
+//							to just that requested by the mask information using the
+//							run length index for the mask line. The samples within each
+//							run are contiguous in the buffer and are moved as one block.
+//
+//	Parameters in:				
+//
+//	Parameters out:	Number of mask samples included in the buffer
+//
+//	Value Returned:	Number of mask samples included in the buffer
+//
+// Called By:			GetLineOfData in SFileIO.cpp
+//
+//	Coded By:			agent						Date: 10/18/2026
+//	Revised By:			agent						Date: 10/18/2026
+
+UInt32 PackMaskRunData (
+				MaskRunPtr							maskRunPtr,
+				UInt32								numberMaskRuns,
+				UInt32								maskColumnStart,
+				UInt32								numberChannels,
+				UInt32								numberInputSamples,
+				UInt32								columnInterval,
+				HUCharPtr							dataBufferPtr,
+				UInt32								numberOutBytes,
+				SInt32								maskValueRequest)
+
+{ 
+	HUCharPtr							inDataBufferPtr,
+											outDataBufferPtr;
+											
+	UInt32								columnEnd,
+											firstSample,
+											lastSample,
+											numberBytesToMove,
+											numberOutputSamples,
+											numberRunSamples,
+											run,
+											runColumnEnd,
+											runColumnStart;
+	
+	
+	if (numberInputSamples == 0)
+																							return (0);
+	
+	columnEnd = maskColumnStart + numberInputSamples - 1;
+	
+	outDataBufferPtr = dataBufferPtr;
+	numberBytesToMove = numberOutBytes * numberChannels;
+	numberOutputSamples = 0;
+	
+	for (run=0; run<numberMaskRuns; run++)
+		{
+		if (maskRunPtr->startColumn > columnEnd)
+			break;
+			
+		if (maskValueRequest == 0 || (SInt32)maskRunPtr->maskValue == maskValueRequest)
+			{
+			runColumnStart = MAX (maskRunPtr->startColumn, maskColumnStart);
+			runColumnEnd = MIN (maskRunPtr->endColumn, columnEnd);
+			
+			if (runColumnStart <= runColumnEnd)
+				{
+						// Get the first and last input samples that fall within the run
+						// allowing for the column interval.
+						
+				firstSample = (runColumnStart - maskColumnStart + columnInterval - 1) /
+																						columnInterval;
+				lastSample = (runColumnEnd - maskColumnStart) / columnInterval;
+				
+				if (firstSample <= lastSample)
+					{
+					numberRunSamples = lastSample - firstSample + 1;
+					inDataBufferPtr = &dataBufferPtr[firstSample * numberBytesToMove];
+					
+					if (inDataBufferPtr != outDataBufferPtr)
+						BlockMoveData (inDataBufferPtr, 
+											outDataBufferPtr, 
+											numberRunSamples * numberBytesToMove);
+						
+					outDataBufferPtr += numberRunSamples * numberBytesToMove;
+					numberOutputSamples += numberRunSamples;
+					
+					}	// end "if (firstSample <= lastSample)"
+					
+				}	// end "if (runColumnStart <= runColumnEnd)"
+				
+			}	// end "if (maskValueRequest == 0 || ..."
+			
+		maskRunPtr++;
+			
+		}	// end "for (run=0; run<numberMaskRuns; run++)"
+		
+	return (numberOutputSamples);
+	      
+}	// end "PackMaskRunData"  
+
+
+
 //------------------------------------------------------------------------------------
 //                   Copyright 1988-2020 Purdue Research Foundation
 //
@@ -14379,161 +15314,920 @@ SInt16 PutFile (
 //------------------------------------------------------------------------------------
 //                   Copyright 1988-2020 Purdue Research Foundation
 //
-//	Function name:		void ResetOutputDirectory
+//	Function name:		void ReadAdjacentChannelStrips
 //
-//	Software purpose:	The purpose of this routine is to set the gOutputDirectory
-//							global wxString to empty. This routine is currently on used
-//							in the wxWidgets versions of MultiSpec.
-//							The CheckIfDirectoryIsWriteable routine will set this variable
-//							if needed.
+//	Software purpose:	The purpose of this routine is to continue reading the strips
+//							for the same block row of the following channels in a band
+//							sequential (planar) TIFF file with non-contiguous strips, as
+//							long as those strips directly follow the strip just read in
+//							the file. The strips are read into the block row cache for
+//							each channel so that the requests for those channels do not
+//							need to seek back to the file again. Only channels that have
+//							been set up for the current file IO instructions are read.
 //
-//	Parameters in:		None
+//	Parameters in:		Pointer to file information structure
+//							Pointer to file stream positioned at the end of the strip
+//							just read
+//							Channel (0 based) of the strip just read
+//							Line number in the file of the strip just read
+//							File position at the end of the strip just read
 //
 //	Parameters out:	None
 //
-// Value Returned:	None
+//	Value Returned:	None
 //
-// Called By:
+// Called By:			GetLine in SFileIO.cpp
 //
-//	Coded By:			Larry L. Biehl			Date: 12/12/2019
-//	Revised By:			Larry L. Biehl			Date: 12/12/2019
+//	Coded By:			agent						Date: 10/18/2026
+//	Revised By:			agent						Date: 10/18/2026
 
-void ResetOutputDirectory (void)
+void ReadAdjacentChannelStrips (
+				FileInfoPtr							fileInfoPtr,
+				CMFileStream*						fileStreamPtr,
+				SInt16								channelNumber,
+				UInt32								lineNumber,
+				SInt64								nextPosOff)
 
 {
-#if defined multispec_wx
-	gOutputDirectory = wxEmptyString;
-#endif
-
-}	// end "ResetOutputDirectory"
-
-
-
-//------------------------------------------------------------------------------------
-//                   Copyright 1988-2020 Purdue Research Foundation
-//
-//	Function name:		SInt16 ResolveAnyAliases
-//
-//	Software purpose:	The purpose of this routine is to resolve the input
-//							file aliases if the input file is an alias.
-//
-//	Parameters in:		Pointer to AppFile structure which contains the
-//											volume reference number and file name.
-//							Index in the list
-//
-//	Parameters out:				
-//
-// Value Returned:	None	
-// 
-// Called By:			GetImageNameFromSupportFile in SFileIO.cpp
-//							OpenFileReadOnly in SFileIO.cpp
-//
-//	Coded By:			Larry L. Biehl			Date: 09/08/1993
-//	Revised By:			Larry L. Biehl			Date: 02/27/2018
-
-SInt16 ResolveAnyAliases (
-				CMFileStream*						fileStreamPtr, 
-				Boolean*								wasAliasedFlagPtr)
-
-{							
-	SInt16								errCode = noErr;
+	BlockFormatPtr						blockFormatPtr;
+	HierarchalFileFormatPtr			hfaPtr;
 	
-	#if defined multispec_mac 
-		Boolean								targetIsFolderFlag = FALSE;
+	SInt32								slot;
+	
+	UInt32								blockIndex,
+											count,
+											nextChannel;
+	
+	SInt16								errCode;
+	
+	
+	if (fileInfoPtr->hfaPtr == NULL || fileInfoPtr->blockFormatPtr == NULL)
+																							return;
+	
+	for (nextChannel=channelNumber+1; 
+				nextChannel<fileInfoPtr->numberChannels; 
+						nextChannel++)
+		{
+		hfaPtr = &fileInfoPtr->hfaPtr[nextChannel];
+		
+		if (hfaPtr->numberBlocksRead == 0 || hfaPtr->blockHeight == 0)
+			break;
 		
+		blockIndex = nextChannel * hfaPtr->blocksPerChannel + 
+																(lineNumber-1)/hfaPtr->blockHeight;
+		blockFormatPtr = &fileInfoPtr->blockFormatPtr[blockIndex];
 		
-		errCode = noErr;
-		*wasAliasedFlagPtr = FALSE;
-				
-		if (gAliasMgrPresentFlag)
+		if ((SInt64)blockFormatPtr->blockOffsetBytes != nextPosOff)
+			break;
+			
+		count = hfaPtr->numberBlocksRead * blockFormatPtr->blockSize;
+		
+		slot = ReserveBlockRowCacheSlot (fileInfoPtr, hfaPtr, nextPosOff, count);
+		if (slot < 0)
+			break;
+			
+		errCode = MReadData (fileStreamPtr, 
+										&count, 
+										hfaPtr->blockRowCachePtrs[slot], 
+										kNoErrorMessages);
+										
+		if (errCode != noErr || count != hfaPtr->blockRowCacheCount[slot])
 			{
-			if (fileStreamPtr->fSRefFlag)
-				{
-				errCode = FSResolveAliasFile (&fileStreamPtr->fsRef,
-													   	TRUE,
-															&targetIsFolderFlag,
-													   	wasAliasedFlagPtr);
-				
-				}	// end "if (fileStreamPtr->fSRefFlag)"
-				
-			else	// !fileStreamPtr->fSRefFlag
-				{
-						// Load a FSSpec record.													
-						
-				if (fileStreamPtr->fSSpecFlag)
-					{
-					gFileFSSpec.vRefNum = fileStreamPtr->vRefNum;
-					gFileFSSpec.parID = fileStreamPtr->parID;
-					CopyPToP (gFileFSSpec.name, fileStreamPtr->fileName);
-					
-					}	// end "if (fileInfoPtr->fSSpecFlag)" 
-													
-				else	// !fileInfoPtr->fSSpecFlag 
-					errCode = FSMakeFSSpec (fileStreamPtr->vRefNum,
-													0,
-													fileStreamPtr->fileName,
-													&gFileFSSpec);
-					
-				if (errCode == noErr)
-					errCode = ResolveAliasFile (&gFileFSSpec,
-															TRUE,
-															&targetIsFolderFlag,
-															wasAliasedFlagPtr);
-				
-				}	// end "else !fileStreamPtr->fSRefFlag"
+			hfaPtr->blockRowCacheCount[slot] = 0;
+			break;
 			
-			if (!targetIsFolderFlag && *wasAliasedFlagPtr && 
-														(errCode == noErr || errCode == fnfErr))
-				{						
-				fileStreamPtr->vRefNum = gFileFSSpec.vRefNum;
-				fileStreamPtr->parID = gFileFSSpec.parID;
-				CopyPToP (fileStreamPtr->fileName, gFileFSSpec.name);
-												
-				fileStreamPtr->fSSpecFlag = TRUE;
-				
-				}	// end "if (!targetIsFolderFlag && wasAliasedFlag && ...)" 
+			}	// end "if (errCode != noErr || ..."
 			
-			}	// end "if (gAliasMgrPresentFlag)"
-	#endif	// defined multispec_mac 
-
-   #if defined multispec_win || defined multispec_wx
-		*wasAliasedFlagPtr = FALSE;
-	#endif	// defined multispec_win || defined multispec_wx
+		nextPosOff += count;
 		
-	return (errCode);
-			
-}	// end "ResolveAnyAliases" 
+		}	// end "for (nextChannel=channelNumber+1; ..."
+	
+}	// end "ReadAdjacentChannelStrips"
 
 
 
 //------------------------------------------------------------------------------------
 //                   Copyright 1988-2020 Purdue Research Foundation
 //
-//	Function name:		void SetCFileName
+//	Function name:		Boolean ReadChannelLineBlock
 //
-//	Software purpose:	The purpose of this routine is to set the file name in the
-//							input file information structure to the new input c name.
+//	Software purpose:	The purpose of this routine is to copy the requested line for
+//							a channel of a band sequential file from the line block for
+//							that channel. If the line is not in the block, the block is
+//							refilled with one read of the following lines for the channel
+//							starting at the requested line. This replaces one seek and 
+//							read per channel per line with one per channel per block of 
+//							lines.
 //
-//	Parameters in:		None
+//	Parameters in:		Pointer to file IO instructions structure
+//							Pointer to file information structure
+//							Pointer to file stream
+//							Channel (0 based) in the file
+//							Line number in the file
+//							Position in file to start reading from
+//							Number of bytes to read
 //
-//	Parameters out:	None
+//	Parameters out:	Buffer to copy the bytes into
 //
-//	Value Returned:	None
-// 
-// Called By:		
+//	Value Returned:	TRUE if the bytes were copied into the buffer
+//							FALSE if the bytes need to be read from the file
 //
-//	Coded By:			Larry L. Biehl			Date: 11/28/2001
-//	Revised By:			Larry L. Biehl			Date: 04/12/2020
+// Called By:			GetLine in SFileIO.cpp
+//
+//	Coded By:			agent						Date: 10/18/2026
+//	Revised By:			agent						Date: 10/18/2026
 
-void SetCFileName (
+Boolean ReadChannelLineBlock (
+				FileIOInstructionsPtr			fileIOInstructionsPtr,
 				FileInfoPtr							fileInfoPtr,
-				FileStringPtr						inputFileNameCPtr)
+				CMFileStream*						fileStreamPtr,
+				SInt16								channelNumber,
+				UInt32								lineNumber,
+				SInt64								posOff,
+				UInt32								count,
+				HUCharPtr							bufferPtr)
 
-{  
-	CMFileStream*						fileStreamPtr;
+{
+	SInt64								maxReadCount;
 	
+	ChannelLineBlockPtr				channelLineBlockPtr;
+	HUCharPtr							blockBufferPtr;
 	
-	if (fileInfoPtr != NULL && inputFileNameCPtr != NULL)
+	UInt32								blockIndex,
+											index,
+											lineInterval,
+											lineStride,
+											readCount;
+	
+	SInt16								errCode;
+	
+	
+	channelLineBlockPtr = fileIOInstructionsPtr->channelLineBlockPtr;
+	
+	if (channelLineBlockPtr == NULL)
+																							return (FALSE);
+	
+	if (fileInfoPtr->bandInterleave != kBSQ && fileInfoPtr->bandInterleave != kBNonSQ)
+																							return (FALSE);
+	
+	if (fileInfoPtr->nonContiguousStripsFlag || 
+				fileInfoPtr->treatLinesAsBottomToTopFlag ||
+						fileInfoPtr->numberBits == 4 ||
+								fileInfoPtr->format == kGAIAType)
+																							return (FALSE);
+	
+			// Find the line block for this channel. If there is none, use the one
+			// used least recently.
+	
+	blockIndex = 0;
+	for (index=0; index<fileIOInstructionsPtr->numberChannelLineBlocks; index++)
+		{
+		if (channelLineBlockPtr[index].fileInfoPtr == fileInfoPtr &&
+							channelLineBlockPtr[index].channelNumber == channelNumber)
+			{
+			blockIndex = index;
+			break;
+			
+			}	// end "if (channelLineBlockPtr[index].fileInfoPtr == fileInfoPtr && ..."
+			
+		if (channelLineBlockPtr[index].lastUse < channelLineBlockPtr[blockIndex].lastUse)
+			blockIndex = index;
+		
+		}	// end "for (index=0; index<...->numberChannelLineBlocks; index++)"
+		
+	channelLineBlockPtr = &channelLineBlockPtr[blockIndex];
+	blockBufferPtr = &fileIOInstructionsPtr->channelLineBlockBufferPtr[
+									blockIndex * fileIOInstructionsPtr->channelLineBlockBytes];
+									
+	fileIOInstructionsPtr->channelLineBlockUseCount++;
+	channelLineBlockPtr->lastUse = fileIOInstructionsPtr->channelLineBlockUseCount;
+	
+	if (channelLineBlockPtr->fileInfoPtr == fileInfoPtr &&
+			channelLineBlockPtr->channelNumber == channelNumber &&
+				posOff >= channelLineBlockPtr->posOff && 
+					posOff + count <= channelLineBlockPtr->posOff + channelLineBlockPtr->count)
+		{
+		BlockMoveData (&blockBufferPtr[posOff - channelLineBlockPtr->posOff],
+							bufferPtr,
+							count);
+																							return (TRUE);
+		
+		}	// end "if (channelLineBlockPtr->fileInfoPtr == fileInfoPtr && ..."
+		
+			// Only read a block when adjacent lines are being requested and the
+			// requested bytes cover at least half of each line. Otherwise most of
+			// the bytes read into the block would not be used, for example when
+			// the image is sampled at a line interval for a display or when only
+			// a few columns of a wide image are requested.
+	
+	lineInterval = 1;
+	if (fileIOInstructionsPtr->lineInterval > 1)
+		lineInterval = fileIOInstructionsPtr->lineInterval;
+		
+	lineStride = fileInfoPtr->bytesPer1line1chan;
+	
+	if (lineInterval > 1 || 
+			(SInt64)count * 2 < lineStride ||
+				lineNumber >= fileInfoPtr->numberLines ||
+					(SInt64)lineStride + count > fileIOInstructionsPtr->channelLineBlockBytes)
+																							return (FALSE);
+	
+	maxReadCount = (SInt64)(fileInfoPtr->numberLines - lineNumber) * lineStride + count;
+	readCount = fileIOInstructionsPtr->channelLineBlockBytes;
+	if (maxReadCount < readCount)
+		readCount = (UInt32)maxReadCount;
+	
+	channelLineBlockPtr->count = 0;
+	
+	errCode = MSetMarker (fileStreamPtr, fsFromStart, posOff, kNoErrorMessages);
+	
+	if (errCode == noErr)
+		errCode = MReadData (fileStreamPtr, 
+										&readCount, 
+										blockBufferPtr, 
+										kNoErrorMessages);
+	
+	if (errCode == eofErr)
+		errCode = noErr;
+										
+	if (errCode != noErr || readCount < count)
+																							return (FALSE);
+	
+	channelLineBlockPtr->fileInfoPtr = fileInfoPtr;
+	channelLineBlockPtr->channelNumber = channelNumber;
+	channelLineBlockPtr->posOff = posOff;
+	channelLineBlockPtr->count = readCount;
+	
+	BlockMoveData (blockBufferPtr, bufferPtr, count);
+	
+	return (TRUE);
+	
+}	// end "ReadChannelLineBlock"
+
+
+
+//------------------------------------------------------------------------------------
+//                   Copyright 1988-2020 Purdue Research Foundation
+//
+//	Function name:		Boolean ReadFromSequentialBuffer
+//
+//	Software purpose:	The purpose of this routine is to copy the requested bytes
+//							from the sequential read-ahead buffer. If the bytes are not in
+//							the buffer and the requests are moving forward through the
+//							file, the buffer is filled with one large read starting at the
+//							requested position. Requests that jump around in the file or
+//							alternate between files are left for the normal read.
+//
+//	Parameters in:		Pointer to file IO instructions structure
+//							Pointer to file information structure
+//							Pointer to file stream
+//							Position in file to start reading from
+//							Number of bytes to read
+//
+//	Parameters out:	Buffer to copy the bytes into
+//
+//	Value Returned:	TRUE if the bytes were copied into the buffer
+//							FALSE if the bytes need to be read from the file
+//
+// Called By:			GetLine in SFileIO.cpp
+//
+//	Coded By:			agent						Date: 10/18/2026
+//	Revised By:			agent						Date: 10/18/2026
+
+Boolean ReadFromSequentialBuffer (
+				FileIOInstructionsPtr			fileIOInstructionsPtr,
+				FileInfoPtr							fileInfoPtr,
+				CMFileStream*						fileStreamPtr,
+				SInt64								posOff,
+				UInt32								count,
+				HUCharPtr							bufferPtr)
+
+{
+	SInt64								gap;
+	
+	UInt32								bytesRead;
+	
+	SInt16								errCode;
+	
+	
+	if (fileIOInstructionsPtr->sequentialBufferPtr == NULL ||
+								count > fileIOInstructionsPtr->sequentialBufferBytes)
+																							return (FALSE);
+	
+	if (fileIOInstructionsPtr->sequentialFileInfoPtr != fileInfoPtr)
+		{
+		fileIOInstructionsPtr->sequentialFileInfoPtr = fileInfoPtr;
+		fileIOInstructionsPtr->sequentialBytesInBuffer = 0;
+		fileIOInstructionsPtr->sequentialRequestCount = 0;
+		
+		}	// end "if (fileIOInstructionsPtr->sequentialFileInfoPtr != fileInfoPtr)"
+		
+			// Copy the bytes if they are already in the buffer.
+	
+	if (posOff >= fileIOInstructionsPtr->sequentialBufferPosOff && 
+			posOff + count <= fileIOInstructionsPtr->sequentialBufferPosOff + 
+										fileIOInstructionsPtr->sequentialBytesInBuffer)
+		{
+		BlockMoveData (&fileIOInstructionsPtr->sequentialBufferPtr[
+								posOff - fileIOInstructionsPtr->sequentialBufferPosOff],
+							bufferPtr,
+							count);
+							
+		fileIOInstructionsPtr->sequentialLastEnd = posOff + count;
+																							return (TRUE);
+		
+		}	// end "if (posOff >= ...->sequentialBufferPosOff && ..."
+		
+			// Only fill the buffer after two requests in a row that move forward
+			// through the file by less than half the size of the buffer.
+	
+	gap = posOff - fileIOInstructionsPtr->sequentialLastEnd;
+	if (fileIOInstructionsPtr->sequentialRequestCount > 0 &&
+			gap >= 0 && 
+				gap < fileIOInstructionsPtr->sequentialBufferBytes/2)
+		fileIOInstructionsPtr->sequentialRequestCount++;
+		
+	else	// request is not sequential
+		fileIOInstructionsPtr->sequentialRequestCount = 1;
+		
+	fileIOInstructionsPtr->sequentialLastEnd = posOff + count;
+	
+	if (fileIOInstructionsPtr->sequentialRequestCount < 2)
+																							return (FALSE);
+	
+	bytesRead = fileIOInstructionsPtr->sequentialBufferBytes;
+	errCode = MSetMarker (fileStreamPtr, fsFromStart, posOff, kNoErrorMessages);
+	
+	if (errCode == noErr)
+		errCode = MReadData (fileStreamPtr, 
+										&bytesRead, 
+										fileIOInstructionsPtr->sequentialBufferPtr, 
+										kNoErrorMessages);
+	
+			// The last buffer for the file will normally be a short read.
+			
+	if (errCode == eofErr)
+		errCode = noErr;
+										
+	if (errCode != noErr || bytesRead < count)
+		{
+		fileIOInstructionsPtr->sequentialBytesInBuffer = 0;
+																							return (FALSE);
+		
+		}	// end "if (errCode != noErr || bytesRead < count)"
+	
+	fileIOInstructionsPtr->sequentialBufferPosOff = posOff;
+	fileIOInstructionsPtr->sequentialBytesInBuffer = bytesRead;
+	
+	BlockMoveData (fileIOInstructionsPtr->sequentialBufferPtr, bufferPtr, count);
+	
+	return (TRUE);
+	
+}	// end "ReadFromSequentialBuffer"
+
+
+
+//------------------------------------------------------------------------------------
+//                   Copyright 1988-2020 Purdue Research Foundation
+//
+//	Function name:		void ReleaseLineCacheEntries
+//
+//	Software purpose:	The purpose of this routine is to release the memory for all
+//							of the entries in the shared line cache for the input file
+//							index and mark the file slot as unused.
+//
+//	Parameters in:		Index of the file in the shared line cache
+//
+//	Parameters out:	None
+//
+//	Value Returned:	None
+//
+// Called By:			GetLineCacheFileIndex in SFileIO.cpp
+//							ReleaseLineCacheFile in SFileIO.cpp
+//
+//	Coded By:			agent						Date: 10/18/2026
+//	Revised By:			agent						Date: 10/18/2026
+
+void ReleaseLineCacheEntries (
+				SInt16								fileIndex)
+
+{
+	LineCacheEntryPtr					lineCacheEntryPtr;
+	
+	SInt16								index;
+	
+	
+	if (fileIndex < 0 || fileIndex >= kLineCacheNumberFiles)
+																							return;
+	
+	lineCacheEntryPtr = gLineCache.entries;
+	for (index=0; index<kLineCacheNumberEntries; index++)
+		{
+		if (lineCacheEntryPtr->fileIndex == fileIndex && 
+														lineCacheEntryPtr->bufferBytes > 0)
+			{
+			RemoveLineCacheEntry (index);
+			
+			lineCacheEntryPtr->dataPtr = (HUCharPtr)CheckAndDisposePtr (
+																	(Ptr)lineCacheEntryPtr->dataPtr);
+			lineCacheEntryPtr->bufferBytes = 0;
+			
+			MoveLineCacheEntry (index, TRUE);
+			
+			}	// end "if (lineCacheEntryPtr->fileIndex == fileIndex && ..."
+			
+		lineCacheEntryPtr++;
+		
+		}	// end "for (index=0; index<kLineCacheNumberEntries; index++)"
+		
+	if (gLineCache.files[fileIndex].inUseFlag)
+		{
+		gLineCache.files[fileIndex].inUseFlag = FALSE;
+		gLineCache.files[fileIndex].serialNumber = 0;
+		gLineCache.numberFilesInUse--;
+		
+		}	// end "if (gLineCache.files[fileIndex].inUseFlag)"
+	
+}	// end "ReleaseLineCacheEntries"
+
+
+
+//------------------------------------------------------------------------------------
+//                   Copyright 1988-2020 Purdue Research Foundation
+//
+//	Function name:		void ReleaseLineCacheFile
+//
+//	Software purpose:	The purpose of this routine is to remove the file represented
+//							by the input file stream from the shared line cache. It is
+//							called when the file is closed or written to so that lines
+//							in the cache never go stale.
+//
+//	Parameters in:		Pointer to file stream
+//
+//	Parameters out:	None
+//
+//	Value Returned:	None
+//
+// Called By:			CloseFile in SFileIO.cpp
+//							MWriteData in SFileIO.cpp
+//
+//	Coded By:			agent						Date: 10/18/2026
+//	Revised By:			agent						Date: 10/18/2026
+
+void ReleaseLineCacheFile (
+				CMFileStream*						fileStreamPtr)
+
+{
+	if (gLineCache.numberFilesInUse > 0)
+		ReleaseLineCacheEntries (GetLineCacheFileIndex (fileStreamPtr, FALSE));
+	
+}	// end "ReleaseLineCacheFile"
+
+
+
+//------------------------------------------------------------------------------------
+//                   Copyright 1988-2020 Purdue Research Foundation
+//
+//	Function name:		void RemoveLineCacheEntry
+//
+//	Software purpose:	The purpose of this routine is to take the input entry in the
+//							shared line cache out of its hash bucket and mark it as empty.
+//							The memory for the data is kept for the next use of the entry.
+//
+//	Parameters in:		Index of the entry
+//
+//	Parameters out:	None
+//
+//	Value Returned:	None
+//
+// Called By:			ReleaseLineCacheEntries in SFileIO.cpp
+//							SaveToLineCache in SFileIO.cpp
+//
+//	Coded By:			agent						Date: 10/18/2026
+//	Revised By:			agent						Date: 10/18/2026
+
+void RemoveLineCacheEntry (
+				SInt16								entryIndex)
+
+{
+	LineCacheEntryPtr					lineCacheEntryPtr;
+	SInt16*								linkPtr;
+	
+	
+	lineCacheEntryPtr = &gLineCache.entries[entryIndex];
+	
+	if (lineCacheEntryPtr->count == 0)
+																							return;
+	
+	linkPtr = &gLineCache.hashBuckets[GetLineCacheHashIndex (
+									lineCacheEntryPtr->fileIndex, lineCacheEntryPtr->posOff)];
+	while (*linkPtr >= 0)
+		{
+		if (*linkPtr == entryIndex)
+			{
+			*linkPtr = lineCacheEntryPtr->hashNext;
+			break;
+			
+			}	// end "if (*linkPtr == entryIndex)"
+			
+		linkPtr = &gLineCache.entries[*linkPtr].hashNext;
+		
+		}	// end "while (*linkPtr >= 0)"
+		
+	lineCacheEntryPtr->hashNext = -1;
+	lineCacheEntryPtr->count = 0;
+	
+}	// end "RemoveLineCacheEntry"
+
+
+
+//------------------------------------------------------------------------------------
+//                   Copyright 1988-2020 Purdue Research Foundation
+//
+//	Function name:		SInt32 ReserveBlockRowCacheSlot
+//
+//	Software purpose:	The purpose of this routine is to get the slot in the block
+//							row cache for the input hierarchal file structure that is to
+//							hold the block row at the input file position. The number of
+//							slots used is limited so that the cache memory for all of the
+//							channel layers in the file stays within kBlockRowCacheBytes.
+//							The least recently used slot is replaced when all are in use.
+//							The slot is marked as holding the block row; the caller is
+//							to fill in the data.
+//
+//	Parameters in:		Pointer to file information structure
+//							Pointer to hierarchal file structure
+//							File position offset of the block row
+//							Number of bytes in the block row
+//
+//	Parameters out:	None
+//
+//	Value Returned:	Index of the slot to use
+//							-1 if the block row cannot be cached
+//
+// Called By:			ReadAdjacentChannelStrips in SFileIO.cpp
+//							SaveToBlockRowCache in SFileIO.cpp
+//
+//	Coded By:			agent						Date: 10/18/2026
+//	Revised By:			agent						Date: 10/18/2026
+
+SInt32 ReserveBlockRowCacheSlot (
+				FileInfoPtr							fileInfoPtr,
+				HierarchalFileFormatPtr			hfaPtr,
+				SInt64								posOff,
+				UInt32								count)
+
+{
+	UInt32								layerBytes,
+											numberLayers,
+											numberSlots,
+											slot,
+											useSlot;
+	
+	
+	if (count == 0)
+																							return (-1);
+	
+	numberLayers = 1;
+	if (fileInfoPtr->bandInterleave != kBIBlock && 
+												fileInfoPtr->bandInterleave != kBIS)
+		numberLayers = MAX (fileInfoPtr->numberChannels, 1);
+		
+	layerBytes = kBlockRowCacheBytes / numberLayers;
+	numberSlots = MIN (layerBytes/count, kBlockRowCacheNumberSlots);
+	
+	if (numberSlots == 0)
+																							return (-1);
+																					
+			// Find an empty slot or the least recently used slot.
+	
+	useSlot = 0;
+	for (slot=0; slot<numberSlots; slot++)
+		{
+		if (hfaPtr->blockRowCacheCount[slot] == 0)
+			{
+			useSlot = slot;
+			break;
+			
+			}	// end "if (hfaPtr->blockRowCacheCount[slot] == 0)"
+			
+		if (hfaPtr->blockRowCacheLastUse[slot] < 
+													hfaPtr->blockRowCacheLastUse[useSlot])
+			useSlot = slot;
+		
+		}	// end "for (slot=0; slot<numberSlots; slot++)"
+		
+	hfaPtr->blockRowCacheCount[useSlot] = 0;
+		
+	if (hfaPtr->blockRowCacheBytes[useSlot] < count)
+		{
+		hfaPtr->blockRowCachePtrs[useSlot] = (HUCharPtr)CheckAndDisposePtr (
+														(Ptr)hfaPtr->blockRowCachePtrs[useSlot]);
+		hfaPtr->blockRowCacheBytes[useSlot] = 0;
+		
+		hfaPtr->blockRowCachePtrs[useSlot] = (HUCharPtr)MNewPointer (count);
+		
+		if (hfaPtr->blockRowCachePtrs[useSlot] == NULL)
+																							return (-1);
+			
+		hfaPtr->blockRowCacheBytes[useSlot] = count;
+		
+		}	// end "if (hfaPtr->blockRowCacheBytes[useSlot] < count)"
+	
+	hfaPtr->blockRowCachePosOff[useSlot] = posOff;
+	hfaPtr->blockRowCacheCount[useSlot] = count;
+	
+	hfaPtr->blockRowCacheUseCount++;
+	hfaPtr->blockRowCacheLastUse[useSlot] = hfaPtr->blockRowCacheUseCount;
+	
+	return ((SInt32)useSlot);
+	
+}	// end "ReserveBlockRowCacheSlot"
+
+
+
+//------------------------------------------------------------------------------------
+//                   Copyright 1988-2020 Purdue Research Foundation
+//
+//	Function name:		void ResetOutputDirectory
+//
+//	Software purpose:	The purpose of this routine is to set the gOutputDirectory
+//							global wxString to empty. This routine is currently on used
+//							in the wxWidgets versions of MultiSpec.
+//							The CheckIfDirectoryIsWriteable routine will set this variable
+//							if needed.
+//
+//	Parameters in:		None
+//
+//	Parameters out:	None
+//
+// Value Returned:	None
+//
+// Called By:
+//
+//	Coded By:			Larry L. Biehl			Date: 12/12/2019
+//	Revised By:			Larry L. Biehl			Date: 12/12/2019
+
+void ResetOutputDirectory (void)
+
+{
+#if defined multispec_wx
+	gOutputDirectory = wxEmptyString;
+#endif
+
+}	// end "ResetOutputDirectory"
+
+
+
+//------------------------------------------------------------------------------------
+//                   Copyright 1988-2020 Purdue Research Foundation
+//
+//	Function name:		SInt16 ResolveAnyAliases
+//
+//	Software purpose:	The purpose of this routine is to resolve the input
+//							file aliases if the input file is an alias.
+//
+//	Parameters in:		Pointer to AppFile structure which contains the
+//											volume reference number and file name.
+//							Index in the list
+//
+//	Parameters out:				
+//
+// Value Returned:	None	
+// 
+// Called By:			GetImageNameFromSupportFile in SFileIO.cpp
+//							OpenFileReadOnly in SFileIO.cpp
+//
+//	Coded By:			Larry L. Biehl			Date: 09/08/1993
+//	Revised By:			Larry L. Biehl			Date: 02/27/2018
+
+SInt16 ResolveAnyAliases (
+				CMFileStream*						fileStreamPtr, 
+				Boolean*								wasAliasedFlagPtr)
+
+{							
+	SInt16								errCode = noErr;
+	
+	#if defined multispec_mac 
+		Boolean								targetIsFolderFlag = FALSE;
+		
+		
+		errCode = noErr;
+		*wasAliasedFlagPtr = FALSE;
+				
+		if (gAliasMgrPresentFlag)
+			{
+			if (fileStreamPtr->fSRefFlag)
+				{
+				errCode = FSResolveAliasFile (&fileStreamPtr->fsRef,
+													   	TRUE,
+															&targetIsFolderFlag,
+													   	wasAliasedFlagPtr);
+				
+				}	// end "if (fileStreamPtr->fSRefFlag)"
+				
+			else	// !fileStreamPtr->fSRefFlag
+				{
+						// Load a FSSpec record.													
+						
+				if (fileStreamPtr->fSSpecFlag)
+					{
+					gFileFSSpec.vRefNum = fileStreamPtr->vRefNum;
+					gFileFSSpec.parID = fileStreamPtr->parID;
+					CopyPToP (gFileFSSpec.name, fileStreamPtr->fileName);
+					
+					}	// end "if (fileInfoPtr->fSSpecFlag)" 
+													
+				else	// !fileInfoPtr->fSSpecFlag 
+					errCode = FSMakeFSSpec (fileStreamPtr->vRefNum,
+													0,
+													fileStreamPtr->fileName,
+													&gFileFSSpec);
+					
+				if (errCode == noErr)
+					errCode = ResolveAliasFile (&gFileFSSpec,
+															TRUE,
+															&targetIsFolderFlag,
+															wasAliasedFlagPtr);
+				
+				}	// end "else !fileStreamPtr->fSRefFlag"
+			
+			if (!targetIsFolderFlag && *wasAliasedFlagPtr && 
+														(errCode == noErr || errCode == fnfErr))
+				{						
+				fileStreamPtr->vRefNum = gFileFSSpec.vRefNum;
+				fileStreamPtr->parID = gFileFSSpec.parID;
+				CopyPToP (fileStreamPtr->fileName, gFileFSSpec.name);
+												
+				fileStreamPtr->fSSpecFlag = TRUE;
+				
+				}	// end "if (!targetIsFolderFlag && wasAliasedFlag && ...)" 
+			
+			}	// end "if (gAliasMgrPresentFlag)"
+	#endif	// defined multispec_mac 
+
+   #if defined multispec_win || defined multispec_wx
+		*wasAliasedFlagPtr = FALSE;
+	#endif	// defined multispec_win || defined multispec_wx
+		
+	return (errCode);
+			
+}	// end "ResolveAnyAliases" 
+
+
+
+//------------------------------------------------------------------------------------
+//                   Copyright 1988-2020 Purdue Research Foundation
+//
+//	Function name:		void SaveToBlockRowCache
+//
+//	Software purpose:	The purpose of this routine is to save a copy of the block row
+//							that was just read from disk in the block row cache for the
+//							input hierarchal file structure.
+//
+//	Parameters in:		Pointer to file information structure
+//							Pointer to hierarchal file structure
+//							File position offset of the block row
+//							Number of bytes in the block row
+//							Block row data
+//
+//	Parameters out:	None
+//
+//	Value Returned:	None
+//
+// Called By:			GetLine in SFileIO.cpp
+//
+//	Coded By:			agent						Date: 10/18/2026
+//	Revised By:			agent						Date: 10/18/2026
+
+void SaveToBlockRowCache (
+				FileInfoPtr							fileInfoPtr,
+				HierarchalFileFormatPtr			hfaPtr,
+				SInt64								posOff,
+				UInt32								count,
+				HUCharPtr							bufferPtr)
+
+{
+	SInt32								slot;
+	
+	
+	slot = ReserveBlockRowCacheSlot (fileInfoPtr, hfaPtr, posOff, count);
+	
+	if (slot >= 0)
+		BlockMoveData (bufferPtr, hfaPtr->blockRowCachePtrs[slot], count);
+	
+}	// end "SaveToBlockRowCache"
+
+
+
+//------------------------------------------------------------------------------------
+//                   Copyright 1988-2020 Purdue Research Foundation
+//
+//	Function name:		void SaveToLineCache
+//
+//	Software purpose:	The purpose of this routine is to save a copy of the bytes
+//							just read from the file in the shared line cache. The entry at
+//							the least recently used end of the list is used; empty entries
+//							are kept there. Low priority entries are left at that end so
+//							that a sequential pass through the whole image only replaces
+//							its own lines.
+//
+//	Parameters in:		Index of the file in the shared line cache
+//							File position offset of the bytes
+//							Number of bytes
+//							Bytes read from the file
+//							Flag indicating whether the entry is low priority
+//
+//	Parameters out:	None
+//
+//	Value Returned:	None
+//
+// Called By:			GetLine in SFileIO.cpp
+//
+//	Coded By:			agent						Date: 10/18/2026
+//	Revised By:			agent						Date: 10/18/2026
+
+void SaveToLineCache (
+				SInt16								fileIndex,
+				SInt64								posOff,
+				UInt32								count,
+				HUCharPtr							bufferPtr,
+				Boolean								lowPriorityFlag)
+
+{
+	LineCacheEntryPtr					lineCacheEntryPtr;
+	
+	UInt32								hashIndex;
+	
+	SInt16								entryIndex;
+	
+	
+	if (fileIndex < 0 || count == 0 || count > kLineCacheEntryBytesLimit)
+																							return;
+	
+	entryIndex = gLineCache.lruLast;
+	RemoveLineCacheEntry (entryIndex);
+	
+	lineCacheEntryPtr = &gLineCache.entries[entryIndex];
+	
+	if (lineCacheEntryPtr->bufferBytes < count)
+		{
+		lineCacheEntryPtr->dataPtr = (HUCharPtr)CheckAndDisposePtr (
+																	(Ptr)lineCacheEntryPtr->dataPtr);
+		lineCacheEntryPtr->bufferBytes = 0;
+		
+		lineCacheEntryPtr->dataPtr = (HUCharPtr)MNewPointer (count);
+		if (lineCacheEntryPtr->dataPtr == NULL)
+																							return;
+																							
+		lineCacheEntryPtr->bufferBytes = count;
+		
+		}	// end "if (lineCacheEntryPtr->bufferBytes < count)"
+		
+	BlockMoveData (bufferPtr, lineCacheEntryPtr->dataPtr, count);
+	
+	lineCacheEntryPtr->posOff = posOff;
+	lineCacheEntryPtr->count = count;
+	lineCacheEntryPtr->fileIndex = fileIndex;
+	
+	hashIndex = GetLineCacheHashIndex (fileIndex, posOff);
+	lineCacheEntryPtr->hashNext = gLineCache.hashBuckets[hashIndex];
+	gLineCache.hashBuckets[hashIndex] = entryIndex;
+	
+	MoveLineCacheEntry (entryIndex, lowPriorityFlag);
+	
+}	// end "SaveToLineCache"
+
+
+
+//------------------------------------------------------------------------------------
+//                   Copyright 1988-2020 Purdue Research Foundation
+//
+//	Function name:		void SetCFileName
+//
+//	Software purpose:	The purpose of this routine is to set the file name in the
+//							input file information structure to the new input c name.
+//
+//	Parameters in:		None
+//
+//	Parameters out:	None
+//
+//	Value Returned:	None
+// 
+// Called By:		
+//
+//	Coded By:			Larry L. Biehl			Date: 11/28/2001
+//	Revised By:			Larry L. Biehl			Date: 04/12/2020
+
+void SetCFileName (
+				FileInfoPtr							fileInfoPtr,
+				FileStringPtr						inputFileNameCPtr)
+
+{  
+	CMFileStream*						fileStreamPtr;
+	
+	
+	if (fileInfoPtr != NULL && inputFileNameCPtr != NULL)
 		{
 		fileStreamPtr = GetFileStreamPointer (fileInfoPtr);
 		
@@ -14777,7 +16471,7 @@ SInt16 SetFileSizeToZero (
 //							SetFileSizeToZero in SFileIO.cpp
 //
 //	Coded By:			Larry L. Biehl			Date: 09/10/1992
-//	Revised By:			Larry L. Biehl			Date: 02/09/2008
+//	Revised By:			agent						Date: 10/18/2026
 
 SInt16 SetFileWriteEnabled (
 				CMFileStream* 						fileStreamPtr)
@@ -14786,6 +16480,14 @@ SInt16 SetFileWriteEnabled (
 	SInt16								errCode;
 	
 	
+	#if defined multispec_wx
+				// Gzip compressed files are read as if they were not compressed so
+				// they cannot be changed in place. Leave the file open for reading.
+				
+		if (fileStreamPtr->CheckIfGzipFile ())
+																				return (fLckdErr);
+	#endif	// defined multispec_wx
+	
 			// First close the file
 			
 	CloseFile (fileStreamPtr);
@@ -15000,6 +16702,106 @@ void SetType (
 
 
 
+//------------------------------------------------------------------------------------
+//                   Copyright 1988-2020 Purdue Research Foundation
+//
+//	Function name:		void SetUpChannelLineBlocks
+//
+//	Software purpose:	The purpose of this routine is to set up a line block for 
+//							each channel to be read when the image is band sequential.
+//							The memory is divided evenly between the channels. If the
+//							memory is not available, the lines are read one at a time.
+//							This is only called for processors that make a pass through
+//							every line of the area to a new output. The blocks are only
+//							refilled when adjacent lines are being read; see 
+//							ReadChannelLineBlock.
+//
+//	Parameters in:		Pointer to file IO instructions structure
+//
+//	Parameters out:	None
+//
+//	Value Returned:	None
+//
+// Called By:			ClassifyAreasControl in SClassify.cpp
+//							ClassifyBatchTargetImages in SClassify.cpp
+//							HistogramStats in SHistogram.cpp
+//							ChangeImageFormat in SReformatChangeImageFileFormat.cpp
+//
+//	Coded By:			agent						Date: 10/18/2026
+//	Revised By:			agent						Date: 10/18/2026
+
+void SetUpChannelLineBlocks (
+				FileIOInstructionsPtr			fileIOInstructionsPtr)
+
+{
+	FileInfoPtr							fileInfoPtr;
+	WindowInfoPtr						windowInfoPtr;
+	
+	UInt32								blockBytes,
+											index,
+											numberListChannels;
+	
+	SInt16								bandInterleave;
+	
+	
+	if (fileIOInstructionsPtr == NULL ||
+								fileIOInstructionsPtr->channelLineBlockPtr != NULL)
+																							return;
+	
+	fileInfoPtr = fileIOInstructionsPtr->fileInfoPtr;
+	windowInfoPtr = fileIOInstructionsPtr->windowInfoPtr;
+	numberListChannels = fileIOInstructionsPtr->numberChannels;
+	
+	if (fileInfoPtr == NULL || numberListChannels <= 1)
+																							return;
+	
+	bandInterleave = fileInfoPtr->bandInterleave;
+	if (windowInfoPtr != NULL)
+		bandInterleave = windowInfoPtr->bandInterleave;
+		
+	if (bandInterleave != kBSQ && 
+				bandInterleave != kBNonSQ && 
+						bandInterleave != kMixed)
+																							return;
+	
+			// Force the bytes for each block to be a multiple of 8 bytes.
+			
+	blockBytes = (kChannelLineBlockBytes/numberListChannels/8) * 8;
+	
+	fileIOInstructionsPtr->channelLineBlockPtr = (ChannelLineBlockPtr)MNewPointer (
+								(SInt64)numberListChannels * sizeof (ChannelLineBlock));
+	
+	if (fileIOInstructionsPtr->channelLineBlockPtr != NULL)
+		fileIOInstructionsPtr->channelLineBlockBufferPtr = (HUCharPtr)MNewPointer (
+														(SInt64)numberListChannels * blockBytes);
+	
+	if (fileIOInstructionsPtr->channelLineBlockBufferPtr == NULL)
+		{
+		fileIOInstructionsPtr->channelLineBlockPtr = 
+				(ChannelLineBlockPtr)CheckAndDisposePtr (
+										(Ptr)fileIOInstructionsPtr->channelLineBlockPtr);
+																							return;
+		
+		}	// end "if (...->channelLineBlockBufferPtr == NULL)"
+		
+	for (index=0; index<numberListChannels; index++)
+		{
+		fileIOInstructionsPtr->channelLineBlockPtr[index].posOff = 0;
+		fileIOInstructionsPtr->channelLineBlockPtr[index].fileInfoPtr = NULL;
+		fileIOInstructionsPtr->channelLineBlockPtr[index].count = 0;
+		fileIOInstructionsPtr->channelLineBlockPtr[index].lastUse = 0;
+		fileIOInstructionsPtr->channelLineBlockPtr[index].channelNumber = -1;
+		
+		}	// end "for (index=0; index<numberListChannels; index++)"
+	
+	fileIOInstructionsPtr->channelLineBlockBytes = blockBytes;
+	fileIOInstructionsPtr->channelLineBlockUseCount = 0;
+	fileIOInstructionsPtr->numberChannelLineBlocks = numberListChannels;
+	
+}	// end "SetUpChannelLineBlocks"
+
+
+
 //------------------------------------------------------------------------------------
 //                   Copyright 1988-2020 Purdue Research Foundation
 //
@@ -15297,6 +17099,25 @@ SInt16 SetUpFileIOInstructions (
 								(HUInt16Ptr)GetHandlePointer (
 													areaDescriptionPtr->maskInfoPtr->maskHandle,
 													kLock);
+		
+		fileIOInstructionsPtr->maskBufferStartPtr = fileIOInstructionsPtr->maskBufferPtr;
+		fileIOInstructionsPtr->numberMaskBufferColumns = 
+										areaDescriptionPtr->maskInfoPtr->numberColumns + 1;
+		
+				// Get the run length index for the mask if it is available.
+				
+		fileIOInstructionsPtr->maskLineRunIndexPtr = 
+								(HUInt32Ptr)GetHandlePointer (
+									areaDescriptionPtr->maskInfoPtr->maskLineRunIndexHandle,
+									kLock);
+		
+		fileIOInstructionsPtr->maskRunPtr = 
+								(MaskRunPtr)GetHandlePointer (
+													areaDescriptionPtr->maskInfoPtr->maskRunHandle,
+													kLock);
+		
+		if (fileIOInstructionsPtr->maskRunPtr == NULL)
+			fileIOInstructionsPtr->maskLineRunIndexPtr = NULL;
 								
 		fileIOInstructionsPtr->maskBufferPtr += 
 					(areaDescriptionPtr->maskLineStart - 1) * 
@@ -15356,7 +17177,7 @@ SInt16 SetUpFileIOInstructions (
 // Called By:			
 //
 //	Coded By:			Larry L. Biehl			Date: 10/14/1999
-//	Revised By:			Larry L. Biehl			Date: 11/26/2007
+//	Revised By:			agent						Date: 10/18/2026
 
 void SetUpGeneralFileIOInstructions (
 				FileIOInstructionsPtr			fileIOInstructionsPtr,
@@ -15407,6 +17228,33 @@ void SetUpGeneralFileIOInstructions (
 	fileIOInstructionsPtr->callPackLineOfDataFlag = FALSE;
 	fileIOInstructionsPtr->differentBuffersFlag = FALSE;
 	
+			// The read-ahead buffer is only allocated by SetUpSequentialReadBuffer.
+			// The structure may be on the stack, so make sure none is indicated.
+	
+	fileIOInstructionsPtr->sequentialBufferPtr = NULL;
+	fileIOInstructionsPtr->sequentialFileInfoPtr = NULL;
+	fileIOInstructionsPtr->sequentialBufferPosOff = 0;
+	fileIOInstructionsPtr->sequentialLastEnd = 0;
+	fileIOInstructionsPtr->sequentialBufferBytes = 0;
+	fileIOInstructionsPtr->sequentialBytesInBuffer = 0;
+	fileIOInstructionsPtr->sequentialRequestCount = 0;
+	
+			// Likewise the channel line blocks are only allocated by
+			// SetUpChannelLineBlocks.
+	
+	fileIOInstructionsPtr->channelLineBlockPtr = NULL;
+	fileIOInstructionsPtr->channelLineBlockBufferPtr = NULL;
+	fileIOInstructionsPtr->channelLineBlockBytes = 0;
+	fileIOInstructionsPtr->channelLineBlockUseCount = 0;
+	fileIOInstructionsPtr->numberChannelLineBlocks = 0;
+	
+			// The links to the shared line cache are made as the lines are read.
+			// Lines are added to the cache with low priority only for processors
+			// that call SetUpSequentialReadBuffer.
+	
+	fileIOInstructionsPtr->numberLineCacheStreams = 0;
+	fileIOInstructionsPtr->lineCacheLowPriorityFlag = FALSE;
+	
 	returnCode = SetUpDataConversionCode (layerInfoPtr,
 														fileInfoPtr,
 														numberListChannels,
@@ -15647,6 +17495,70 @@ void SetUpHeirarchalFileIOParameters (
 
 
 
+//------------------------------------------------------------------------------------
+//                   Copyright 1988-2020 Purdue Research Foundation
+//
+//	Function name:		void SetUpSequentialReadBuffer
+//
+//	Software purpose:	The purpose of this routine is to allocate the read-ahead
+//							buffer for processors that make a sequential pass through
+//							the whole image. Lines of files that are not blocked are then
+//							sliced out of a few large reads instead of being read one at
+//							a time. If the memory is not available, the lines are read
+//							as before. The buffer is released in 
+//							CloseUpGeneralFileIOInstructions.
+//							The read-ahead is not a dialog option. It is set up for each
+//							classify, histogram and change-format-to-new-file job, and
+//							ReadFromSequentialBuffer only fills the buffer once the
+//							requests for that job move forward through the file. Jobs
+//							that jump around in the file read lines one at a time as
+//							before. Changing a file in place does not call this routine
+//							since the output is written back into the input file.
+//
+//	Parameters in:		Pointer to file IO instructions structure
+//
+//	Parameters out:	None
+//
+//	Value Returned:	None
+//
+// Called By:			ClassifyAreasControl in SClassify.cpp
+//							HistogramStats in SHistogram.cpp
+//							ChangeImageFormat in SReformatChangeImageFileFormat.cpp
+//
+//	Coded By:			agent						Date: 10/18/2026
+//	Revised By:			agent						Date: 10/18/2026
+
+void SetUpSequentialReadBuffer (
+				FileIOInstructionsPtr			fileIOInstructionsPtr)
+
+{
+	if (fileIOInstructionsPtr == NULL)
+																							return;
+	
+			// Lines read during the pass are not to push the lines used by the
+			// image windows out of the shared line cache.
+			
+	fileIOInstructionsPtr->lineCacheLowPriorityFlag = TRUE;
+	
+	if (fileIOInstructionsPtr->sequentialBufferPtr != NULL)
+																							return;
+	
+	fileIOInstructionsPtr->sequentialBufferPtr = 
+							(HUCharPtr)MNewPointer (kSequentialReadBufferBytes);
+	
+	if (fileIOInstructionsPtr->sequentialBufferPtr != NULL)
+		fileIOInstructionsPtr->sequentialBufferBytes = kSequentialReadBufferBytes;
+	
+	fileIOInstructionsPtr->sequentialFileInfoPtr = NULL;
+	fileIOInstructionsPtr->sequentialBufferPosOff = 0;
+	fileIOInstructionsPtr->sequentialLastEnd = 0;
+	fileIOInstructionsPtr->sequentialBytesInBuffer = 0;
+	fileIOInstructionsPtr->sequentialRequestCount = 0;
+	
+}	// end "SetUpSequentialReadBuffer"
+
+
+
 //------------------------------------------------------------------------------------
 //                   Copyright 1988-2020 Purdue Research Foundation
 //
@@ -18,7 +18,7 @@
 //
 //	Authors:					Larry L. Biehl
 //
-//	Revision date:			11/13/2019
+//	Revision date:			10/18/2026
 //
 //	Language:				C
 //
@@ -1218,7 +1218,7 @@ Boolean GetThematicType (
 //							... and many others
 //
 //	Coded By:			Larry L. Biehl			Date: 03/05/1991
-//	Revised By:			Larry L. Biehl			Date: 07/10/2018
+//	Revised By:			agent						Date: 10/18/2026
 
 Handle InitializeFileInfoStructure (
 				Handle								fileInfoHandle,
@@ -1371,6 +1371,7 @@ Handle InitializeFileInfoStructure (
 		fileInfoPtr->descriptionsFlag = FALSE;
 		fileInfoPtr->treatLinesAsBottomToTopFlag = FALSE;
 		fileInfoPtr->groupChangedFlag = FALSE;
+		fileInfoPtr->multiSpecHeaderFileFlag = FALSE;
 		fileInfoPtr->nonContiguousStripsFlag = FALSE;
 		fileInfoPtr->noDataValueFlag = FALSE;
 		fileInfoPtr->signedDataFlag = FALSE;
@@ -1420,7 +1421,8 @@ Handle InitializeHierarchalFileStructure (
 	Ptr									ptr;
 	
 	UInt32								index,
-											numberBytes;
+											numberBytes,
+											slot;
 	
 	SignedByte							handleStatus;
 	
@@ -1468,6 +1470,18 @@ Handle InitializeHierarchalFileStructure (
 			hfaPtr->firstColumnRead = 0;
 			hfaPtr->lastColumnRead = 0;
 			
+			for (slot=0; slot<kBlockRowCacheNumberSlots; slot++)
+				{
+				hfaPtr->blockRowCachePtrs[slot] = NULL;
+				hfaPtr->blockRowCachePosOff[slot] = 0;
+				hfaPtr->blockRowCacheBytes[slot] = 0;
+				hfaPtr->blockRowCacheCount[slot] = 0;
+				hfaPtr->blockRowCacheLastUse[slot] = 0;
+				
+				}	// end "for (slot=0; slot<kBlockRowCacheNumberSlots; slot++)"
+				
+			hfaPtr->blockRowCacheUseCount = 0;
+			
 			hfaPtr++;
 			
 			}	// end "for (index=0; index<..."
@@ -19,7 +19,7 @@
 //
 //	Authors:					Larry L. Biehl
 //
-//	Revision date:			04/11/2020
+//	Revision date:			10/18/2026
 //
 //	Language:				C++
 //
@@ -45,6 +45,8 @@
 #include "SImageWindow_class.h"
 							  
 #if defined multispec_wx
+	#include <zlib.h>
+	
 	#define dupFNErr				-48
 #endif	// defined multispec_wx
 
@@ -271,15 +273,274 @@ CMFileStream::CMFileStream (
 // Called By:	
 //
 //	Coded By:			Larry L. Biehl			Date: 06/05/1995
-//	Revised By:			Larry L. Biehl			Date: 02/26/1997	
+//	Revised By:			agent						Date: 10/18/2026	
 
 CMFileStream::~CMFileStream ()
 
 {               
+	#if defined multispec_wx
+		DisposeGzipIndex ();
+	#endif	// defined multispec_wx
 
 }	// end "~CMFileStream" 
 
 
+//------------------------------------------------------------------------------------
+//                   Copyright 1988-2020 Purdue Research Foundation
+//
+//	Function name:		SInt16 BuildGzipIndex
+//
+//	Software purpose:	The purpose of this routine is to make one pass through the
+//							gzip compressed file to find the uncompressed size and to save
+//							a checkpoint about every kGzipCheckpointSpan uncompressed bytes
+//							so that reads can start near any position in the file. Files
+//							made up of more than one gzip member are allowed.
+//
+//	Parameters in:		None
+//
+//	Parameters out:	None
+//
+//	Value Returned:	Error code
+//
+// Called By:			SetUpGzipIndex
+//
+//	Coded By:			agent						Date: 10/18/2026
+//	Revised By:			agent						Date: 10/18/2026
+
+#if defined multispec_wx
+SInt16 CMFileStream::BuildGzipIndex (void)
+
+{
+	z_stream								stream;
+	
+	SInt64								lastOut,
+											totalIn,
+											totalOut;
+	
+	GzipCheckpointPtr					checkpointPtr,
+											newCheckpointPtr;
+	HUCharPtr							newWindowsPtr,
+											windowBufferPtr,
+											windowPtr;
+	
+	ssize_t								bytesRead;
+	
+	UInt32								left,
+											maxNumberCheckpoints;
+	
+	int									inflateReturn;
+	
+	SInt16								errCode = noErr;
+	
+	Boolean								streamEndFlag;
+	
+	
+	memset (&stream, 0, sizeof (z_stream));
+	if (inflateInit2 (&stream, 47) != Z_OK)
+																							return (-1);
+	
+	windowBufferPtr = (HUCharPtr)MNewPointer (kGzipWindowBytes);
+	if (windowBufferPtr == NULL || Seek (0, wxFromStart) == wxInvalidOffset)
+		errCode = -1;
+	
+	maxNumberCheckpoints = 0;
+	totalIn = totalOut = lastOut = 0;
+	streamEndFlag = FALSE;
+	stream.avail_out = 0;
+	
+	while (errCode == noErr)
+		{
+		if (stream.avail_in == 0)
+			{
+			bytesRead = Read (mGzipIndexPtr->inputBufferPtr, kGzipInputBufferBytes);
+			
+					// The end of the file is only allowed after a complete member.
+					
+			if (bytesRead == wxInvalidOffset || (bytesRead == 0 && !streamEndFlag))
+				errCode = -1;
+				
+			if (bytesRead <= 0)
+				break;
+				
+			stream.next_in = mGzipIndexPtr->inputBufferPtr;
+			stream.avail_in = (uInt)bytesRead;
+			
+			}	// end "if (stream.avail_in == 0)"
+			
+				// The uncompressed data goes into a circular buffer which holds the
+				// dictionary window for the next checkpoint.
+			
+		if (stream.avail_out == 0)
+			{
+			stream.next_out = windowBufferPtr;
+			stream.avail_out = kGzipWindowBytes;
+			
+			}	// end "if (stream.avail_out == 0)"
+			
+		totalIn += stream.avail_in;
+		totalOut += stream.avail_out;
+		inflateReturn = inflate (&stream, Z_BLOCK);
+		totalIn -= stream.avail_in;
+		totalOut -= stream.avail_out;
+		
+		if (inflateReturn == Z_STREAM_END)
+			{
+			streamEndFlag = TRUE;
+			inflateReset (&stream);
+			continue;
+			
+			}	// end "if (inflateReturn == Z_STREAM_END)"
+		
+				// Allow for padding after the last member.
+				
+		if (inflateReturn == Z_DATA_ERROR && streamEndFlag)
+			break;
+			
+		if (inflateReturn != Z_OK && inflateReturn != Z_BUF_ERROR)
+			{
+			errCode = -1;
+			break;
+			
+			}	// end "if (inflateReturn != Z_OK && ..."
+			
+		if (inflateReturn == Z_OK)
+			streamEndFlag = FALSE;
+		
+				// Add a checkpoint at the end of a deflate block that is not the
+				// last block in the member.
+				
+		if ((stream.data_type & 128) && !(stream.data_type & 64) &&
+				(totalOut == 0 || totalOut - lastOut > kGzipCheckpointSpan))
+			{
+			if (mGzipIndexPtr->numberCheckpoints == maxNumberCheckpoints)
+				{
+				maxNumberCheckpoints = MAX (2 * maxNumberCheckpoints, 16);
+				
+				newCheckpointPtr = (GzipCheckpointPtr)MNewPointer (
+									(SInt64)maxNumberCheckpoints * sizeof (GzipCheckpoint));
+				newWindowsPtr = (HUCharPtr)MNewPointer (
+									(SInt64)maxNumberCheckpoints * kGzipWindowBytes);
+				
+				if (newCheckpointPtr == NULL || newWindowsPtr == NULL)
+					{
+					CheckAndDisposePtr ((Ptr)newCheckpointPtr);
+					CheckAndDisposePtr ((Ptr)newWindowsPtr);
+					errCode = -1;
+					break;
+					
+					}	// end "if (newCheckpointPtr == NULL || ..."
+					
+				if (mGzipIndexPtr->numberCheckpoints > 0)
+					{
+					BlockMoveData (mGzipIndexPtr->checkpointPtr, 
+										newCheckpointPtr, 
+										mGzipIndexPtr->numberCheckpoints * sizeof (GzipCheckpoint));
+					BlockMoveData (mGzipIndexPtr->windowsPtr, 
+										newWindowsPtr, 
+										mGzipIndexPtr->numberCheckpoints * kGzipWindowBytes);
+					
+					}	// end "if (mGzipIndexPtr->numberCheckpoints > 0)"
+										
+				CheckAndDisposePtr ((Ptr)mGzipIndexPtr->checkpointPtr);
+				CheckAndDisposePtr ((Ptr)mGzipIndexPtr->windowsPtr);
+				mGzipIndexPtr->checkpointPtr = newCheckpointPtr;
+				mGzipIndexPtr->windowsPtr = newWindowsPtr;
+				
+				}	// end "if (...->numberCheckpoints == maxNumberCheckpoints)"
+				
+			checkpointPtr = 
+						&mGzipIndexPtr->checkpointPtr[mGzipIndexPtr->numberCheckpoints];
+			checkpointPtr->bits = stream.data_type & 7;
+			checkpointPtr->inOffset = totalIn;
+			checkpointPtr->outOffset = totalOut;
+			
+					// Unroll the circular buffer into the window for the checkpoint.
+					
+			windowPtr = &mGzipIndexPtr->windowsPtr[
+						(SInt64)mGzipIndexPtr->numberCheckpoints * kGzipWindowBytes];
+			left = stream.avail_out;
+			if (left > 0)
+				BlockMoveData (&windowBufferPtr[kGzipWindowBytes-left], windowPtr, left);
+			if (left < kGzipWindowBytes)
+				BlockMoveData (windowBufferPtr, &windowPtr[left], kGzipWindowBytes-left);
+			
+			mGzipIndexPtr->numberCheckpoints++;
+			lastOut = totalOut;
+			
+			}	// end "if ((stream.data_type & 128) && ..."
+		
+		}	// end "while (errCode == noErr)"
+		
+	inflateEnd (&stream);
+	CheckAndDisposePtr ((Ptr)windowBufferPtr);
+	
+	if (mGzipIndexPtr->numberCheckpoints == 0)
+		errCode = -1;
+	
+	mGzipIndexPtr->uncompressedSize = totalOut;
+	
+	return (errCode);
+	
+}	// end "BuildGzipIndex"
+#endif	// defined multispec_wx
+
+
+
+//------------------------------------------------------------------------------------
+//                   Copyright 1988-2020 Purdue Research Foundation
+//
+//	Function name:		Boolean CheckIfGzipFile
+//
+//	Software purpose:	The purpose of this routine is to check whether the file for
+//							this file stream starts with the gzip signature. Such files
+//							are only read; they cannot be changed in place since the
+//							offsets used are those of the uncompressed data.
+//
+//	Parameters in:		None
+//
+//	Parameters out:	None
+//
+//	Value Returned:	TRUE if the file is gzip compressed
+//							FALSE if not
+//
+// Called By:			MOpenFile
+//							SetFileWriteEnabled in SFileIO.cpp
+//
+//	Coded By:			agent						Date: 10/18/2026
+//	Revised By:			agent						Date: 10/18/2026
+
+#if defined multispec_wx
+Boolean CMFileStream::CheckIfGzipFile (void)
+
+{
+	UInt8									signature[3];
+	
+	wxFile								checkFile;
+	
+	Boolean								gzipFlag = FALSE;
+	
+	
+	if (mGzipIndexPtr != NULL)
+																							return (TRUE);
+	
+	if (GetWideFileStringLength (mWideFilePathName) > 0 && 
+				wxFile::Exists (wxString (&mWideFilePathName[1])) &&
+					checkFile.Open (wxString (&mWideFilePathName[1]), wxFile::read))
+		{
+		gzipFlag = (checkFile.Read (signature, 3) == 3 &&
+							signature[0] == 0x1f && signature[1] == 0x8b && signature[2] == 8);
+		
+		checkFile.Close ();
+		
+		}	// end "if (GetWideFileStringLength (mWideFilePathName) > 0 && ..."
+	
+	return (gzipFlag);
+	
+}	// end "CheckIfGzipFile"
+#endif	// defined multispec_wx
+
+
+
 //------------------------------------------------------------------------------------
 //                   Copyright 1988-2020 Purdue Research Foundation
 //
@@ -309,6 +570,54 @@ void CMFileStream::DisposeFilePath (
 
 
 
+//------------------------------------------------------------------------------------
+//                   Copyright 1988-2020 Purdue Research Foundation
+//
+//	Function name:		void DisposeGzipIndex
+//
+//	Software purpose:	The purpose of this routine is to release the memory for the
+//							gzip index and inflation state, if any.
+//
+//	Parameters in:		None
+//
+//	Parameters out:	None
+//
+//	Value Returned:	None
+//
+// Called By:			~CMFileStream
+//							MCloseFile
+//							SetUpGzipIndex
+//
+//	Coded By:			agent						Date: 10/18/2026
+//	Revised By:			agent						Date: 10/18/2026
+
+#if defined multispec_wx
+void CMFileStream::DisposeGzipIndex (void)
+
+{
+	if (mGzipIndexPtr != NULL)
+		{
+		if (mGzipIndexPtr->streamPtr != NULL)
+			{
+			inflateEnd ((z_stream*)mGzipIndexPtr->streamPtr);
+			CheckAndDisposePtr ((Ptr)mGzipIndexPtr->streamPtr);
+			
+			}	// end "if (mGzipIndexPtr->streamPtr != NULL)"
+			
+		CheckAndDisposePtr ((Ptr)mGzipIndexPtr->checkpointPtr);
+		CheckAndDisposePtr ((Ptr)mGzipIndexPtr->windowsPtr);
+		CheckAndDisposePtr ((Ptr)mGzipIndexPtr->inputBufferPtr);
+		CheckAndDisposePtr ((Ptr)mGzipIndexPtr->skipBufferPtr);
+		
+		mGzipIndexPtr = (GzipIndexPtr)CheckAndDisposePtr ((Ptr)mGzipIndexPtr);
+		
+		}	// end "if (mGzipIndexPtr != NULL)"
+	
+}	// end "DisposeGzipIndex"
+#endif	// defined multispec_wx
+
+
+
 //------------------------------------------------------------------------------------
 //                   Copyright 1988-2020 Purdue Research Foundation
 //
@@ -976,6 +1285,53 @@ UInt16 CMFileStream::GetFileUTF8PathLength ()
 
 
 
+//------------------------------------------------------------------------------------
+//                   Copyright 1988-2020 Purdue Research Foundation
+//
+//	Function name:		wxString GetGzipIndexPath
+//
+//	Software purpose:	The purpose of this routine is to get the path of the file
+//							used to save the gzip index for this file between sessions.
+//							It is kept in the temporary directory rather than next to the
+//							image file. The name is made from a checksum of the image
+//							file path; the path itself is saved in the index file too.
+//
+//	Parameters in:		None
+//
+//	Parameters out:	None
+//
+//	Value Returned:	Path of the index file
+//
+// Called By:			LoadGzipIndex
+//							WriteGzipIndex
+//
+//	Coded By:			agent						Date: 10/18/2026
+//	Revised By:			agent						Date: 10/18/2026
+
+#if defined multispec_wx
+wxString CMFileStream::GetGzipIndexPath (void)
+
+{
+	wxScopedCharBuffer				filePathBuffer;
+	
+	uLong									checksum;
+	
+	
+	filePathBuffer = wxString (&mWideFilePathName[1]).utf8_str ();
+	checksum = crc32 (0L, Z_NULL, 0);
+	checksum = crc32 (checksum,
+							(const Bytef*)filePathBuffer.data (),
+							(uInt)filePathBuffer.length ());
+	
+	return (wxFileName::GetTempDir () + 
+				wxFileName::GetPathSeparator () + 
+					wxString::Format (wxT("MultiSpec_%08lx.gzidx"), (unsigned long)checksum));
+	
+}	// end "GetGzipIndexPath"
+#endif	// defined multispec_wx
+
+
+
 //------------------------------------------------------------------------------------
 //                   Copyright 1988-2020 Purdue Research Foundation
 //
@@ -1017,6 +1373,110 @@ int CMFileStream::GetPathFileLength (
 
 
 
+//------------------------------------------------------------------------------------
+//                   Copyright 1988-2020 Purdue Research Foundation
+//
+//	Function name:		SInt16 InflateGzipData
+//
+//	Software purpose:	The purpose of this routine is to continue inflating the gzip
+//							compressed file from the current inflation state into the 
+//							output buffer. When the end of a member is reached, inflation
+//							continues with the next member if there is one.
+//
+//	Parameters in:		Pointer to the output buffer
+//							Number of bytes to inflate
+//
+//	Parameters out:	Number of bytes inflated
+//
+//	Value Returned:	Error code
+//
+// Called By:			ReadGzipData
+//
+//	Coded By:			agent						Date: 10/18/2026
+//	Revised By:			agent						Date: 10/18/2026
+
+#if defined multispec_wx
+SInt16 CMFileStream::InflateGzipData (
+				HUCharPtr							outBufferPtr,
+				UInt32								numberBytes,
+				UInt32*								numberBytesOutPtr)
+
+{
+	z_stream*							streamPtr;
+	
+	ssize_t								bytesRead;
+	
+	UInt32								trailerBytes;
+	
+	int									inflateReturn;
+	
+	SInt16								errCode = noErr;
+	
+	
+	streamPtr = (z_stream*)mGzipIndexPtr->streamPtr;
+	streamPtr->next_out = outBufferPtr;
+	streamPtr->avail_out = numberBytes;
+	trailerBytes = 0;
+	
+	while (streamPtr->avail_out > 0)
+		{
+		if (streamPtr->avail_in == 0)
+			{
+			bytesRead = Read (mGzipIndexPtr->inputBufferPtr, kGzipInputBufferBytes);
+			
+			if (bytesRead == wxInvalidOffset)
+				errCode = -1;
+				
+			if (bytesRead <= 0)
+				break;
+				
+			streamPtr->next_in = mGzipIndexPtr->inputBufferPtr;
+			streamPtr->avail_in = (uInt)bytesRead;
+			
+			}	// end "if (streamPtr->avail_in == 0)"
+			
+				// Skip the trailer of a member that was inflated as raw data.
+				
+		if (trailerBytes > 0)
+			{
+			bytesRead = MIN (trailerBytes, streamPtr->avail_in);
+			streamPtr->next_in += bytesRead;
+			streamPtr->avail_in -= (uInt)bytesRead;
+			trailerBytes -= (UInt32)bytesRead;
+			continue;
+			
+			}	// end "if (trailerBytes > 0)"
+			
+		inflateReturn = inflate (streamPtr, Z_NO_FLUSH);
+		
+		if (inflateReturn == Z_STREAM_END)
+			{
+			if (mGzipIndexPtr->rawStreamFlag)
+				trailerBytes = 8;
+				
+			inflateReset2 (streamPtr, 31);
+			mGzipIndexPtr->rawStreamFlag = FALSE;
+			
+			}	// end "if (inflateReturn == Z_STREAM_END)"
+		
+		else if (inflateReturn != Z_OK && inflateReturn != Z_BUF_ERROR)
+			{
+			errCode = -1;
+			break;
+			
+			}	// end "else if (inflateReturn != Z_OK && ..."
+		
+		}	// end "while (streamPtr->avail_out > 0)"
+		
+	*numberBytesOutPtr = numberBytes - streamPtr->avail_out;
+	
+	return (errCode);
+	
+}	// end "InflateGzipData"
+#endif	// defined multispec_wx
+
+
+
 //------------------------------------------------------------------------------------
 //                   Copyright 1988-2020 Purdue Research Foundation
 //
@@ -1035,7 +1495,7 @@ int CMFileStream::GetPathFileLength (
 // Called By:
 //
 //	Coded By:			Larry L. Biehl			Date: 04/10/2020
-//	Revised By:			Larry L. Biehl			Date: 04/10/2020
+//	Revised By:			agent						Date: 10/18/2026
 
 void CMFileStream::InitializeMembers ()
 
@@ -1061,6 +1521,10 @@ void CMFileStream::InitializeMembers ()
 
 	mCreator = -1;
 	mFileType = -1;
+	
+	#if defined multispec_wx
+		mGzipIndexPtr = NULL;
+	#endif	// defined multispec_wx
 			
 }	// end "GetPathFileLength"
 
@@ -1103,6 +1567,121 @@ void CMFileStream:: IOCheck (
 
 
 
+//------------------------------------------------------------------------------------
+//                   Copyright 1988-2020 Purdue Research Foundation
+//
+//	Function name:		Boolean LoadGzipIndex
+//
+//	Software purpose:	The purpose of this routine is to load the gzip index saved
+//							in the temporary directory by an earlier session. The saved
+//							index is not used if it is older than the compressed file or
+//							was made for a different file or a file of a different size.
+//
+//	Parameters in:		None
+//
+//	Parameters out:	None
+//
+//	Value Returned:	TRUE if the index was loaded
+//							FALSE if the index needs to be built
+//
+// Called By:			SetUpGzipIndex
+//
+//	Coded By:			agent						Date: 10/18/2026
+//	Revised By:			agent						Date: 10/18/2026
+
+#if defined multispec_wx
+Boolean CMFileStream::LoadGzipIndex (void)
+
+{
+	char									identifier[8];
+	
+	wxFile								indexFile;
+	wxScopedCharBuffer				filePathBuffer;
+	wxString								filePath,
+											indexPath;
+	
+	SInt64								compressedSize,
+											uncompressedSize;
+	
+	char*									savedFilePathPtr;
+	
+	UInt32								filePathLength,
+											numberCheckpoints;
+	
+	Boolean								loadedFlag = FALSE;
+	
+	
+	filePath = wxString (&mWideFilePathName[1]);
+	filePathBuffer = filePath.utf8_str ();
+	indexPath = GetGzipIndexPath ();
+	
+	if (!wxFile::Exists (indexPath) || 
+				wxFileModificationTime (indexPath) < wxFileModificationTime (filePath))
+																							return (FALSE);
+	
+	if (!indexFile.Open (indexPath, wxFile::read))
+																							return (FALSE);
+	
+			// Make sure that the index was saved for this file.
+	
+	savedFilePathPtr = NULL;
+	if (indexFile.Read (identifier, 8) == 8 &&
+			memcmp (identifier, "MSGZIDX2", 8) == 0 &&
+				indexFile.Read (&filePathLength, 4) == 4 &&
+					filePathLength == filePathBuffer.length ())
+		savedFilePathPtr = (char*)MNewPointer (filePathLength + 1);
+	
+	if (savedFilePathPtr != NULL &&
+			indexFile.Read (savedFilePathPtr, filePathLength) == 
+																	(ssize_t)filePathLength &&
+				memcmp (savedFilePathPtr, filePathBuffer.data (), filePathLength) == 0 &&
+					indexFile.Read (&compressedSize, 8) == 8 &&
+						indexFile.Read (&uncompressedSize, 8) == 8 &&
+							indexFile.Read (&numberCheckpoints, 4) == 4 &&
+								compressedSize == mGzipIndexPtr->compressedSize &&
+									numberCheckpoints > 0)
+		{
+		mGzipIndexPtr->checkpointPtr = (GzipCheckpointPtr)MNewPointer (
+										(SInt64)numberCheckpoints * sizeof (GzipCheckpoint));
+		mGzipIndexPtr->windowsPtr = (HUCharPtr)MNewPointer (
+										(SInt64)numberCheckpoints * kGzipWindowBytes);
+										
+		if (mGzipIndexPtr->checkpointPtr != NULL && 
+				mGzipIndexPtr->windowsPtr != NULL &&
+					indexFile.Read (mGzipIndexPtr->checkpointPtr, 
+											numberCheckpoints * sizeof (GzipCheckpoint)) ==
+									(ssize_t)(numberCheckpoints * sizeof (GzipCheckpoint)) &&
+						indexFile.Read (mGzipIndexPtr->windowsPtr, 
+											(size_t)numberCheckpoints * kGzipWindowBytes) ==
+									(ssize_t)numberCheckpoints * kGzipWindowBytes)
+			{
+			mGzipIndexPtr->numberCheckpoints = numberCheckpoints;
+			mGzipIndexPtr->uncompressedSize = uncompressedSize;
+			loadedFlag = TRUE;
+			
+			}	// end "if (mGzipIndexPtr->checkpointPtr != NULL && ..."
+			
+		else	// index could not be read
+			{
+			mGzipIndexPtr->checkpointPtr = (GzipCheckpointPtr)CheckAndDisposePtr (
+														(Ptr)mGzipIndexPtr->checkpointPtr);
+			mGzipIndexPtr->windowsPtr = 
+							(HUCharPtr)CheckAndDisposePtr ((Ptr)mGzipIndexPtr->windowsPtr);
+			
+			}	// end "else index could not be read"
+		
+		}	// end "if (savedFilePathPtr != NULL && ..."
+		
+	CheckAndDisposePtr ((Ptr)savedFilePathPtr);
+	indexFile.Close ();
+	
+	return (loadedFlag);
+	
+}	// end "LoadGzipIndex"
+#endif	// defined multispec_wx
+
+
+
 //------------------------------------------------------------------------------------
 //                   Copyright 1988-2020 Purdue Research Foundation
 //
@@ -1120,7 +1699,7 @@ void CMFileStream:: IOCheck (
 // Called By:		
 //
 //	Coded By:			Larry L. Biehl			Date: 03/23/1988
-//	Revised By:			Larry L. Biehl			Date: 04/10/1995
+//	Revised By:			agent						Date: 10/18/2026
 
 void CMFileStream::MCloseFile (void)
                       
@@ -1142,6 +1721,8 @@ void CMFileStream::MCloseFile (void)
 	#endif	// defined multispec_win
    
 	#if defined multispec_wx
+		DisposeGzipIndex ();
+		
 		if (IsOpened ())
 			Close ();
 	#endif
@@ -1363,7 +1944,7 @@ Boolean CMFileStream::MFlushFile (void)
 // Called By:	
 //
 //	Coded By:			Larry L. Biehl			Date: 09/07/1995 
-//	Revised By:			Larry L. Biehl			Date: 12/22/2003  
+//	Revised By:			agent						Date: 10/18/2026  
 
 SInt16 CMFileStream::MGetMarker (
 				SInt64*								outOffsetPtr,
@@ -1393,12 +1974,19 @@ SInt16 CMFileStream::MGetMarker (
 	#endif	// defined multispec_win
 		
 	#if defined multispec_wx
-		 wxFileOffset pos = Tell ();
-		 if (pos == wxInvalidOffset)
-			  errCode = -1;
+		if (mGzipIndexPtr != NULL)
+			*outOffsetPtr = mGzipIndexPtr->markerOffset;
+			
+		else	// mGzipIndexPtr == NULL
+			{
+			wxFileOffset pos = Tell ();
+			if (pos == wxInvalidOffset)
+				errCode = -1;
 			  
-		 else
-			  *outOffsetPtr=(SInt64)pos;
+			else
+				*outOffsetPtr=(SInt64)pos;
+				
+			}	// end "else mGzipIndexPtr == NULL"
 	#endif
 	
 	return (errCode);
@@ -1424,7 +2012,7 @@ SInt16 CMFileStream::MGetMarker (
 // Called By:	
 //
 //	Coded By:			Larry L. Biehl			Date: 05/05/1995
-//	Revised By:			Larry L. Biehl			Date: 12/22/2003
+//	Revised By:			agent						Date: 10/18/2026
 
 SInt16 CMFileStream::MGetSizeOfFile (
 				SInt64*								countPtr)
@@ -1451,7 +2039,10 @@ SInt16 CMFileStream::MGetSizeOfFile (
 	#endif	// defined multispec_win   
 		
 	#if defined multispec_wx
-		 if (IsOpened ())
+		 if (mGzipIndexPtr != NULL)
+			*countPtr = mGzipIndexPtr->uncompressedSize;
+			
+		 else if (IsOpened ())
 			{
 			wxFileOffset len = Length ();
 			*countPtr = (SInt64)len;
@@ -1484,7 +2075,7 @@ SInt16 CMFileStream::MGetSizeOfFile (
 // Called By:	
 //
 //	Coded By:			Larry L. Biehl			Date: 05/04/1995
-//	Revised By:			Larry L. Biehl			Date: 04/10/2020
+//	Revised By:			agent						Date: 10/18/2026
 
 SInt16 CMFileStream::MOpenFile (
 				UInt16								readWriteCode,
@@ -1512,6 +2103,11 @@ SInt16 CMFileStream::MOpenFile (
 					mFileType = kTEXTFileType;
 					open_mode = readWriteCode;
 					
+							// Gzip compressed files are read as if they were not
+							// compressed.
+							
+					SetUpGzipIndex ();
+					
 					}	// end "if (Open ((CharPtr)inFilePathPtr, ..."
 
 				else	// !Open (...
@@ -1547,7 +2143,13 @@ SInt16 CMFileStream::MOpenFile (
 			
 		else if (readWriteCode == kReadWrite)
 			{
-			if (Open (wxString (&mWideFilePathName[1]), kReadWrite))
+					// Gzip compressed files are read as if they were not compressed
+					// so they cannot be changed in place.
+					
+			if (CheckIfGzipFile ())
+				errCode = fLckdErr;
+				
+			else if (Open (wxString (&mWideFilePathName[1]), kReadWrite))
 				{
 				mCreator = -1;
 				mFileType = kTEXTFileType;
@@ -1633,7 +2235,7 @@ SInt16 CMFileStream::MOpenFile (
 // Called By:		
 //
 //	Coded By:			Larry L. Biehl			Date: 04/17/1995
-//	Revised By:			Larry L. Biehl			Date: 04/17/1995
+//	Revised By:			agent						Date: 10/18/2026
                       
 SInt16 CMFileStream::MPeekData (
 				void									*outBufferPtr,
@@ -1667,7 +2269,18 @@ SInt16 CMFileStream::MPeekData (
 	#endif	// defined multispec_win
 
 	#if defined multispec_wx
-		if (IsOpened ())
+		if (mGzipIndexPtr != NULL)
+			{
+			SInt64 markerOffset = mGzipIndexPtr->markerOffset;
+			UInt32 gzipBytesRead = *numberBytesPtr;
+			
+			ReadGzipData (outBufferPtr, &gzipBytesRead);
+			bytesRead = (SInt32)gzipBytesRead;
+			mGzipIndexPtr->markerOffset = markerOffset;
+			
+			}	// end "if (mGzipIndexPtr != NULL)"
+			
+		else if (IsOpened ())
 			{
 			wxFileOffset currentPosition;
 			currentPosition = Tell ();
@@ -1708,7 +2321,7 @@ SInt16 CMFileStream::MPeekData (
 // Called By:
 //
 //	Coded By:			Larry L. Biehl			Date: 04/14/1995
-//	Revised By:			Larry L. Biehl			Date: 08/27/2018
+//	Revised By:			agent						Date: 10/18/2026
                       
 SInt16 CMFileStream::MReadData (
 				void									*outBufferPtr,
@@ -1747,7 +2360,14 @@ SInt16 CMFileStream::MReadData (
 	#endif	// defined multispec_win
 	
 	#if defined multispec_wx
-		if (IsOpened ())
+		if (mGzipIndexPtr != NULL)
+			{
+			bytesRead = *numberBytesPtr;
+			errCode = ReadGzipData (outBufferPtr, &bytesRead);
+			
+			}	// end "if (mGzipIndexPtr != NULL)"
+			
+		else if (IsOpened ())
 			{
 			SInt32								linuxBytesRead;
 			//wxFileOffset						flength = Length ();
@@ -1801,7 +2421,7 @@ SInt16 CMFileStream::MReadData (
 // Called By:	
 //
 //	Coded By:			Larry L. Biehl			Date: 04/28/1995 
-//	Revised By:			Larry L. Biehl			Date: 01/17/1996  
+//	Revised By:			agent						Date: 10/18/2026  
 
 SInt16 CMFileStream::MSetMarker (
 				SInt64								inOffset,
@@ -1842,7 +2462,23 @@ SInt16 CMFileStream::MSetMarker (
 	#endif	// defined multispec_win
 	
 	#if defined multispec_wx
-		if (IsOpened ())
+		if (mGzipIndexPtr != NULL)
+			{
+			if (fromCode == fsFromMark)
+				inOffset += mGzipIndexPtr->markerOffset;
+
+			if (fromCode == fsFromLEOF)
+				inOffset += mGzipIndexPtr->uncompressedSize;
+				
+			if (inOffset < 0)
+				errCode = -1;
+				
+			else	// inOffset >= 0
+				mGzipIndexPtr->markerOffset = inOffset;
+			
+			}	// end "if (mGzipIndexPtr != NULL)"
+			
+		else if (IsOpened ())
 			{
 			wxSeekMode mode = wxFromStart;
 			if (fromCode == fsFromMark)
@@ -1987,6 +2623,124 @@ SInt16 CMFileStream::MWriteData (
 }	// end "MWriteData"     
 
 
+//------------------------------------------------------------------------------------
+//                   Copyright 1988-2020 Purdue Research Foundation
+//
+//	Function name:		SInt16 ReadGzipData
+//
+//	Software purpose:	The purpose of this routine is to read the requested number
+//							of uncompressed bytes starting at the current marker from the
+//							gzip compressed file. Inflation continues from the current
+//							state when reading forward; otherwise it restarts at the 
+//							closest checkpoint before the marker.
+//
+//	Parameters in:		Pointer to the buffer to copy the data to
+//							Number of bytes to read.
+//
+//	Parameters out:	Number of bytes actually read
+//
+//	Value Returned:	Error code
+//
+// Called By:			MPeekData
+//							MReadData
+//
+//	Coded By:			agent						Date: 10/18/2026
+//	Revised By:			agent						Date: 10/18/2026
+
+#if defined multispec_wx
+SInt16 CMFileStream::ReadGzipData (
+				void*									outBufferPtr,
+				UInt32*								numberBytesPtr)
+
+{
+	SInt64								offset;
+	
+	GzipCheckpointPtr					checkpointPtr;
+	
+	UInt32								bytesRead = 0,
+											count,
+											first,
+											last,
+											middle,
+											skipCount,
+											skippedCount;
+	
+	SInt16								errCode = noErr;
+	
+	
+	offset = mGzipIndexPtr->markerOffset;
+	count = *numberBytesPtr;
+	
+	if (offset >= mGzipIndexPtr->uncompressedSize)
+		count = 0;
+		
+	else if (count > mGzipIndexPtr->uncompressedSize - offset)
+		count = (UInt32)(mGzipIndexPtr->uncompressedSize - offset);
+		
+	if (count > 0)
+		{
+				// Find the last checkpoint at or before the marker.
+				
+		checkpointPtr = mGzipIndexPtr->checkpointPtr;
+		first = 0;
+		last = mGzipIndexPtr->numberCheckpoints - 1;
+		while (first < last)
+			{
+			middle = (first + last + 1)/2;
+			if (checkpointPtr[middle].outOffset <= offset)
+				first = middle;
+				
+			else	// checkpointPtr[middle].outOffset > offset
+				last = middle - 1;
+			
+			}	// end "while (first < last)"
+			
+		if (mGzipIndexPtr->streamOutOffset < 0 || 
+				offset < mGzipIndexPtr->streamOutOffset ||
+					checkpointPtr[first].outOffset > mGzipIndexPtr->streamOutOffset)
+			errCode = StartGzipStream (first);
+			
+		while (errCode == noErr && mGzipIndexPtr->streamOutOffset < offset)
+			{
+			skipCount = kGzipWindowBytes;
+			if (offset - mGzipIndexPtr->streamOutOffset < kGzipWindowBytes)
+				skipCount = (UInt32)(offset - mGzipIndexPtr->streamOutOffset);
+				
+			errCode = InflateGzipData (
+								mGzipIndexPtr->skipBufferPtr, skipCount, &skippedCount);
+			mGzipIndexPtr->streamOutOffset += skippedCount;
+			
+			if (errCode == noErr && skippedCount < skipCount)
+				errCode = -1;
+			
+			}	// end "while (errCode == noErr && ..."
+			
+		if (errCode == noErr)
+			{
+			errCode = InflateGzipData ((HUCharPtr)outBufferPtr, count, &bytesRead);
+			mGzipIndexPtr->streamOutOffset += bytesRead;
+			
+			}	// end "if (errCode == noErr)"
+			
+		if (errCode != noErr)
+			mGzipIndexPtr->streamOutOffset = -1;
+		
+		}	// end "if (count > 0)"
+		
+	mGzipIndexPtr->markerOffset = offset + bytesRead;
+	
+	if (errCode == noErr && bytesRead != *numberBytesPtr)
+		errCode = eofErr;
+	
+	*numberBytesPtr = bytesRead;
+	
+	return (errCode);
+	
+}	// end "ReadGzipData"
+#endif	// defined multispec_wx
+
+
+
 //------------------------------------------------------------------------------------
 //                   Copyright 1988-2020 Purdue Research Foundation
 //
@@ -2510,3 +3264,242 @@ void CMFileStream::SetWideFileStringLength (
 
 }	// end "SetFileStringLength"
 
+
+
+//------------------------------------------------------------------------------------
+//                   Copyright 1988-2020 Purdue Research Foundation
+//
+//	Function name:		void SetUpGzipIndex
+//
+//	Software purpose:	The purpose of this routine is to check whether the file just 
+//							opened for reading is gzip compressed. If so, the index saved
+//							in the temporary directory is loaded or a new one is built and
+//							saved there so that the file can be read as if it were not
+//							compressed. If the index cannot be set up, the file is read
+//							as is.
+//
+//	Parameters in:		None
+//
+//	Parameters out:	None
+//
+//	Value Returned:	None
+//
+// Called By:			MOpenFile
+//
+//	Coded By:			agent						Date: 10/18/2026
+//	Revised By:			agent						Date: 10/18/2026
+
+#if defined multispec_wx
+void CMFileStream::SetUpGzipIndex (void)
+
+{
+	UInt8									signature[3];
+	
+	ssize_t								bytesRead;
+	
+	SInt16								errCode = -1;
+	
+	
+	DisposeGzipIndex ();
+	
+	bytesRead = Read (signature, 3);
+	Seek (0, wxFromStart);
+	
+	if (bytesRead != 3 || 
+			signature[0] != 0x1f || signature[1] != 0x8b || signature[2] != 8)
+																							return;
+	
+	mGzipIndexPtr = (GzipIndexPtr)MNewPointerClear (sizeof (GzipIndex));
+	if (mGzipIndexPtr == NULL)
+																							return;
+	
+	mGzipIndexPtr->inputBufferPtr = (HUCharPtr)MNewPointer (kGzipInputBufferBytes);
+	mGzipIndexPtr->skipBufferPtr = (HUCharPtr)MNewPointer (kGzipWindowBytes);
+	mGzipIndexPtr->compressedSize = Length ();
+	mGzipIndexPtr->markerOffset = 0;
+	mGzipIndexPtr->streamOutOffset = -1;
+	
+	if (mGzipIndexPtr->inputBufferPtr != NULL && mGzipIndexPtr->skipBufferPtr != NULL)
+		{
+		errCode = noErr;
+		if (!LoadGzipIndex ())
+			{
+			errCode = BuildGzipIndex ();
+			
+			if (errCode == noErr)
+				WriteGzipIndex ();
+			
+			}	// end "if (!LoadGzipIndex ())"
+		
+		}	// end "if (mGzipIndexPtr->inputBufferPtr != NULL && ..."
+		
+	if (errCode != noErr)
+		{
+		DisposeGzipIndex ();
+		Seek (0, wxFromStart);
+		
+		}	// end "if (errCode != noErr)"
+	
+}	// end "SetUpGzipIndex"
+#endif	// defined multispec_wx
+
+
+
+//------------------------------------------------------------------------------------
+//                   Copyright 1988-2020 Purdue Research Foundation
+//
+//	Function name:		SInt16 StartGzipStream
+//
+//	Software purpose:	The purpose of this routine is to set up the inflation state
+//							to start inflating the gzip compressed file at the input
+//							checkpoint.
+//
+//	Parameters in:		Index of the checkpoint
+//
+//	Parameters out:	None
+//
+//	Value Returned:	Error code
+//
+// Called By:			ReadGzipData
+//
+//	Coded By:			agent						Date: 10/18/2026
+//	Revised By:			agent						Date: 10/18/2026
+
+#if defined multispec_wx
+SInt16 CMFileStream::StartGzipStream (
+				UInt32								checkpointIndex)
+
+{
+	GzipCheckpointPtr					checkpointPtr;
+	z_stream*							streamPtr;
+	
+	UInt8									firstByte;
+	
+	
+	checkpointPtr = &mGzipIndexPtr->checkpointPtr[checkpointIndex];
+	streamPtr = (z_stream*)mGzipIndexPtr->streamPtr;
+	mGzipIndexPtr->streamOutOffset = -1;
+	
+	if (streamPtr == NULL)
+		{
+		streamPtr = (z_stream*)MNewPointerClear (sizeof (z_stream));
+		if (streamPtr == NULL)
+																							return (-1);
+		
+		if (inflateInit2 (streamPtr, -15) != Z_OK)
+			{
+			CheckAndDisposePtr ((Ptr)streamPtr);
+																							return (-1);
+			
+			}	// end "if (inflateInit2 (streamPtr, -15) != Z_OK)"
+			
+		mGzipIndexPtr->streamPtr = streamPtr;
+		
+		}	// end "if (streamPtr == NULL)"
+		
+	else	// streamPtr != NULL
+		inflateReset2 (streamPtr, -15);
+		
+	mGzipIndexPtr->rawStreamFlag = TRUE;
+	streamPtr->avail_in = 0;
+	
+	if (Seek (checkpointPtr->inOffset - (checkpointPtr->bits ? 1 : 0), 
+																wxFromStart) == wxInvalidOffset)
+																							return (-1);
+	
+			// The checkpoint may start within a byte.
+			
+	if (checkpointPtr->bits)
+		{
+		if (Read (&firstByte, 1) != 1)
+																							return (-1);
+		
+		inflatePrime (streamPtr, 
+							checkpointPtr->bits, 
+							firstByte >> (8 - checkpointPtr->bits));
+		
+		}	// end "if (checkpointPtr->bits)"
+		
+	inflateSetDictionary (
+			streamPtr, 
+			&mGzipIndexPtr->windowsPtr[(SInt64)checkpointIndex * kGzipWindowBytes],
+			kGzipWindowBytes);
+		
+	mGzipIndexPtr->streamOutOffset = checkpointPtr->outOffset;
+	
+	return (noErr);
+	
+}	// end "StartGzipStream"
+#endif	// defined multispec_wx
+
+
+
+//------------------------------------------------------------------------------------
+//                   Copyright 1988-2020 Purdue Research Foundation
+//
+//	Function name:		void WriteGzipIndex
+//
+//	Software purpose:	The purpose of this routine is to save the gzip index in an
+//							index file in the temporary directory so that it does not 
+//							need to be built again the next time the file is opened. 
+//							Nothing is written next to the image file. Nothing is saved
+//							if the index file cannot be written.
+//
+//	Parameters in:		None
+//
+//	Parameters out:	None
+//
+//	Value Returned:	None
+//
+// Called By:			SetUpGzipIndex
+//
+//	Coded By:			agent						Date: 10/18/2026
+//	Revised By:			agent						Date: 10/18/2026
+
+#if defined multispec_wx
+void CMFileStream::WriteGzipIndex (void)
+
+{
+	wxFile								indexFile;
+	wxScopedCharBuffer				filePathBuffer;
+	wxString								indexPath;
+	
+	size_t								checkpointBytes,
+											windowBytes;
+	
+	UInt32								filePathLength;
+	
+	Boolean								writtenFlag;
+	
+	
+	filePathBuffer = wxString (&mWideFilePathName[1]).utf8_str ();
+	filePathLength = (UInt32)filePathBuffer.length ();
+	indexPath = GetGzipIndexPath ();
+	
+	if (!indexFile.Open (indexPath, wxFile::write))
+																							return;
+	
+	checkpointBytes = mGzipIndexPtr->numberCheckpoints * sizeof (GzipCheckpoint);
+	windowBytes = (size_t)mGzipIndexPtr->numberCheckpoints * kGzipWindowBytes;
+																							
+	writtenFlag = (indexFile.Write ("MSGZIDX2", 8) == 8 &&
+			indexFile.Write (&filePathLength, 4) == 4 &&
+				indexFile.Write (filePathBuffer.data (), filePathLength) == filePathLength);
+	
+	writtenFlag = (writtenFlag &&
+			indexFile.Write (&mGzipIndexPtr->compressedSize, 8) == 8 &&
+				indexFile.Write (&mGzipIndexPtr->uncompressedSize, 8) == 8 &&
+					indexFile.Write (&mGzipIndexPtr->numberCheckpoints, 4) == 4 &&
+						indexFile.Write (mGzipIndexPtr->checkpointPtr, checkpointBytes) ==
+																					checkpointBytes &&
+							indexFile.Write (mGzipIndexPtr->windowsPtr, windowBytes) == 
+																					windowBytes);
+	
+	indexFile.Close ();
+	
+	if (!writtenFlag)
+		wxRemoveFile (indexPath);
+	
+}	// end "WriteGzipIndex"
+#endif	// defined multispec_wx
+
@@ -19,7 +19,7 @@
 //
 //	Authors:					Larry L. Biehl
 //
-//	Revision date:			04/10/2020
+//	Revision date:			10/18/2026
 //
 //	Language:				C++
 //
@@ -66,6 +66,10 @@
 									
 			virtual ~CMFileStream();
 			
+			#if defined multispec_wx
+				Boolean CheckIfGzipFile (void);
+			#endif	// defined multispec_wx
+			
 			static void DisposeFilePath(
 				WideFileStringPtr					inFilePathPtr);
 										
@@ -217,6 +221,32 @@
 				
 			void InitializeMembers (void);
 			
+			#if defined multispec_wx
+				SInt16 BuildGzipIndex (void);
+				
+				void DisposeGzipIndex (void);
+				
+				wxString GetGzipIndexPath (void);
+				
+				SInt16 InflateGzipData (
+					HUCharPtr							outBufferPtr,
+					UInt32								numberBytes,
+					UInt32*								numberBytesOutPtr);
+				
+				Boolean LoadGzipIndex (void);
+				
+				SInt16 ReadGzipData (
+					void*									outBufferPtr,
+					UInt32*								numberBytesPtr);
+				
+				void SetUpGzipIndex (void);
+				
+				SInt16 StartGzipStream (
+					UInt32								checkpointIndex);
+				
+				void WriteGzipIndex (void);
+			#endif	// defined multispec_wx
+			
 					// The wide file name version of the file (no path included)
 					// The first element of the string is the length of the string
 					// The last element is reserved for a c terminator
@@ -224,6 +254,11 @@
 			#if defined multispec_wx
 				wchar_t								mWideFileName[_MAX_FILE];
 				unsigned int						open_mode;
+				
+						// Index and inflation state when the file is gzip compressed.
+						// NULL when the file is not compressed.
+						
+				GzipIndexPtr						mGzipIndexPtr;
 			#endif	// defined multispec_wx
 		
 			#if defined multispec_win
@@ -3377,6 +3377,13 @@ Boolean DoHistogramRequests (
 																	&fileIOInstructionsPtr);
 					
 					gConvertSignedDataFlag = FALSE;
+					
+					if (continueFlag)
+						{
+						SetUpSequentialReadBuffer (fileIOInstructionsPtr);
+						SetUpChannelLineBlocks (fileIOInstructionsPtr);
+						
+						}	// end "if (continueFlag)"
 												
 					}	// end "if (continueFlag)"
 				
@@ -18,7 +18,7 @@
 //
 //	Authors:					Larry L. Biehl
 //
-//	Revision date:			07/01/2019
+//	Revision date:			10/18/2026
 //
 //	Language:				C
 //
@@ -117,6 +117,14 @@ SInt32	GetGroupIndex (
 				ClassifierVar*						clsfyVariablePtr,
 				UInt32								statClassNumber);
 
+SInt16	GetMaskFieldsResults (
+				AreaDescriptionPtr				areaDescriptionPtr,
+				FileIOInstructionsPtr			fileIOInstructions1Ptr,
+				FileIOInstructionsPtr			fileIOInstructions2Ptr,
+				ClassifierVarPtr					clsfyVariablePtr,
+				MaskInfoPtr							maskInfoPtr,
+				SInt32*								maskValueCountIndexPtr);
+
 Handle	GetProbabilityWindowInfoHandle (void);
 																
 HUInt16Ptr	GetSymbolToClassVector (
@@ -1517,6 +1525,240 @@ Boolean GetListResultsStringBuffer (
 
 
 
+//------------------------------------------------------------------------------------
+//                   Copyright 1988-2020 Purdue Research Foundation
+//
+//	Function name:		SInt16 GetMaskFieldsResults
+//
+//	Software purpose:	The purpose of this routine is to get the classification
+//							results for all of the mask fields in one pass through the
+//							classified image. The mask value for each pixel is used to find
+//							the count vector for the field that it belongs to. This
+//							replaces one pass through the mask area for each mask field.
+//
+//	Parameters in:		Area to be read. The mask line and column start are relative
+//								to the mask buffer.
+//							Vector of count vector indices for each mask value; -1 if
+//								the mask value is not to be counted.
+//
+//	Parameters out:	None
+//
+// Value Returned:	=0, no error
+//							=2, disk file error.
+//							=3, user quit.
+//
+// Called By:			ListResultsTrainTestFields
+//
+//	Coded By:			agent						Date: 10/18/2026
+//	Revised By:			agent						Date: 10/18/2026
+
+SInt16 GetMaskFieldsResults (
+				AreaDescriptionPtr				areaDescriptionPtr, 
+				FileIOInstructionsPtr			fileIOInstructions1Ptr,
+				FileIOInstructionsPtr			fileIOInstructions2Ptr,
+				ClassifierVarPtr					clsfyVariablePtr,
+				MaskInfoPtr							maskInfoPtr,
+				SInt32*								maskValueCountIndexPtr)
+					
+{
+	HSInt64Ptr							countVectorPtr;
+	
+	HUInt16Ptr							ioBuffer2Ptr,
+											maskBufferPtr,
+				 							probabilityBuffer2Ptr,
+											symbolToIndexPtr;
+	
+	SInt32								countVectorIndex,
+											line,
+											lineCount,
+											lineEnd,
+											numberSamples,
+											sample;
+	
+	UInt32								maskColumnStart,
+											maskValue,
+											maxMaskValue,
+											numberMaskColumnsPerLine,
+											numberMaskSamples;
+	
+	SInt16								errCode,
+											returnCode,
+											thresholdCode;
+	
+	Boolean								thresholdDataFlag,
+											updateNumberLinesFlag;
+	
+	
+			// Initialize local variables	
+	
+	countVectorPtr = 			clsfyVariablePtr->countVectorPtr;
+	lineEnd = 					areaDescriptionPtr->lineEnd;
+	lineCount = 				0;
+	maxMaskValue = 			maskInfoPtr->maxMaskValue;
+	numberMaskColumnsPerLine = maskInfoPtr->numberColumns + 1;
+	probabilityBuffer2Ptr = (HUInt16Ptr)gOutputBuffer2Ptr;
+	returnCode = 				noErr;
+	symbolToIndexPtr = 		clsfyVariablePtr->symbolToClassPtr;
+	thresholdCode = 			gListResultsSpecsPtr->probabilityThresholdCode;
+	thresholdDataFlag = 		gListResultsSpecsPtr->thresholdFlag;
+	
+	numberMaskSamples = 
+				areaDescriptionPtr->columnEnd - areaDescriptionPtr->columnStart + 1;
+	areaDescriptionPtr->numSamplesPerChan = numberMaskSamples;
+	
+			// Get a pointer to the start of the mask line for the first line in the
+			// area. The first value in each mask line is the flag indicating whether
+			// the line contains any mask data.
+			
+	maskBufferPtr = (HUInt16Ptr)GetHandlePointer (maskInfoPtr->maskHandle, kLock);
+	maskBufferPtr += (areaDescriptionPtr->maskLineStart - 1) * numberMaskColumnsPerLine;
+	maskColumnStart = areaDescriptionPtr->maskColumnStart;
+			
+			// Load some of the File IO Instructions structure for the classified image
+			// and probability image files that pertain to the area being used. The
+			// data are not packed by mask value; all mask values are used below.
+	
+	SetUpFileIOInstructions (fileIOInstructions1Ptr,
+										areaDescriptionPtr,
+										1,
+										NULL,
+										kSetSpecialBILFlagFalse);
+	
+	if (thresholdDataFlag)		
+		SetUpFileIOInstructions (fileIOInstructions2Ptr,
+											areaDescriptionPtr,
+											1,
+											NULL,
+											kSetSpecialBILFlagFalse);
+											
+	updateNumberLinesFlag = TRUE;
+
+	for (line=areaDescriptionPtr->lineStart; line<=lineEnd; line++)
+		{
+				// Display line status information.											
+				
+		lineCount++;
+		if (TickCount () >= gNextStatusTime)
+			{
+			if (updateNumberLinesFlag)
+				{
+				LoadDItemValue (gStatusDialogPtr, 
+										IDC_Status20,
+										(SInt32)areaDescriptionPtr->numberLines);
+				updateNumberLinesFlag = FALSE;
+									
+				}	// end "if (updateNumberLinesFlag)"
+				
+			LoadDItemValue (gStatusDialogPtr, IDC_Status18, lineCount);
+			gNextStatusTime = TickCount () + gNextStatusTimeOffset;
+			
+			}	// end "if (TickCount () >= gNextStatusTime)"
+			
+				// Only read lines that contain mask data.
+				
+		if (DetermineIfMaskDataInLine (
+										maskBufferPtr, maskColumnStart, numberMaskSamples, 1, 0))
+			{
+			errCode = GetLineOfData (fileIOInstructions1Ptr,
+												line,
+												(UInt32)areaDescriptionPtr->columnStart,
+												(UInt32)areaDescriptionPtr->columnEnd,
+												1,
+												gInputBufferPtr,
+												gOutputBufferPtr);
+				
+			if (errCode < noErr)
+				{
+				returnCode = 2;
+				break;
+				
+				}	// end "if (errCode < noErr)"
+				
+			if (thresholdDataFlag && errCode != kSkipLine)
+				{ 
+				errCode = GetLineOfData (fileIOInstructions2Ptr,
+													line, 
+													(UInt32)areaDescriptionPtr->columnStart,
+													(UInt32)areaDescriptionPtr->columnEnd,
+													1,
+													gInputBuffer2Ptr,
+													gOutputBuffer2Ptr);	
+				
+				if (errCode < noErr)
+					{
+					returnCode = 2;
+					break;
+					
+					}	// end "if (errCode < noErr)"
+					
+				}	// end "if (thresholdDataFlag && errCode != kSkipLine)"
+				
+			if (errCode != kSkipLine)
+				{
+				ioBuffer2Ptr = (HUInt16Ptr)gOutputBufferPtr;
+				numberSamples = fileIOInstructions1Ptr->numberOutputBufferSamples;
+				
+				for (sample=0; sample<numberSamples; sample++)
+					{
+					maskValue = maskBufferPtr[maskColumnStart+sample];
+					
+					if (maskValue > 0 && maskValue <= maxMaskValue)
+						{
+						countVectorIndex = maskValueCountIndexPtr[maskValue];
+						
+						if (countVectorIndex >= 0)
+							{
+							if (!thresholdDataFlag ||
+										probabilityBuffer2Ptr[sample] > (UInt16)thresholdCode)
+								countVectorPtr[countVectorIndex +
+															symbolToIndexPtr[ioBuffer2Ptr[sample]]]++;
+								
+							else	// probabilityBufferPtr[sample] <= thresholdCode 
+								countVectorPtr[countVectorIndex]++;
+								
+							}	// end "if (countVectorIndex >= 0)"
+							
+						}	// end "if (maskValue > 0 && maskValue <= maxMaskValue)"
+						
+					}	// end "for (sample=0; sample<numberSamples; sample++)"
+					
+				}	// end "if (errCode != kSkipLine)"
+				
+			}	// end "if (DetermineIfMaskDataInLine (maskBufferPtr, ..."
+			
+				// Exit routine if user has "command period" down						
+				
+		if (TickCount () >= gNextTime)
+			{
+			if (!CheckSomeEvents (osMask+keyDownMask+updateMask+mDownMask+mUpMask))
+				{
+				returnCode = 3;
+				break;
+				
+				}	// end "if (!CheckSomeEvents (..."
+				
+			}	// end "if (TickCount () >= gNextTime)" 
+			
+		maskBufferPtr += numberMaskColumnsPerLine;
+										
+		}	// end "for (line=areaDescriptionPtr->lineStart; line..." 
+	
+	if (returnCode == 0)	
+		LoadDItemValue (gStatusDialogPtr, IDC_Status18, lineCount);
+			
+	CloseUpFileIOInstructions (fileIOInstructions1Ptr, areaDescriptionPtr);
+	
+	if (thresholdDataFlag)
+		CloseUpFileIOInstructions (fileIOInstructions2Ptr, areaDescriptionPtr);
+		
+	CheckAndUnlockHandle (maskInfoPtr->maskHandle);
+		
+	return (returnCode);
+			
+}	// end "GetMaskFieldsResults" 	  
+
+
+
 //------------------------------------------------------------------------------------
 //                   Copyright 1988-2020 Purdue Research Foundation
 //
@@ -5269,9 +5511,19 @@ SInt16 ListResultsTrainTestFields (
 {
 	CMFileStream*						listResultsFileStreamPtr;
 	HPClassNamesPtr					classNamesPtr;
-	HPFieldIdentifiersPtr			fieldIdentPtr;	
+	HPFieldIdentifiersPtr			fieldIdentPtr;
+	MaskInfoPtr							maskInfoPtr;
+	SInt32*								maskValueCountIndexPtr;
 	
-	SInt32								countVectorIndex;
+	SInt32								countVectorIndex,
+											maskFieldsColumnEnd,
+											maskFieldsColumnStart,
+											maskFieldsLineEnd,
+											maskFieldsLineStart,
+											maskFieldsMaskColumnStart,
+											maskFieldsMaskLineStart;
+	
+	UInt32								maskValue;
 	
 	SInt16								*classAreaPtr,
 											*classPtr;
@@ -5290,7 +5542,8 @@ SInt16 ListResultsTrainTestFields (
 	UInt16								classIndex,
 											totalCountFields;
 	
-	Boolean								continueFlag;
+	Boolean								continueFlag,
+											maskFieldsFlag;
 	
 
 			// Initialize local variables.													
@@ -5298,6 +5551,15 @@ SInt16 ListResultsTrainTestFields (
 	returnCode = noErr;
 	listResultsFileStreamPtr = GetResultsFileStreamPtr (0);
 	continueFlag = TRUE;
+	maskInfoPtr = NULL;
+	maskValueCountIndexPtr = NULL;
+	maskFieldsFlag = TRUE;
+	maskFieldsColumnEnd = 0;
+	maskFieldsColumnStart = 0;
+	maskFieldsLineEnd = 0;
+	maskFieldsLineStart = 0;
+	maskFieldsMaskColumnStart = 0;
+	maskFieldsMaskLineStart = 0;
 	classNamesPtr = gProjectInfoPtr->classNamesPtr;
 	fieldIdentPtr = gProjectInfoPtr->fieldIdentPtr;
 	classAreaPtr = (SInt16*)GetHandlePointer (gListResultsSpecsPtr->classAreaHandle);
@@ -5390,10 +5652,72 @@ SInt16 ListResultsTrainTestFields (
 					areaDescriptionPtr->lineInterval = 1;
 					areaDescriptionPtr->columnInterval = 1;
 					
+							// Mask fields are all counted later in one pass through the
+							// mask area. Get the vector relating the mask values to the
+							// field count vectors the first time a mask field is found.
+							
+					if (maskFieldsFlag &&
+								areaDescriptionPtr->maskInfoPtr != NULL &&
+										maskValueCountIndexPtr == NULL)
+						{
+						maskInfoPtr = areaDescriptionPtr->maskInfoPtr;
+						maskValueCountIndexPtr = (SInt32*)MNewPointer (
+								(SInt64)(maskInfoPtr->maxMaskValue+1) * sizeof (SInt32));
+						
+						if (maskValueCountIndexPtr != NULL)
+							{
+							for (maskValue=0; 
+									maskValue<=maskInfoPtr->maxMaskValue; 
+									maskValue++)
+								maskValueCountIndexPtr[maskValue] = -1;
+								
+							}	// end "if (maskValueCountIndexPtr != NULL)"
+						
+						else	// maskValueCountIndexPtr == NULL
+							maskFieldsFlag = FALSE;
+							
+						}	// end "if (maskFieldsFlag && ..."
+					
+					if (maskValueCountIndexPtr != NULL &&
+								areaDescriptionPtr->maskInfoPtr == maskInfoPtr &&
+										areaDescriptionPtr->columnStart > 0)
+						{
+								// Save the count vector index for this mask value and
+								// expand the area to be read to include this field.
+								
+						maskValue = areaDescriptionPtr->maskValueRequest;
+						if (maskValue <= maskInfoPtr->maxMaskValue)
+							maskValueCountIndexPtr[maskValue] = countVectorIndex;
+							
+						if (maskFieldsLineStart == 0 ||
+									areaDescriptionPtr->lineStart < maskFieldsLineStart)
+							{
+							maskFieldsLineStart = areaDescriptionPtr->lineStart;
+							maskFieldsMaskLineStart = areaDescriptionPtr->maskLineStart;
+							
+							}	// end "if (maskFieldsLineStart == 0 || ..."
+							
+						if (maskFieldsColumnStart == 0 ||
+									areaDescriptionPtr->columnStart < maskFieldsColumnStart)
+							{
+							maskFieldsColumnStart = areaDescriptionPtr->columnStart;
+							maskFieldsMaskColumnStart = areaDescriptionPtr->maskColumnStart;
+							
+							}	// end "if (maskFieldsColumnStart == 0 || ..."
+							
+						maskFieldsLineEnd = MAX (maskFieldsLineEnd, 
+															areaDescriptionPtr->lineEnd);
+						maskFieldsColumnEnd = MAX (maskFieldsColumnEnd, 
+															areaDescriptionPtr->columnEnd);
+															
+						areaDescriptionPtr->maskInfoPtr = NULL;
+						
+						}	// end "if (maskValueCountIndexPtr != NULL && ..."
+					
 							// columnStart == 0 means that the field is not within the
 							// area of the current image file.
 										
-					if (areaDescriptionPtr->columnStart > 0)
+					else if (areaDescriptionPtr->columnStart > 0)
 					
 								// Get the results for the field.								
 							
@@ -5433,6 +5757,34 @@ SInt16 ListResultsTrainTestFields (
 			
 		}	// end "for (classIndex=0; classIndex<..." 	
 		
+			// Get the results for the mask fields.
+			
+	if (returnCode == noErr && maskFieldsLineStart > 0)
+		{
+		areaDescriptionPtr->lineStart = maskFieldsLineStart;
+		areaDescriptionPtr->lineEnd = maskFieldsLineEnd;
+		areaDescriptionPtr->columnStart = maskFieldsColumnStart;
+		areaDescriptionPtr->columnEnd = maskFieldsColumnEnd;
+		areaDescriptionPtr->lineInterval = 1;
+		areaDescriptionPtr->columnInterval = 1;
+		areaDescriptionPtr->numberLines = maskFieldsLineEnd - maskFieldsLineStart + 1;
+		areaDescriptionPtr->maskLineStart = maskFieldsMaskLineStart;
+		areaDescriptionPtr->maskColumnStart = maskFieldsMaskColumnStart;
+		areaDescriptionPtr->maskInfoPtr = NULL;
+		areaDescriptionPtr->polygonFieldFlag = FALSE;
+		areaDescriptionPtr->rgnHandle = NULL;
+		
+		returnCode = GetMaskFieldsResults (areaDescriptionPtr,
+														fileIOInstructions1Ptr,
+														fileIOInstructions2Ptr,
+														clsfyVariablePtr,
+														maskInfoPtr,
+														maskValueCountIndexPtr);
+		
+		}	// end "if (returnCode == noErr && maskFieldsLineStart > 0)"
+		
+	maskValueCountIndexPtr = (SInt32*)CheckAndDisposePtr ((Ptr)maskValueCountIndexPtr);
+		
 	ClearAreaDescriptionOffsetVariables (areaDescriptionPtr);
 		
 			// List the performance table.													
@@ -18,7 +18,7 @@
 //
 //	Authors:					Larry L. Biehl
 //
-//	Revision date:			04/16/2020
+//	Revision date:			10/18/2026
 //
 //	Language:				C
 //
@@ -56,6 +56,14 @@ Boolean CheckMaskFileInfo (
 				Handle								fileInfoHandle,
 				SInt16*								errCodePtr);
 
+Boolean LoadMaskRunIndex (
+				Handle								maskHandle,
+				UInt32								maskNumberLines,
+				UInt32								maskNumberColumns,
+				UInt32								numberMaskRuns,
+				Handle*								maskLineRunIndexHandlePtr,
+				Handle*								maskRunHandlePtr);
+
 Boolean LoadNewMaskFields (
 				SInt16								maskSetCode,
 				MaskInfoPtr							maskInfoPtr,
@@ -426,6 +434,8 @@ void CloseMaskStructure (
 			
 		UnlockAndDispose (maskInfoPtr->maskHandle);
 		UnlockAndDispose (maskInfoPtr->maskValueToFieldHandle); 
+		UnlockAndDispose (maskInfoPtr->maskLineRunIndexHandle);
+		UnlockAndDispose (maskInfoPtr->maskRunHandle);
 									
 		InitializeMaskStructure (maskInfoPtr);
 		
@@ -510,6 +520,87 @@ Boolean DetermineIfMaskDataInLine (
 
 
 
+//------------------------------------------------------------------------------------
+//                   Copyright 1988-2020 Purdue Research Foundation
+//
+//	Function name:		Boolean DetermineIfMaskRunsInLine
+//
+//	Software purpose:	The purpose of this routine is to determine if any of the
+//							requested mask values exist in the input mask line using the
+//							run length index for the line instead of the mask buffer.
+//							Only the runs for the line are checked.
+//
+//	Parameters in:		Pointer to the first run for the mask line.
+//							Number of runs in the mask line.
+//
+//	Parameters out:	None
+//
+//	Value Returned:	TRUE if a requested mask value is in the sampled columns.
+//
+// Called By:			GetFirstMaskLine in SMask.cpp
+//							GetLineOfData in SFileIO.cpp
+//
+//	Coded By:			agent						Date: 10/18/2026
+//	Revised By:			agent						Date: 10/18/2026
+
+Boolean DetermineIfMaskRunsInLine (
+				MaskRunPtr							maskRunPtr,
+				UInt32								numberMaskRuns,
+				UInt32								maskColumnStart,
+				UInt32								numberSamples,
+				UInt32								columnInterval,
+				UInt32								maskValueRequest)
+
+{ 
+	UInt32								column,
+											columnEnd,
+											run,
+											runColumnEnd,
+											runColumnStart;
+	
+	
+	if (numberMaskRuns == 0 || numberSamples == 0)
+																							return (FALSE);
+	
+	columnEnd = maskColumnStart + numberSamples - 1;
+	
+	for (run=0; run<numberMaskRuns; run++)
+		{
+				// The runs are in column order.
+				
+		if (maskRunPtr->startColumn > columnEnd)
+			break;
+			
+		if (maskValueRequest == 0 || maskRunPtr->maskValue == maskValueRequest)
+			{
+			runColumnStart = MAX (maskRunPtr->startColumn, maskColumnStart);
+			runColumnEnd = MIN (maskRunPtr->endColumn, columnEnd);
+			
+			if (runColumnStart <= runColumnEnd)
+				{
+						// Move to the first column in the run that is sampled with the
+						// column interval being used.
+						
+				column = runColumnStart - maskColumnStart;
+				column = (column + columnInterval - 1) / columnInterval * columnInterval;
+				
+				if (maskColumnStart + column <= runColumnEnd)
+																							return (TRUE);
+				
+				}	// end "if (runColumnStart <= runColumnEnd)"
+				
+			}	// end "if (maskValueRequest == 0 || ..."
+			
+		maskRunPtr++;
+			
+		}	// end "for (run=0; run<numberMaskRuns; run++)"
+		
+	return (FALSE);
+	      
+}	// end "DetermineIfMaskRunsInLine"  
+
+
+
 //------------------------------------------------------------------------------------
 //                   Copyright 1988-2020 Purdue Research Foundation
 //
@@ -595,9 +686,12 @@ UInt32 GetFirstMaskLine (
 
 {
 	HUInt16Ptr							maskBufferPtr;
+	HUInt32Ptr							maskLineRunIndexPtr;
+	MaskRunPtr							maskRunPtr;
 	
 	UInt32								column,
 											line,
+											maskLineIndex,
 											numberMaskColumns,
 											maskExistsInLine;
 	
@@ -613,6 +707,41 @@ UInt32 GetFirstMaskLine (
 			// Initialize local variables.
 			
 	maskExistsInLine = 0;
+	
+			// Use the run length index for the mask if it is available. Only the
+			// runs in each line need to be checked.
+			
+	maskLineRunIndexPtr = (HUInt32Ptr)GetHandlePointer (
+																maskInfoPtr->maskLineRunIndexHandle);
+	maskRunPtr = (MaskRunPtr)GetHandlePointer (maskInfoPtr->maskRunHandle);
+	
+	if (maskLineRunIndexPtr != NULL && maskRunPtr != NULL && maskValueRequest != 0)
+		{
+		maskLineIndex = maskLineStart - 1;
+		
+		for (line=lineStart; line<=lineEnd; line+=lineInterval)
+			{
+			if (DetermineIfMaskRunsInLine (
+								&maskRunPtr[maskLineRunIndexPtr[maskLineIndex]],
+								maskLineRunIndexPtr[maskLineIndex+1] - 
+																maskLineRunIndexPtr[maskLineIndex],
+								maskColumnStart,
+								columnEnd - columnStart + 1,
+								columnInterval,
+								maskValueRequest))
+				{
+				maskExistsInLine = line;
+				break;
+				
+				}	// end "if (DetermineIfMaskRunsInLine (..."
+				
+			maskLineIndex += lineInterval;
+			
+			}	// end "for (line=lineStart; line<=lineEnd; line+=lineInterval)"
+			
+																					return (maskExistsInLine);
+		
+		}	// end "if (maskLineRunIndexPtr != NULL && maskRunPtr != NULL && ..."
 				
 	maskBufferPtr = (HUInt16Ptr)GetHandlePointer (maskInfoPtr->maskHandle);
 			
@@ -1415,12 +1544,15 @@ void InitializeMaskStructure (
 		maskInfoPtr->fileStreamHandle = NULL;
 		maskInfoPtr->maskHandle = NULL;
 		maskInfoPtr->maskValueToFieldHandle = NULL;
+		maskInfoPtr->maskLineRunIndexHandle = NULL;
+		maskInfoPtr->maskRunHandle = NULL;
 		
 		maskInfoPtr->fileLayer = 0;
 		maskInfoPtr->maxMaskValue = 0;
 		maskInfoPtr->numberColumns = 0;
 		maskInfoPtr->numberLines = 0;
 		maskInfoPtr->numberLayers = 0;
+		maskInfoPtr->numberMaskRuns = 0;
 		maskInfoPtr->startColumn = 0;
 		maskInfoPtr->startLine = 0;
 		
@@ -1470,11 +1602,14 @@ SInt16 LoadMask (
 											maskValueToFieldPtr;
 	
 	LayerInfoPtr						maskLayerInfoPtr;
+	MaskRunPtr							maskRunPtr;
 											
 	WindowInfoPtr						projectWindowInfoPtr,
 											maskWindowInfoPtr;
 	
 	Handle								maskHandle,
+											maskLineRunIndexHandle,
+											maskRunHandle,
 											maskValueToFieldHandle,
 											maskWindowInfoHandle;
 	
@@ -1490,7 +1625,10 @@ SInt16 LoadMask (
 											maskLineStart,
 											maskNumberColumns,
 											maskNumberLines,
-											maxMaskValue;
+											maxMaskValue,
+											numberMaskRuns,
+											previousMaskValue,
+											run;
 	
 	SInt16								errCode,
 											fileImageType,
@@ -1529,11 +1667,14 @@ SInt16 LoadMask (
 	
 	maskValueCountVector = NULL;
 	maskHandle = NULL;
+	maskLineRunIndexHandle = NULL;
+	maskRunHandle = NULL;
 	maskValueToFieldHandle = NULL;
 	continueFlag = TRUE;
 	errCode = noErr;
 	returnCode = 1;
 	maxMaskValue = 0;
+	numberMaskRuns = 0;
 
 	GetInformationPointers (&maskInfoHandleStatus, 
 										maskWindowInfoHandle,
@@ -1672,8 +1813,11 @@ SInt16 LoadMask (
 						// Check if there are any mask values in this line and get the
 						// maximum mask value. The maximum mask value will be used to 
 						// determine the length of the 'maskValueToField' vector.
+						// Also count the number of runs of nonzero mask values for
+						// the run length index.
 						
 				maskPointer[0] = 0;
+				previousMaskValue = 0;
 							
 				for (j=1; j<=maskNumberColumns; j++)
 					{
@@ -1682,8 +1826,13 @@ SInt16 LoadMask (
 						maxMaskValue = MAX (maxMaskValue, maskPointer[j]);
 						maskPointer[0] = 1;
 						
+						if (maskPointer[j] != previousMaskValue)
+							numberMaskRuns++;
+						
 						}	// end "if (maskPointer[j] > 0)"
 						
+					previousMaskValue = maskPointer[j];
+						
 					}	// end "for (j=0;..." 
 					
 				maskPointer += maskNumberColumns + 1;
@@ -1718,6 +1867,20 @@ SInt16 LoadMask (
 										&gInputBufferPtr, 
 										&gOutputBufferPtr);
 	
+	if (continueFlag)
+		{
+				// Build the run length index for the mask. The mask can still be
+				// used without it if it is not built.
+
+		LoadMaskRunIndex (maskHandle,
+								maskNumberLines,
+								maskNumberColumns,
+								numberMaskRuns,
+								&maskLineRunIndexHandle,
+								&maskRunHandle);
+
+		}	// end "if (continueFlag)"
+
 	if (continueFlag)
 		{
 				// Get memory for mask value to class vector if needed..
@@ -1762,24 +1925,42 @@ SInt16 LoadMask (
 			maskPointer = (HUInt16Ptr)GetHandlePointer (maskHandle);
 															
 					// First find which mask values are used.
+					
+			maskRunPtr = (MaskRunPtr)GetHandlePointer (maskRunHandle);
+			
+			if (maskRunPtr != NULL)
+				{
+				for (run=0; run<numberMaskRuns; run++)
+					{
+					maskValueCountVector[maskRunPtr->maskValue] += 
+										maskRunPtr->endColumn - maskRunPtr->startColumn + 1;
+					maskRunPtr++;
+					
+					}	// end "for (run=0; run<numberMaskRuns; run++)"
+					
+				}	// end "if (maskRunPtr != NULL)"
 										
-			for (line=1; line<=maskNumberLines; line++)
+			else	// maskRunPtr == NULL
 				{
-				if (maskPointer[0] > 0)
-					{	
-					for (j=1; j<=maskNumberColumns; j++)
+				for (line=1; line<=maskNumberLines; line++)
+					{
+					if (maskPointer[0] > 0)
 						{
-						if (maskPointer[j] > 0)
-							maskValueCountVector[maskPointer[j]]++;
-							
-						}	// end "for (j=0;..." 
-					
-					}	// end "if (maskPointer[0] > 0)"
-						
-				maskPointer += maskNumberColumns + 1;
-				
-				}	// end "for (line=1; line<=maskNumberLines; line++)"
-			
+						for (j=1; j<=maskNumberColumns; j++)
+							{
+							if (maskPointer[j] > 0)
+								maskValueCountVector[maskPointer[j]]++;
+
+							}	// end "for (j=0;..."
+
+						}	// end "if (maskPointer[0] > 0)"
+
+					maskPointer += maskNumberColumns + 1;
+
+					}	// end "for (line=1; line<=maskNumberLines; line++)"
+
+				}	// end "else maskRunPtr == NULL"
+
 			if (loadTypeCode == kNewMaskFields)
 				continueFlag = LoadNewMaskFields (maskSetCode,
 																maskInfoPtr,
@@ -1835,6 +2016,8 @@ SInt16 LoadMask (
 				
 		UnlockAndDispose (maskInfoPtr->maskHandle);
 		UnlockAndDispose (maskInfoPtr->maskValueToFieldHandle);
+		UnlockAndDispose (maskInfoPtr->maskLineRunIndexHandle);
+		UnlockAndDispose (maskInfoPtr->maskRunHandle);
 		
 				// Close the current mask file.
 				
@@ -1844,6 +2027,8 @@ SInt16 LoadMask (
 				
 		CheckAndUnlockHandle (maskHandle);
 		CheckAndUnlockHandle (maskValueToFieldHandle);
+		CheckAndUnlockHandle (maskLineRunIndexHandle);
+		CheckAndUnlockHandle (maskRunHandle);
 		
 				// Replace the previous mask information with the new mask 
 				// information.
@@ -1856,11 +2041,15 @@ SInt16 LoadMask (
 		maskInfoPtr->maskValueToFieldPtr = NULL;
 		maskInfoPtr->maskHandle = maskHandle;
 		maskInfoPtr->maskValueToFieldHandle = maskValueToFieldHandle;
+		maskInfoPtr->maskLineRunIndexHandle = maskLineRunIndexHandle;
+		maskInfoPtr->maskRunHandle = maskRunHandle;
 		maskInfoPtr->fileLayer = maskFileLayer;
 		maskInfoPtr->maxMaskValue = maxMaskValue;
 		maskInfoPtr->numberColumns = maskNumberColumns;
 		maskInfoPtr->numberLines = maskNumberLines;
 		maskInfoPtr->numberLayers = maskFileInfoPtr->numberChannels;
+		maskInfoPtr->numberMaskRuns = 
+								(maskRunHandle != NULL) ? numberMaskRuns : 0;
 		maskInfoPtr->startColumn = 
 								maskFileInfoPtr->startColumn + maskColumnStart - 1;
 		maskInfoPtr->startLine = 
@@ -1872,6 +2061,8 @@ SInt16 LoadMask (
 		{
 		UnlockAndDispose (maskHandle);
 		UnlockAndDispose (maskValueToFieldHandle);
+		UnlockAndDispose (maskLineRunIndexHandle);
+		UnlockAndDispose (maskRunHandle);
 		
 		}	// end "else !continueFlag"
 		
@@ -1967,6 +2158,133 @@ Handle LoadMaskFileInfo (
 	
 }	// end "LoadMask" 
 
+
+
+//------------------------------------------------------------------------------------
+//                   Copyright 1988-2020 Purdue Research Foundation
+//
+//	Function name:		Boolean LoadMaskRunIndex
+//
+//	Software purpose:	The purpose of this routine is to build the run length index
+//							for the input mask buffer. Each run is a span of columns in a
+//							line with the same nonzero mask value. The line index contains
+//							the index to the first run in each line plus an entry for the
+//							end of the last line. The index is only built if it is smaller
+//							than the mask buffer, i.e. for masks in which the labeled
+//							pixels are sparse or in blocks.
+//
+//	Parameters in:		Handle to the mask buffer.
+//							Number of lines and columns in the mask buffer.
+//							Number of runs in the mask buffer.
+//
+//	Parameters out:	Handle to the line index and handle to the runs.
+//
+//	Value Returned:	TRUE if the run length index was built.
+//
+// Called By:			LoadMask in SMask.cpp
+//
+//	Coded By:			agent						Date: 10/18/2026
+//	Revised By:			agent						Date: 10/18/2026
+
+Boolean LoadMaskRunIndex (
+				Handle								maskHandle,
+				UInt32								maskNumberLines,
+				UInt32								maskNumberColumns,
+				UInt32								numberMaskRuns,
+				Handle*								maskLineRunIndexHandlePtr,
+				Handle*								maskRunHandlePtr)
+
+{
+	SInt64								maskBytes,
+											runIndexBytes;
+	
+	HUInt16Ptr							maskPointer;
+	HUInt32Ptr							maskLineRunIndexPtr;
+	MaskRunPtr							maskRunPtr;
+	
+	UInt32								j,
+											line,
+											run;
+	
+	
+	*maskLineRunIndexHandlePtr = NULL;
+	*maskRunHandlePtr = NULL;
+	
+	maskPointer = (HUInt16Ptr)GetHandlePointer (maskHandle);
+	
+	if (maskPointer == NULL)
+																						return (FALSE);
+	
+			// Only use the run length index if it takes less memory than the mask
+			// buffer. Allow for at least one run so that the handle is not empty.
+	
+	maskBytes = (SInt64)maskNumberLines * (maskNumberColumns+1) * sizeof (UInt16);
+	runIndexBytes = (SInt64)MAX (numberMaskRuns, 1) * sizeof (MaskRun) +
+											(SInt64)(maskNumberLines+1) * sizeof (UInt32);
+	
+	if (runIndexBytes > maskBytes)
+																						return (FALSE);
+	
+	*maskLineRunIndexHandlePtr = MNewHandle (
+											(SInt64)(maskNumberLines+1) * sizeof (UInt32));
+	*maskRunHandlePtr = MNewHandle ((SInt64)MAX (numberMaskRuns, 1) * sizeof (MaskRun));
+	
+	maskLineRunIndexPtr = (HUInt32Ptr)GetHandlePointer (*maskLineRunIndexHandlePtr);
+	maskRunPtr = (MaskRunPtr)GetHandlePointer (*maskRunHandlePtr);
+	
+	if (maskLineRunIndexPtr == NULL || maskRunPtr == NULL)
+		{
+		UnlockAndDispose (*maskLineRunIndexHandlePtr);
+		UnlockAndDispose (*maskRunHandlePtr);
+		*maskLineRunIndexHandlePtr = NULL;
+		*maskRunHandlePtr = NULL;
+																						return (FALSE);
+		
+		}	// end "if (maskLineRunIndexPtr == NULL || maskRunPtr == NULL)"
+	
+	run = 0;
+	for (line=0; line<maskNumberLines; line++)
+		{
+		maskLineRunIndexPtr[line] = run;
+		
+				// The first value in each mask line indicates whether there are any
+				// mask values in the line.
+				
+		if (maskPointer[0] > 0)
+			{
+			j = 1;
+			while (j <= maskNumberColumns)
+				{
+				if (maskPointer[j] > 0)
+					{
+					maskRunPtr[run].startColumn = j;
+					maskRunPtr[run].maskValue = maskPointer[j];
+					
+					while (j < maskNumberColumns && 
+										maskPointer[j+1] == maskRunPtr[run].maskValue)
+						j++;
+						
+					maskRunPtr[run].endColumn = j;
+					run++;
+					
+					}	// end "if (maskPointer[j] > 0)"
+					
+				j++;
+					
+				}	// end "while (j <= maskNumberColumns)"
+				
+			}	// end "if (maskPointer[0] > 0)"
+			
+		maskPointer += maskNumberColumns + 1;
+		
+		}	// end "for (line=0; line<maskNumberLines; line++)"
+		
+	maskLineRunIndexPtr[maskNumberLines] = run;
+	
+	return (TRUE);
+	
+}	// end "LoadMaskRunIndex" 
+
 	
 
 //------------------------------------------------------------------------------------
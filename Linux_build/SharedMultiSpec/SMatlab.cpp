@@ -18,7 +18,7 @@
 //
 //	Authors:					Michael T. Gansler & Larry L. Biehl
 //
-//	Revision date:			01/05/2018
+//	Revision date:			10/18/2026
 //
 //	Language:				C
 //
@@ -94,14 +94,17 @@ void savemat (
 //	5/7/93 Revised : Michael Gansler
 //					 Remove imaginary portions for this application
 //
+//	The level 4 MAT-file matrix header is five 4-byte integers. 'long' is 8 bytes
+//	on 64-bit Linux and Mac OS, so fixed size integers are used for the fields.
+//
 
 typedef struct 
 	{
-	long 		type;	// type
-	long 		mrows;	// row dimension
-	long 		ncols;	// column dimension
-	long 		imagf;	// flag indicating imag part
-	long 		namlen;	// name length (including NULL)
+	SInt32 		type;	// type
+	SInt32 		mrows;	// row dimension
+	SInt32 		ncols;	// column dimension
+	SInt32 		imagf;	// flag indicating imag part
+	SInt32 		namlen;	// name length (including NULL)
 	
 	}	Fmatrix;
 
@@ -137,7 +140,7 @@ void savemat (
 	x.mrows = mrows;
 	x.ncols = ncols;
 	x.imagf = (SInt32)0;
-	x.namlen = (long)strlen (pname) + 1;
+	x.namlen = (SInt32)strlen (pname) + 1;
 	mn = x.mrows * x.ncols;
 	
 	temp = (SInt32)sizeof (Fmatrix);
@@ -187,7 +190,6 @@ void savematHeaderOnly (
 				
 {
 	Fmatrix								x;
-	SInt32								mn;
 	UInt32								temp;
 	SInt16								errCode;
 						
@@ -196,8 +198,7 @@ void savematHeaderOnly (
 	x.mrows = mrows;
 	x.ncols = ncols;
 	x.imagf = (SInt32)0;
-	x.namlen = (long)strlen (pname) + 1;
-	mn = x.mrows * x.ncols;
+	x.namlen = (SInt32)strlen (pname) + 1;
 	
 			// Write header structure
 				
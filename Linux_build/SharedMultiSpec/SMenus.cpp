@@ -18,7 +18,7 @@
 //
 //	Authors:					Larry L. Biehl
 //
-//	Revision date:			04/22/2020
+//	Revision date:			10/18/2026
 //
 //	Language:				C
 //
@@ -2677,11 +2677,13 @@ Boolean UpdateReformatChangeHeader (
 		returnFlag = FALSE;
 		
 			// Currently one can only add and modify headers for image files 		
-			// that have no header or are of ERDAS type.									
+			// that have no header, are of ERDAS type or have a header file that
+			// was written by MultiSpec.
 			
 	else if (fileInfoPtr->format != kErdas73Type &&
 					fileInfoPtr->format != kErdas74Type &&
-					fileInfoPtr->format != 0)
+					fileInfoPtr->format != 0 &&
+					!fileInfoPtr->multiSpecHeaderFileFlag)
 		returnFlag = FALSE;
 		
 	return (returnFlag);
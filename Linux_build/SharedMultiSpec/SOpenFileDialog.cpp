@@ -18,7 +18,7 @@
 //
 //	Authors:					Larry L. Biehl
 //
-//	Revision date:			05/31/2020
+//	Revision date:			10/18/2026
 //
 //	Language:				C
 //
@@ -4496,7 +4496,7 @@ SInt16 FileSpecificationDialogSetDataType (
 //							OpenSeparateImageWindows in SOpenFileDialog.cpp
 //
 //	Coded By:			Larry L. Biehl			Date: 04/07/2007
-//	Revised By:			Larry L. Biehl			Date: 01/15/2013	
+//	Revised By:			agent						Date: 10/18/2026	
 
 SInt16 LinkFiles (
 				SInt16								fileFormat,
@@ -4512,6 +4512,9 @@ SInt16 LinkFiles (
 	else if (fileFormat == kNdfType)
 		returnCode = LinkNDFFiles (windowInfoHandle);
 
+	else if (fileFormat == kMultiSpecStackType)
+		returnCode = LinkMultiSpecStackFiles (windowInfoHandle);
+
 	return (returnCode);
 
 }	// end "LinkFiles"
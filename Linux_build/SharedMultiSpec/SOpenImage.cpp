@@ -18,7 +18,7 @@
 //
 //	Authors:					Larry L. Biehl
 //
-//	Revision date:			08/29/2020
+//	Revision date:			10/18/2026
 //
 //	Language:				C
 //
@@ -92,6 +92,11 @@
 	#define	IDS_Dialog33						33
 	#define	IDS_FileIO158						158
 	#define	IDS_FileIO160						160
+	#define	IDS_FileIO204						204
+	#define	IDS_FileIO205						205
+	#define	IDS_FileIO206						206
+	#define	IDS_FileIO207						207
+	#define	IDS_FileIO208						208
 
 	extern GDHandle GetDevicePointIsIn (
 			  Point* locationPtr);
@@ -268,6 +273,18 @@ Boolean ReadMultiSpecClassNames (
 				Handle								windowInfoHandle,
 				UCharPtr								classNamePtr);
 
+SInt16 ReadMultiSpecHeaderFile (
+				FileInfoPtr							fileInfoPtr,
+				char*									headerRecordPtr,
+				SInt16								formatOnlyCode);
+
+SInt16 ReadMultiSpecStackHeader (
+				FileInfoPtr							fileInfoPtr,
+				char*									headerRecordPtr,
+				SInt16*								versionPtr,
+				UInt32								fileNumber,
+				SInt16								formatOnlyCode);
+
 SInt16 ReadPDSHeader (
 				FileInfoPtr							fileInfoPtr,
 				char*									headerRecordPtr,
@@ -299,6 +316,12 @@ SInt16 ReadWindowsBitMapHeader (
 				SInt16								formatOnlyCode);
 
 
+		// Descriptor file for the MultiSpec virtual band stack being loaded. It is
+		// used to locate the other band files when they are linked to the window.
+
+static CMFileStream					sStackDescriptorFileStream;
+
+
 
 //------------------------------------------------------------------------------------
 //                   Copyright 1988-2020 Purdue Research Foundation
@@ -318,6 +341,7 @@ SInt16 ReadWindowsBitMapHeader (
 // Called By:			LinkNDFFiles in SNDFFormat.cpp
 //							AddSelectedFilesToWindow in SOpenFileDialog.cpp
 //							LinkFastL7AFiles in SOpenImag.cpp
+//							LinkMultiSpecStackFiles in SOpenImage.cpp
 //
 //	Coded By:			Larry L. Biehl			Date: 08/21/1991
 //	Revised By:			Larry L. Biehl			Date: 09/05/2017	
@@ -1360,7 +1384,7 @@ SInt32 CheckIfProjectFile (
 // Called By:			LoadImageInformation	in SOpenImage.cpp	
 //
 //	Coded By:			Larry L. Biehl			Date: 08/23/1988
-//	Revised By:			Larry L. Biehl			Date: 03/30/2020
+//	Revised By:			agent						Date: 10/18/2026
 
 SInt16 CheckImageHeader (
 				Handle								windowInfoHandle,
@@ -1462,6 +1486,13 @@ SInt16 CheckImageHeader (
 		headerRecordPtr[count] = 0;
 
 				// Determine the image file format.
+				// First check if MultiSpec has written a header file for this image
+				// file. It takes precedence over any header in the image file.
+
+		if (fileInfoPtr->format == 0 && formatOnlyCode == kLoadHeader)
+			returnCode = ReadMultiSpecHeaderFile (
+											fileInfoPtr, headerRecordPtr, formatOnlyCode);
+
 				//  Check if image file is in ERDAS format.
 
 		if (fileInfoPtr->format == 0 && count >= 128)
@@ -1551,6 +1582,23 @@ SInt16 CheckImageHeader (
 				*formatVersionCodePtr = version;
 
 			}	// end "if (fileInfoPtr->format == 0 && count >= 128)"
+
+				// Check if this is a MultiSpec virtual band stack descriptor file.
+
+		if (fileInfoPtr->format == 0 && count >= 16)
+			{
+			returnCode = ReadMultiSpecStackHeader (fileInfoPtr,
+																	headerRecordPtr,
+																	&version,
+																	1,
+																	formatOnlyCode);
+
+			if (fileInfoPtr->format == kMultiSpecStackType &&
+                    returnCode == noErr &&
+                    formatVersionCodePtr != NULL)
+				*formatVersionCodePtr = version;
+
+			}	// end "if (fileInfoPtr->format == 0 && count >= 16)"
 		/*			
 		if (fileInfoPtr->format == 0 && count >= 128)
 			{
@@ -6122,6 +6170,120 @@ SInt16 LinkFastL7AFiles (
 
 
 
+//------------------------------------------------------------------------------------
+//                   Copyright 1988-2020 Purdue Research Foundation
+//
+//	Function name:		SInt16 LinkMultiSpecStackFiles
+//
+//	Software purpose:	The purpose of this routine is to link the band files after
+//							the first one that are listed in a MultiSpec virtual band
+//							stack descriptor file to the image window. The band files
+//							are read in place; no new image file is created.
+//
+//	Parameters in:		Handle to the image window information structure
+//
+//	Parameters out:	None
+//
+// Value Returned:	noErr if all of the band files in the descriptor were linked
+//							1 if not
+// 
+// Called By:			LinkFiles in SOpenFileDialog.cpp
+//
+//	Coded By:			agent						Date: 10/18/2026
+//	Revised By:			agent						Date: 10/18/2026
+
+SInt16 LinkMultiSpecStackFiles (
+				Handle								windowInfoHandle)
+
+{
+	FileInfoPtr							fileInfoPtr;
+
+	Handle								fileInfoHandle;
+
+	UInt32								fileNumber;
+
+	SInt16								readReturnCode,
+											returnCode,
+											version;
+
+	Boolean								continueFlag = FALSE,
+											doneFlag;
+
+
+	returnCode = 1;
+	fileInfoHandle = MNewHandle (sizeof (MFileInfo));
+
+	if (fileInfoHandle != NULL)
+		{
+		fileNumber = 1;
+		doneFlag = FALSE;
+
+		while (!doneFlag)
+			{
+			continueFlag = FALSE;
+			fileNumber++;
+
+					// Initialize the variables and handles in the structure.
+
+			InitializeFileInfoStructure (fileInfoHandle, kNotPointer);
+
+			fileInfoPtr = (FileInfoPtr)GetHandlePointer (fileInfoHandle, kLock);
+
+					// Load the specifications for the next band file in the
+					// descriptor. The descriptor file is the one that was saved when
+					// the first band file was loaded.
+
+			readReturnCode = ReadMultiSpecStackHeader (fileInfoPtr,
+																		NULL,
+																		&version,
+																		fileNumber,
+																		kLoadHeader);
+
+			if (readReturnCode == noErr)
+				{
+						// Check if parameters make sense
+
+				if (CheckFileInfoParameters (fileInfoPtr) == 1)
+					{
+							// Set some additional parameters.
+
+					IntermediateFileUpdate (fileInfoPtr);
+
+							// Add this file to the current window.
+
+					continueFlag = AddToImageWindowFile (windowInfoHandle, fileInfoHandle);
+
+					}	// end "if (CheckFileInfoParameters (fileInfoPtr) == 1)"
+
+				}	// end "if (readReturnCode == noErr)"
+
+			else if (readReturnCode == 1)
+				{
+						// There are no more band files listed in the descriptor.
+
+				continueFlag = TRUE;
+				doneFlag = TRUE;
+
+				}	// end "else if (readReturnCode == 1)"
+
+			if (!continueFlag)
+				doneFlag = TRUE;
+
+			}	// end "while (!doneFlag)"
+
+		}	// end "if (fileInfoHandle != NULL)"
+
+	DisposeFileInfoHandle (fileInfoHandle);
+
+	if (continueFlag)
+		returnCode = noErr;
+
+	return (returnCode);
+
+}	// end "LinkMultiSpecStackFiles"
+
+
+
 //------------------------------------------------------------------------------------
 //                   Copyright 1988-2020 Purdue Research Foundation
 //
@@ -12246,6 +12408,629 @@ Boolean ReadMultiSpecClassNames (
 
 
 
+//------------------------------------------------------------------------------------
+//                   Copyright 1988-2020 Purdue Research Foundation
+//
+//	Function name:		SInt16 ReadMultiSpecHeaderFile
+//
+//	Software purpose:	This routine checks whether there is an ENVI formatted header
+//							file next to the image file that was written by MultiSpec. If
+//							so, the image file specifications are read from it. This
+//							header file takes precedence over any header information in
+//							the image file since it represents changes that the user has
+//							made. Only the image file name with .hdr added to the end is
+//							checked. The base name with any suffix removed is not used as
+//							CheckForENVIHeader does since that header file may belong to
+//							another image file with the same base name.
+//
+//	Parameters in:		file information pointer
+//							pointer to header record information for the image file
+//
+//	Parameters out:	None
+//
+//	Value Returned:	0 - if a MultiSpec header file was found and read
+//							1 - if not.
+//
+// Called By:			CheckImageHeader in SOpenImage.cpp
+//
+//	Coded By:			agent						Date: 10/18/2026
+//	Revised By:			agent						Date: 10/18/2026
+
+SInt16 ReadMultiSpecHeaderFile (
+				FileInfoPtr							fileInfoPtr,
+				char*									headerRecordPtr,
+				SInt16								formatOnlyCode)
+
+{
+	char									headerFileRecord[5000];
+
+	CMFileStream						headerFileStream;
+
+	FileStringPtr						headerFileNamePtr;
+
+	CMFileStream						*fileStreamPtr,
+											*headerFileStreamPtr;
+
+	UInt32								count;
+
+	SInt32								numberClasses = 0;
+
+	SInt16								errCode,
+											returnCode = 1,
+											tReturnCode;
+
+
+	if (fileInfoPtr == NULL || formatOnlyCode != kLoadHeader)
+																					return (returnCode);
+
+			// Check if there is a header file with .hdr added to the image file name.
+
+	fileStreamPtr = GetFileStreamPointer (fileInfoPtr);
+
+	headerFileStreamPtr = &headerFileStream;
+	InitializeFileStream (headerFileStreamPtr, fileStreamPtr);
+
+	headerFileNamePtr =
+				(FileStringPtr)GetFilePathPPointerFromFileStream (headerFileStreamPtr);
+
+	ConcatFilenameSuffix (headerFileNamePtr, (StringPtr)"\0.hdr\0");
+	errCode = OpenFileReadOnly (headerFileStreamPtr,
+										 kResolveAliasChains,
+										 kLockFile,
+										 kVerifyFileStream);
+
+	if (errCode == noErr)
+		errCode = MSetMarker (headerFileStreamPtr, fsFromStart, 0, kNoErrorMessages);
+
+			// Read no more than the first 4995 bytes of data.
+
+	count = 4995;
+	if (errCode == noErr)
+		{
+		errCode = MReadData (headerFileStreamPtr,
+									&count,
+									headerFileRecord,
+									kNoErrorMessages);
+
+		if (errCode == eofErr && count > 10)
+			errCode = noErr;
+
+		}	// end "if (errCode == noErr)"
+
+	CloseFile (headerFileStreamPtr);
+
+	if (errCode != noErr)
+																					return (returnCode);
+
+	headerFileRecord[count] = 0;
+
+			// Verify that this is an ENVI header file and that the description
+			// indicates that MultiSpec wrote it.
+
+	if (strncmp (headerFileRecord, "ENVI", 4) == 0 &&
+							strstr (headerFileRecord, "MultiSpec header file") != NULL)
+		{
+				// Get the number of classes if the header file is for a thematic
+				// image.
+
+		if (strstr (headerFileRecord, "ENVI Classification") != NULL)
+			{
+			numberClasses = GetFileHeaderValue (kFileIOStrID,
+															IDS_FileIO208, // classes
+															headerFileRecord,
+															1,
+															kSkipEqual,
+															&tReturnCode);
+
+			if (tReturnCode != 0)
+				numberClasses = 0;
+
+			if (gGetFileImageType == 0 && numberClasses > 0)
+				gGetFileImageType = kThematicImageType;
+
+			}	// end "if (strstr (headerFileRecord, "ENVI Classification") != NULL)"
+
+		returnCode = ReadENVIHeader (fileInfoPtr, headerFileRecord, formatOnlyCode);
+
+		#if include_gdal_capability
+			if (fileInfoPtr->format == kENVIType)
+				{
+						// Read the image file with the GDAL library as is done for
+						// other ENVI header files. GDAL will use the same header file.
+
+				fileInfoPtr->format = 0;
+				returnCode = ReadHeaderWithGDALLibrary (fileInfoPtr,
+																		headerRecordPtr,
+																		formatOnlyCode);
+
+				}	// end "if (fileInfoPtr->format == kENVIType)"
+		#endif	// include_gdal_capability
+
+		if (fileInfoPtr->format != 0)
+			{
+			fileInfoPtr->multiSpecHeaderFileFlag = TRUE;
+
+			if (gGetFileImageType == kThematicImageType && numberClasses > 0)
+				{
+				fileInfoPtr->numberClasses = (UInt32)numberClasses;
+				fileInfoPtr->maxClassNumberValue = fileInfoPtr->numberClasses - 1;
+
+				}	// end "if (gGetFileImageType == kThematicImageType && ..."
+
+			}	// end "if (fileInfoPtr->format != 0)"
+
+		}	// end "if (strncmp (headerFileRecord, "ENVI", 4) == 0 && ..."
+
+	return (returnCode);
+
+}	// end "ReadMultiSpecHeaderFile"
+
+
+
+//------------------------------------------------------------------------------------
+//                   Copyright 1988-2020 Purdue Research Foundation
+//
+//	Function name:		SInt16 ReadMultiSpecStackHeader
+//
+//	Software purpose:	This routine reads the specifications for one band file from
+//							a MultiSpec virtual band stack descriptor file. The
+//							descriptor is a text file that lists a set of single band
+//							raw files to be treated as one multispectral image without
+//							reformatting them. The format is:
+//								MULTISPEC_STACK
+//								samples = 1000;
+//								lines = 800;
+//								data type = 12;
+//								byte order = 0;
+//								header offset = 0;
+//								data ignore value = 0;
+//								FILE = band1.raw;
+//								FILE = band2.raw; band = 1; header offset = 512;
+//							The global items use the same keywords and data type codes
+//							as ENVI headers. 'header offset' and 'data ignore value'
+//							may also be given for each file which overrides the global
+//							setting. 'band' is the 1-based band in a band sequential
+//							file to use. The file names are relative to the folder
+//							that the descriptor file is in.
+//
+//	Parameters in:		file information pointer
+//							pointer to header record information. Only used for the
+//								first file.
+//							file number of the band file in the descriptor to load.
+//
+//	Parameters out:	version 1 indicating that the other band files in the
+//								descriptor are to be linked.
+//
+//	Value Returned:	0 - if the band file was found and opened.
+//							1 - if this is not a stack descriptor file or there is no
+//									band file for the input file number.
+//							other - an error occurred.
+//
+// Called By:			CheckImageHeader in SOpenImage.cpp
+//							LinkMultiSpecStackFiles in SOpenImage.cpp
+//
+//	Coded By:			agent						Date: 10/18/2026
+//	Revised By:			agent						Date: 10/18/2026
+
+SInt16 ReadMultiSpecStackHeader (
+				FileInfoPtr							fileInfoPtr,
+				char*									headerRecordPtr,
+				SInt16*								versionPtr,
+				UInt32								fileNumber,
+				SInt16								formatOnlyCode)
+
+{
+	double								noDataValue,
+											realValue;
+
+	SInt64								bandOffset,
+											fileSize;
+
+	char									*endOfEntryPtr,
+											*ioBufferPtr,
+											*strPtr;
+
+	CMFileStream*						fileStreamPtr;
+
+	FileStringPtr						filePathPPtr;
+
+	SInt32								bandNumber,
+											headerOffset,
+											value;
+
+	UInt32								count,
+											entry;
+
+	UInt16								pathLength;
+
+	SInt16								errCode,
+											returnCode,
+											tReturnCode;
+
+	Boolean								foundFlag,
+											noDataValueFlag;
+
+	char									savedCharacter;
+
+
+	returnCode = 1;
+	fileStreamPtr = GetFileStreamPointer (fileInfoPtr);
+
+	if (fileStreamPtr == NULL)
+																					return (returnCode);
+
+	*versionPtr = 1;
+	if (fileNumber == 1)
+		{
+				// Determine if this is a MultiSpec virtual band stack descriptor file.
+
+		if (headerRecordPtr == NULL ||
+						!MGetString (gTextString2, kFileIOStrID, IDS_FileIO204))
+																					return (returnCode);
+
+		CopyPascalStringToC ((ConstStr255Param)gTextString2, (char*)gTextString2);
+		if (strncmp (headerRecordPtr,
+							(char*)gTextString2,
+							strlen ((char*)gTextString2)) != 0)
+																					return (returnCode);
+
+		if (formatOnlyCode != kLoadHeader)
+			{
+			fileInfoPtr->format = kMultiSpecStackType;
+			fileInfoPtr->thematicType = FALSE;
+																					return (noErr);
+
+			}	// end "if (formatOnlyCode != kLoadHeader)"
+
+				// Save the descriptor file so that the other band files can be
+				// located when they are linked to the image window.
+
+		InitializeFileStream (&sStackDescriptorFileStream, fileStreamPtr);
+
+		}	// end "if (fileNumber == 1)"
+
+	else	// fileNumber > 1
+		InitializeFileStream (fileStreamPtr, &sStackDescriptorFileStream);
+
+			// Read the entire descriptor file. The header record passed in may
+			// not contain all of it.
+
+	errCode = noErr;
+	if (!FileOpen (fileStreamPtr))
+		errCode = OpenFileReadOnly (fileStreamPtr,
+												kResolveAliasChains,
+												kLockFile,
+												kVerifyFileStream);
+
+	if (errCode == noErr)
+		errCode = GetSizeOfFile (fileStreamPtr, &fileSize);
+
+	ioBufferPtr = NULL;
+	if (errCode == noErr)
+		{
+		ioBufferPtr = (char*)MNewPointer (fileSize + 1);
+		if (ioBufferPtr == NULL)
+			errCode = -1;
+
+		}	// end "if (errCode == noErr)"
+
+	if (errCode == noErr)
+		errCode = MSetMarker (fileStreamPtr, fsFromStart, 0, kErrorMessages);
+
+	count = (UInt32)fileSize;
+	if (errCode == noErr)
+		errCode = MReadData (fileStreamPtr, &count, ioBufferPtr, kErrorMessages);
+
+	foundFlag = FALSE;
+	if (errCode == noErr)
+		{
+		ioBufferPtr[count] = 0;
+
+				// Save the path length so that the band file names can be placed
+				// after the folder path of the descriptor file.
+
+		pathLength = 0;
+		#if defined multispec_wx || defined multispec_win
+			pathLength = fileStreamPtr->GetFileUTF8PathLength ();
+		#endif
+
+		filePathPPtr = (FileStringPtr)GetFilePathPPointerFromFileStream (fileStreamPtr);
+		CloseFile (fileStreamPtr);
+
+				// Get the string that starts each band file entry.
+
+		if (MGetString (gTextString3, kFileIOStrID, IDS_FileIO205))
+			CopyPascalStringToC ((ConstStr255Param)gTextString3, (char*)gTextString3);
+
+		else	// !MGetString (gTextString3, kFileIOStrID, IDS_FileIO205)
+			errCode = -1;
+
+		}	// end "if (errCode == noErr)"
+
+	if (errCode == noErr)
+		{
+				// The global items are before the first band file entry. Put a c
+				// string terminator there so that the searches end there for now.
+
+		endOfEntryPtr = (char*)StrStrNoCase (ioBufferPtr, (char*)gTextString3);
+		if (endOfEntryPtr == NULL)
+			errCode = -1;
+
+		}	// end "if (errCode == noErr)"
+
+	if (errCode == noErr)
+		{
+		savedCharacter = *endOfEntryPtr;
+		*endOfEntryPtr = 0;
+
+				// Find "samples = " in the buffer.
+
+		value = GetFileHeaderValue (kFileIOStrID,
+												IDS_FileIO114, // samples
+												ioBufferPtr,
+												1,
+												kSkipEqual,
+												&tReturnCode);
+
+		if (tReturnCode == 0 && value > 0)
+			fileInfoPtr->numberColumns = value;
+
+		else	// tReturnCode != 0 || value <= 0
+			errCode = -1;
+
+				// Find "lines = " in the buffer.
+
+		value = GetFileHeaderValue (kFileIOStrID,
+												IDS_FileIO115, // lines
+												ioBufferPtr,
+												1,
+												kSkipEqual,
+												&tReturnCode);
+
+		if (tReturnCode == 0 && value > 0)
+			fileInfoPtr->numberLines = value;
+
+		else	// tReturnCode != 0 || value <= 0
+			errCode = -1;
+
+				// Find "data type = " in the buffer. The ENVI data type codes
+				// are used.
+
+		value = GetFileHeaderValue (kFileIOStrID,
+												IDS_FileIO118, // data type
+												ioBufferPtr,
+												1,
+												kSkipEqual,
+												&tReturnCode);
+
+		if (tReturnCode != 0)
+			value = 1;
+
+		fileInfoPtr->dataTypeCode = kIntegerType;
+		fileInfoPtr->signedDataFlag = FALSE;
+		switch (value)
+			{
+			case 1:
+				fileInfoPtr->numberBytes = 1;
+				fileInfoPtr->numberBits = 8;
+				break;
+
+			case 2:
+				fileInfoPtr->numberBytes = 2;
+				fileInfoPtr->numberBits = 16;
+				fileInfoPtr->signedDataFlag = TRUE;
+				break;
+
+			case 3:
+				fileInfoPtr->numberBytes = 4;
+				fileInfoPtr->numberBits = 32;
+				fileInfoPtr->signedDataFlag = TRUE;
+				break;
+
+			case 4:
+				fileInfoPtr->numberBytes = 4;
+				fileInfoPtr->numberBits = 32;
+				fileInfoPtr->signedDataFlag = TRUE;
+				fileInfoPtr->dataTypeCode = kRealType;
+				break;
+
+			case 5:
+				fileInfoPtr->numberBytes = 8;
+				fileInfoPtr->numberBits = 64;
+				fileInfoPtr->signedDataFlag = TRUE;
+				fileInfoPtr->dataTypeCode = kRealType;
+				break;
+
+			case 12:
+				fileInfoPtr->numberBytes = 2;
+				fileInfoPtr->numberBits = 16;
+				break;
+
+			case 13:
+				fileInfoPtr->numberBytes = 4;
+				fileInfoPtr->numberBits = 32;
+				break;
+
+			default:
+				errCode = -1;
+
+			}	// end "switch (value)"
+
+				// Find "byte order = " in the buffer. The data is assumed to be in
+				// the native byte order if it is not given.
+
+		value = GetFileHeaderValue (kFileIOStrID,
+												IDS_FileIO120, // byte order =
+												ioBufferPtr,
+												1,
+												kSkipEqual,
+												&tReturnCode);
+
+		fileInfoPtr->swapBytesFlag = FALSE;
+		if (tReturnCode == 0 && value >= 0 && fileInfoPtr->numberBytes >= 2)
+			{
+			fileInfoPtr->swapBytesFlag = !gBigEndianFlag;
+			if (value == 0)
+				fileInfoPtr->swapBytesFlag = gBigEndianFlag;
+
+			}	// end "if (tReturnCode == 0 && value >= 0 && ..."
+
+				// Find the default "header offset = " in the buffer.
+
+		headerOffset = GetFileHeaderValue (kFileIOStrID,
+														IDS_FileIO117, // header offset
+														ioBufferPtr,
+														1,
+														kSkipEqual,
+														&tReturnCode);
+
+		if (tReturnCode != 0 || headerOffset < 0)
+			headerOffset = 0;
+
+				// Find the default "data ignore value = " in the buffer.
+
+		noDataValue = GetFileHeaderRealValue (kFileIOStrID,
+															IDS_FileIO207, // data ignore value
+															ioBufferPtr,
+															1,
+															kSkipEqual,
+															&tReturnCode);
+
+		noDataValueFlag = (tReturnCode == 0);
+
+		*endOfEntryPtr = savedCharacter;
+
+		}	// end "if (errCode == noErr)"
+
+	if (errCode == noErr)
+		{
+				// Now find the entry for the requested band file. The name is
+				// placed after the folder path for the descriptor file.
+
+		strPtr = ioBufferPtr;
+		for (entry=1; entry<=fileNumber; entry++)
+			{
+			tReturnCode = GetFileHeaderString (kFileIOStrID,
+															IDS_FileIO205, // FILE =
+															&strPtr,
+															-3,
+															kDoNotSkipEqual,
+															(char*)filePathPPtr,
+															pathLength,
+															254,
+															kNoSubstringAllowed);
+
+			if (tReturnCode != 0 || strPtr == NULL)
+				break;
+
+			}	// end "for (entry=1; entry<=fileNumber; entry++)"
+
+		foundFlag = (entry > fileNumber);
+
+		}	// end "if (errCode == noErr)"
+
+	if (foundFlag)
+		{
+				// Limit the searches for the items for this band file to the
+				// characters before the next band file entry.
+
+		endOfEntryPtr = (char*)StrStrNoCase (strPtr, (char*)gTextString3);
+		if (endOfEntryPtr != NULL)
+			*endOfEntryPtr = 0;
+
+		bandNumber = GetFileHeaderValue (kFileIOStrID,
+													IDS_FileIO206, // band
+													strPtr,
+													1,
+													kSkipEqual,
+													&tReturnCode);
+
+		if (tReturnCode != 0 || bandNumber < 1)
+			bandNumber = 1;
+
+		value = GetFileHeaderValue (kFileIOStrID,
+												IDS_FileIO117, // header offset
+												strPtr,
+												1,
+												kSkipEqual,
+												&tReturnCode);
+
+		if (tReturnCode == 0 && value >= 0)
+			headerOffset = value;
+
+		realValue = GetFileHeaderRealValue (kFileIOStrID,
+														IDS_FileIO207, // data ignore value
+														strPtr,
+														1,
+														kSkipEqual,
+														&tReturnCode);
+
+		if (tReturnCode == 0)
+			{
+			noDataValue = realValue;
+			noDataValueFlag = TRUE;
+
+			}	// end "if (tReturnCode == 0)"
+
+				// Each band file is handled as a one channel band sequential file.
+				// The band to be used in a multiple band file is skipped over by
+				// including the bytes for the bands before it in the header.
+
+		bandOffset = (SInt64)(bandNumber - 1) * fileInfoPtr->numberLines *
+									fileInfoPtr->numberColumns * fileInfoPtr->numberBytes;
+
+		if (headerOffset + bandOffset > UInt32_MAX)
+			errCode = -1;
+
+		fileInfoPtr->numberHeaderBytes = (UInt32)(headerOffset + bandOffset);
+		fileInfoPtr->numberChannels = 1;
+		fileInfoPtr->bandInterleave = kBSQ;
+		fileInfoPtr->noDataValue = noDataValue;
+		fileInfoPtr->noDataValueFlag = noDataValueFlag;
+
+		if (errCode == noErr)
+			errCode = OpenFileReadOnly (fileStreamPtr,
+													kResolveAliasChains,
+													kLockFile,
+													kVerifyFileStream);
+
+		if (errCode == noErr)
+			{
+			returnCode = noErr;
+
+					// Determine the image type if it has not been determined yet.
+
+			if (gGetFileImageType == 0)
+				{
+				gGetFileImageType = kMultispectralImageType;
+				fileInfoPtr->numberClasses = 0;
+
+				}	// end "if (gGetFileImageType == 0)"
+
+			fileInfoPtr->format = kMultiSpecStackType;
+
+			fileInfoPtr->thematicType = FALSE;
+			if (gGetFileImageType == kThematicImageType)
+				fileInfoPtr->thematicType = TRUE;
+
+			}	// end "if (errCode == noErr)"
+
+		else	// errCode != noErr
+			returnCode = errCode;
+
+		}	// end "if (foundFlag)"
+
+	else if (errCode != noErr)
+		returnCode = errCode;
+
+	CheckAndDisposePtr (ioBufferPtr);
+
+	return (returnCode);
+
+}	// end "ReadMultiSpecStackHeader"
+
+
+
 //------------------------------------------------------------------------------------
 //                   Copyright 1988-2020 Purdue Research Foundation
 //
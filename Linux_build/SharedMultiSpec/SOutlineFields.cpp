@@ -18,7 +18,7 @@
 //
 //	Authors:					Larry L. Biehl
 //
-//	Revision date:			03/07/2020
+//	Revision date:			10/18/2026
 //
 //	Language:				C
 //
@@ -51,10 +51,30 @@
 			// Prototypes for routines in this file that are only called by		
 			// other routines in this file.	
 			
+void CheckFieldOutlineCacheVariables (
+				LCToWindowUnitsVariablesPtr	cacheVariablesPtr,
+				Boolean*								validPtr,
+				SInt16								numberStorageFields,
+				LCToWindowUnitsVariablesPtr	lcToWindowUnitsVariablesPtr);
+			
 double GetAngle (
 				HPFieldPointsPtr					originPointPtr,
 				HPFieldPointsPtr					endPointPtr);
 			
+FieldOutlineCachePtr GetFieldOutlineCache (
+				Handle								windowInfoHandle);
+			
+void GetFieldOutlineLabelPoint (
+				SInt16								fieldNumber,
+				Handle								windowInfoHandle,
+				LCToWindowUnitsVariablesPtr	lcToWindowUnitsVariablesPtr,
+				LongPoint*							labelPointPtr);
+			
+LongPoint* GetFieldOutlineWindowPoints (
+				SInt16								fieldNumber,
+				Handle								windowInfoHandle,
+				LCToWindowUnitsVariablesPtr	lcToWindowUnitsVariablesPtr);
+			
 double GetHalfAngle (
 				HPFieldPointsPtr					lastPointPtr,
 				HPFieldPointsPtr					currentPointPtr,
@@ -82,6 +102,64 @@ void OutlineProjectFields (
 
 
 
+//------------------------------------------------------------------------------------
+//                   Copyright 1988-2020 Purdue Research Foundation
+//
+//	Function name:		void CheckFieldOutlineCacheVariables
+//
+//	Software purpose:	The purpose of this routine is to mark the cached points for
+//							all fields as not valid if any of the variables that
+//							ConvertLCToWinPoint uses, other than the channel window
+//							offset, have changed since the points were converted. This
+//							happens when the window is zoomed and, in the Macintosh
+//							version, when it is scrolled.
+//
+//	Parameters in:		Pointer to the variables the cached points were converted with.
+//							Pointer to the valid flags for the cached points.
+//							Number of fields the valid flags are allocated for.
+//							Pointer to the current line-column to window units variables.
+//
+//	Parameters out:	None
+//
+// Value Returned:	None
+//
+// Called By:			GetFieldOutlineLabelPoint
+//							GetFieldOutlineWindowPoints
+//
+//	Coded By:			agent						Date: 10/18/2026
+//	Revised By:			agent						Date: 10/18/2026
+
+void CheckFieldOutlineCacheVariables (
+				LCToWindowUnitsVariablesPtr	cacheVariablesPtr,
+				Boolean*								validPtr,
+				SInt16								numberStorageFields,
+				LCToWindowUnitsVariablesPtr	lcToWindowUnitsVariablesPtr)
+
+{
+	if (cacheVariablesPtr->magnification != lcToWindowUnitsVariablesPtr->magnification ||
+			cacheVariablesPtr->xOrigin != lcToWindowUnitsVariablesPtr->xOrigin ||
+			cacheVariablesPtr->yOrigin != lcToWindowUnitsVariablesPtr->yOrigin ||
+			cacheVariablesPtr->columnInterval !=
+												lcToWindowUnitsVariablesPtr->columnInterval ||
+			cacheVariablesPtr->lineInterval != lcToWindowUnitsVariablesPtr->lineInterval ||
+			cacheVariablesPtr->columnOffset != lcToWindowUnitsVariablesPtr->columnOffset ||
+			cacheVariablesPtr->lineOffset != lcToWindowUnitsVariablesPtr->lineOffset ||
+			cacheVariablesPtr->imageTopOffset !=
+												lcToWindowUnitsVariablesPtr->imageTopOffset ||
+			cacheVariablesPtr->imageLeftOffset !=
+												lcToWindowUnitsVariablesPtr->imageLeftOffset)
+		{
+		*cacheVariablesPtr = *lcToWindowUnitsVariablesPtr;
+		cacheVariablesPtr->channelWindowOffset = 0;
+		
+		memset (validPtr, 0, (size_t)numberStorageFields * sizeof (Boolean));
+		
+		}	// end "if (cacheVariablesPtr->magnification != ..."
+		
+}	// end "CheckFieldOutlineCacheVariables"
+
+
+
 //------------------------------------------------------------------------------------
 //                   Copyright 1988-2020 Purdue Research Foundation
 //
@@ -105,7 +183,7 @@ void OutlineProjectFields (
 // 						PolygonListStatMode 		(in SStatistics.cpp)
 //
 //	Coded By:			Larry L. Biehl			Date: 01/12/1989
-//	Revised By:			Larry L. Biehl			Date: 04/08/2019
+//	Revised By:			agent						Date: 10/18/2026
 
 void ForceFieldOutlineUpdate (
 				Boolean								forceFlag)
@@ -120,6 +198,11 @@ void ForceFieldOutlineUpdate (
 											windowListIndex;
 		
 			
+			// The fields may have changed so the cached window points for the
+			// field outlines need to be recomputed.
+			
+	InvalidateFieldOutlineCache ();
+	
 			// If fields are to be outlined in the image windows, go through 		
 			// window list to find the project image windows and force an 			
 			// update event so that only the input field is outlined.				
@@ -190,6 +273,257 @@ double GetAngle (
 
 
 
+//------------------------------------------------------------------------------------
+//                   Copyright 1988-2020 Purdue Research Foundation
+//
+//	Function name:		FieldOutlineCachePtr GetFieldOutlineCache
+//
+//	Software purpose:	The purpose of this routine is to get the field outline cache
+//							for the input image window. The memory for the cache is
+//							allocated the first time the fields are drawn in the window
+//							and again when the number of project fields or points grows.
+//							The cached points for all fields are marked as not valid if
+//							the project fields have changed since the cache was last used.
+//
+//	Parameters in:		Window information handle for the window being drawn.
+//
+//	Parameters out:	None
+//
+// Value Returned:	Pointer to the field outline cache for the window.
+//							NULL if memory for the cache is not available.
+//
+// Called By:			GetFieldOutlineLabelPoint
+//							GetFieldOutlineWindowPoints
+//
+//	Coded By:			agent						Date: 10/18/2026
+//	Revised By:			agent						Date: 10/18/2026
+
+FieldOutlineCachePtr GetFieldOutlineCache (
+				Handle								windowInfoHandle)
+
+{
+	FieldOutlineCachePtr				fieldOutlineCachePtr;
+	WindowInfoPtr						windowInfoPtr;
+	
+	
+	windowInfoPtr = (WindowInfoPtr)GetHandlePointer (windowInfoHandle);
+	if (windowInfoPtr == NULL)
+																							return (NULL);
+	
+	fieldOutlineCachePtr = windowInfoPtr->fieldOutlineCachePtr;
+	if (fieldOutlineCachePtr == NULL)
+		{
+		fieldOutlineCachePtr = (FieldOutlineCachePtr)MNewPointerClear (
+																		sizeof (FieldOutlineCache));
+		if (fieldOutlineCachePtr == NULL)
+																							return (NULL);
+		
+		windowInfoPtr->fieldOutlineCachePtr = fieldOutlineCachePtr;
+		
+		}	// end "if (fieldOutlineCachePtr == NULL)"
+	
+	if (fieldOutlineCachePtr->numberStorageFields <
+													gProjectInfoPtr->numberStorageFields ||
+				fieldOutlineCachePtr->numberStoragePoints <
+													gProjectInfoPtr->numberStoragePoints)
+		{
+				// Get new memory for the cache to allow for the current number of
+				// fields and points.
+				
+		ReleaseFieldOutlineCacheMemory (windowInfoPtr);
+		
+		fieldOutlineCachePtr = (FieldOutlineCachePtr)MNewPointerClear (
+																		sizeof (FieldOutlineCache));
+		if (fieldOutlineCachePtr == NULL)
+																							return (NULL);
+		
+		windowInfoPtr->fieldOutlineCachePtr = fieldOutlineCachePtr;
+		
+		fieldOutlineCachePtr->labelPointsPtr = (LongPoint*)MNewPointer (
+							(SInt64)gProjectInfoPtr->numberStorageFields * sizeof (LongPoint));
+		
+		fieldOutlineCachePtr->pointsPtr = (LongPoint*)MNewPointer (
+							(SInt64)gProjectInfoPtr->numberStoragePoints * sizeof (LongPoint));
+		
+		fieldOutlineCachePtr->labelValidPtr = (Boolean*)MNewPointerClear (
+							(SInt64)gProjectInfoPtr->numberStorageFields * 2 * sizeof (Boolean));
+		
+		if (fieldOutlineCachePtr->labelPointsPtr == NULL ||
+					fieldOutlineCachePtr->pointsPtr == NULL ||
+							fieldOutlineCachePtr->labelValidPtr == NULL)
+			{
+			ReleaseFieldOutlineCacheMemory (windowInfoPtr);
+																							return (NULL);
+			
+			}	// end "if (fieldOutlineCachePtr->labelPointsPtr == NULL || ..."
+		
+		fieldOutlineCachePtr->pointsValidPtr = &fieldOutlineCachePtr->labelValidPtr[
+															gProjectInfoPtr->numberStorageFields];
+		
+		fieldOutlineCachePtr->numberStorageFields = gProjectInfoPtr->numberStorageFields;
+		fieldOutlineCachePtr->numberStoragePoints = gProjectInfoPtr->numberStoragePoints;
+		fieldOutlineCachePtr->fieldsGeneration = gFieldOutlineGeneration;
+		
+		}	// end "if (fieldOutlineCachePtr->numberStorageFields < ..."
+		
+	else if (fieldOutlineCachePtr->fieldsGeneration != gFieldOutlineGeneration)
+		{
+				// The project fields have been added, removed or edited since the
+				// cache was last used.
+				
+		memset (fieldOutlineCachePtr->labelValidPtr,
+					0,
+					(size_t)fieldOutlineCachePtr->numberStorageFields * 2 * sizeof (Boolean));
+		fieldOutlineCachePtr->fieldsGeneration = gFieldOutlineGeneration;
+		
+		}	// end "else if (fieldOutlineCachePtr->fieldsGeneration != ..."
+		
+	return (fieldOutlineCachePtr);
+		
+}	// end "GetFieldOutlineCache"
+
+
+
+//------------------------------------------------------------------------------------
+//                   Copyright 1988-2020 Purdue Research Foundation
+//
+//	Function name:		void GetFieldOutlineLabelPoint
+//
+//	Software purpose:	The purpose of this routine is to get the point in window
+//							units to start drawing the label for the input polygon field.
+//							The point is taken from the field outline cache for the window
+//							if it is valid for the current magnification and origin.
+//
+//	Parameters in:		Field number.
+//							Window information handle for the window being drawn.
+//							Pointer to line-column to window units variables.
+//
+//	Parameters out:	Pointer to the label point in window units.
+//
+// Value Returned:	None
+//
+// Called By:			OutlineField
+//
+//	Coded By:			agent						Date: 10/18/2026
+//	Revised By:			agent						Date: 10/18/2026
+
+void GetFieldOutlineLabelPoint (
+				SInt16								fieldNumber,
+				Handle								windowInfoHandle,
+				LCToWindowUnitsVariablesPtr	lcToWindowUnitsVariablesPtr,
+				LongPoint*							labelPointPtr)
+
+{
+	FieldOutlineCachePtr				fieldOutlineCachePtr;
+	
+	
+	fieldOutlineCachePtr = GetFieldOutlineCache (windowInfoHandle);
+	if (fieldOutlineCachePtr == NULL)
+		{
+		ConvertLCToWinPoint (&gProjectInfoPtr->fieldIdentPtr[fieldNumber].labelPoint,
+									labelPointPtr,
+									lcToWindowUnitsVariablesPtr);
+																									return;
+		
+		}	// end "if (fieldOutlineCachePtr == NULL)"
+	
+	CheckFieldOutlineCacheVariables (&fieldOutlineCachePtr->labelVariables,
+												fieldOutlineCachePtr->labelValidPtr,
+												fieldOutlineCachePtr->numberStorageFields,
+												lcToWindowUnitsVariablesPtr);
+	
+	if (!fieldOutlineCachePtr->labelValidPtr[fieldNumber])
+		{
+		ConvertLCToWinPoint (&gProjectInfoPtr->fieldIdentPtr[fieldNumber].labelPoint,
+									&fieldOutlineCachePtr->labelPointsPtr[fieldNumber],
+									&fieldOutlineCachePtr->labelVariables);
+		
+		fieldOutlineCachePtr->labelValidPtr[fieldNumber] = TRUE;
+		
+		}	// end "if (!fieldOutlineCachePtr->labelValidPtr[fieldNumber])"
+		
+	labelPointPtr->v = fieldOutlineCachePtr->labelPointsPtr[fieldNumber].v;
+	labelPointPtr->h = fieldOutlineCachePtr->labelPointsPtr[fieldNumber].h +
+											lcToWindowUnitsVariablesPtr->channelWindowOffset;
+		
+}	// end "GetFieldOutlineLabelPoint"
+
+
+
+//------------------------------------------------------------------------------------
+//                   Copyright 1988-2020 Purdue Research Foundation
+//
+//	Function name:		LongPoint* GetFieldOutlineWindowPoints
+//
+//	Software purpose:	The purpose of this routine is to get the vertices of the
+//							input polygon field in window units from the field outline
+//							cache for the window. The vertices are only converted from
+//							line-column units with ConvertLCToWinPoint when the field has
+//							changed or the window has been zoomed or scrolled since they
+//							were last converted. The channel window offset is not included
+//							in the cached points; it is added for each side by side
+//							channel when the points are drawn.
+//
+//	Parameters in:		Field number.
+//							Window information handle for the window being drawn.
+//							Pointer to line-column to window units variables.
+//
+//	Parameters out:	None
+//
+// Value Returned:	Pointer to the cached window points. They are indexed the same
+//								as the project field points.
+//							NULL if memory for the cache is not available.
+//
+// Called By:			OutlineField
+//
+//	Coded By:			agent						Date: 10/18/2026
+//	Revised By:			agent						Date: 10/18/2026
+
+LongPoint* GetFieldOutlineWindowPoints (
+				SInt16								fieldNumber,
+				Handle								windowInfoHandle,
+				LCToWindowUnitsVariablesPtr	lcToWindowUnitsVariablesPtr)
+
+{
+	FieldOutlineCachePtr				fieldOutlineCachePtr;
+	HPFieldPointsPtr					fieldPointsPtr;
+	LongPoint*							windowPointsPtr;
+	
+	SInt32								pointCount,
+											pointIndex;
+	
+	
+	fieldOutlineCachePtr = GetFieldOutlineCache (windowInfoHandle);
+	if (fieldOutlineCachePtr == NULL)
+																							return (NULL);
+	
+	CheckFieldOutlineCacheVariables (&fieldOutlineCachePtr->pointsVariables,
+												fieldOutlineCachePtr->pointsValidPtr,
+												fieldOutlineCachePtr->numberStorageFields,
+												lcToWindowUnitsVariablesPtr);
+	
+	if (!fieldOutlineCachePtr->pointsValidPtr[fieldNumber])
+		{
+		pointIndex = gProjectInfoPtr->fieldIdentPtr[fieldNumber].firstPolygonPoint + 2;
+		fieldPointsPtr = &gProjectInfoPtr->fieldPointsPtr[pointIndex];
+		windowPointsPtr = &fieldOutlineCachePtr->pointsPtr[pointIndex];
+		
+		pointCount = gProjectInfoPtr->fieldIdentPtr[fieldNumber].numberOfPolygonPoints;
+		for (pointIndex=0; pointIndex<pointCount; pointIndex++)
+			ConvertLCToWinPoint ((LongPoint*)&fieldPointsPtr[pointIndex],
+										&windowPointsPtr[pointIndex],
+										&fieldOutlineCachePtr->pointsVariables);
+		
+		fieldOutlineCachePtr->pointsValidPtr[fieldNumber] = TRUE;
+		
+		}	// end "if (!fieldOutlineCachePtr->pointsValidPtr[fieldNumber])"
+		
+	return (fieldOutlineCachePtr->pointsPtr);
+		
+}	// end "GetFieldOutlineWindowPoints"
+
+
+
 //------------------------------------------------------------------------------------
 //                   Copyright 1988-2020 Purdue Research Foundation
 //
@@ -543,6 +877,40 @@ void GetPolygonLabelPoint (
 
 
 
+//------------------------------------------------------------------------------------
+//                   Copyright 1988-2020 Purdue Research Foundation
+//
+//	Function name:		void InvalidateFieldOutlineCache
+//
+//	Software purpose:	The purpose of this routine is to indicate that the field
+//							outlines and label points cached for the image windows need to
+//							be converted to window units again the next time that the
+//							fields are drawn. This is done when fields have been added,
+//							removed or edited and when the project is closed.
+//
+//	Parameters in:		None
+//
+//	Parameters out:	None
+//
+// Value Returned:	None
+//
+// Called By:			AdjustFieldBoundaries in SProject.cpp
+//							ReleaseProjectHandles in SProject.cpp
+//							ForceFieldOutlineUpdate
+//							OutlineFieldsInProjectWindows
+//
+//	Coded By:			agent						Date: 10/18/2026
+//	Revised By:			agent						Date: 10/18/2026
+
+void InvalidateFieldOutlineCache (void)
+
+{
+	gFieldOutlineGeneration++;
+	
+}	// end "InvalidateFieldOutlineCache"
+
+
+
 //------------------------------------------------------------------------------------
 //                   Copyright 1988-2020 Purdue Research Foundation
 //
@@ -567,7 +935,7 @@ void GetPolygonLabelPoint (
 //							StatisticsDialog in SStatistics.cpp
 //
 //	Coded By:			Larry L. Biehl			Date: 05/10/1990
-//	Revised By:			Larry L. Biehl			Date: 04/09/2019
+//	Revised By:			agent						Date: 10/18/2026
 
 void OutlineFieldsInProjectWindows (
 				SInt16								statsWindowMode,
@@ -582,6 +950,8 @@ void OutlineFieldsInProjectWindows (
 	SInt16								windowCount,
 											windowListIndex;
 		
+	
+	InvalidateFieldOutlineCache ();
 			
 			// If fields are to be outlined in the image windows, go through 		
 			// window list to find the project image windows and call the			
@@ -1255,7 +1625,7 @@ void OutlineClassFields (
 //							OutlineClassFields.c		in SOutlineFields.cpp
 //
 //	Coded By:			Larry L. Biehl			Date: 01/10/1989
-//	Revised By:			Larry L. Biehl			Date: 04/07/2019
+//	Revised By:			agent						Date: 10/18/2026
 
 void OutlineField (
 				SInt16								classNumber, 
@@ -1269,6 +1639,7 @@ void OutlineField (
 	HPFieldIdentifiersPtr			fieldIdentPtr;
 	HPFieldPointsPtr					fieldPointsPtr;
 	
+	LongPoint*							windowPointsPtr;
 	LongRect*							LCRectPtr; 
 												
 	LongPoint							drawPoint,
@@ -1552,9 +1923,10 @@ void OutlineField (
 											&labelPoint);
 			fieldIdentPtr[fieldNumber].labelPoint = labelPoint;
 			*/
-			ConvertLCToWinPoint (&fieldIdentPtr[fieldNumber].labelPoint,
-											&drawPoint, 
-											lcToWindowUnitsVariablesPtr);
+			GetFieldOutlineLabelPoint (fieldNumber,
+												windowInfoHandle,
+												lcToWindowUnitsVariablesPtr,
+												&drawPoint);
 											
 					// Now draw the field outline
 					// Note that the first two paired values represent the bounding box for
@@ -1568,6 +1940,15 @@ void OutlineField (
 			savedChannelWindowOffset = lcToWindowUnitsVariablesPtr->channelWindowOffset;
 			
 			#ifndef multispec_wx	
+						// Get the vertices in window units from the outline cache for
+						// the window. They only need to be converted again when the
+						// window is zoomed or scrolled or the field is edited.
+						
+				windowPointsPtr = GetFieldOutlineWindowPoints (
+															fieldNumber,
+															windowInfoHandle,
+															lcToWindowUnitsVariablesPtr);
+				
 				for (channel=gStartChannel; channel<gSideBySideChannels; channel++)
 					{				
 					if (changeClipFlag)
@@ -1605,9 +1986,18 @@ void OutlineField (
 					
 					while (pointCount > 1)
 						{
-						ConvertLCToWinPoint ((LongPoint*)&fieldPointsPtr[pointIndex++], 
-														&nextPoint, 
-														lcToWindowUnitsVariablesPtr);
+						if (windowPointsPtr != NULL)
+							{
+							nextPoint.v = windowPointsPtr[pointIndex].v;
+							nextPoint.h = windowPointsPtr[pointIndex++].h +
+											lcToWindowUnitsVariablesPtr->channelWindowOffset;
+							
+							}	// end "if (windowPointsPtr != NULL)"
+							
+						else	// windowPointsPtr == NULL
+							ConvertLCToWinPoint ((LongPoint*)&fieldPointsPtr[pointIndex++], 
+															&nextPoint, 
+															lcToWindowUnitsVariablesPtr);
 
 						#if defined multispec_mac
 							LineTo ((SInt16)nextPoint.h, (SInt16)nextPoint.v);
@@ -1675,6 +2065,11 @@ void OutlineField (
 														 FALSE,
 														 lcToWindowUnitsVariablesPtr);
 				
+				windowPointsPtr = GetFieldOutlineWindowPoints (
+															fieldNumber,
+															windowInfoHandle,
+															lcToWindowUnitsVariablesPtr);
+				
 				pointCount = fieldIdentPtr[fieldNumber].numberOfPolygonPoints;  
 				wxPoint* pointlist = new wxPoint[pointCount];
 				scrollOffset = imageViewCPtr->m_Canvas->GetScrollPosition ();
@@ -1688,9 +2083,18 @@ void OutlineField (
 			
 				for (int index = 0; index < pointCount; index++)
 					{
-					ConvertLCToWinPoint ((LongPoint*) & fieldPointsPtr[pointIndex++],
-												&windowPoint,
-												lcToWindowUnitsVariablesPtr);
+					if (windowPointsPtr != NULL)
+						{
+						windowPoint.v = windowPointsPtr[pointIndex].v;
+						windowPoint.h = windowPointsPtr[pointIndex++].h +
+											lcToWindowUnitsVariablesPtr->channelWindowOffset;
+						
+						}	// end "if (windowPointsPtr != NULL)"
+						
+					else	// windowPointsPtr == NULL
+						ConvertLCToWinPoint ((LongPoint*) & fieldPointsPtr[pointIndex++],
+													&windowPoint,
+													lcToWindowUnitsVariablesPtr);
 					
 					pointlist[index].x = windowPoint.h;
 					pointlist[index].y = windowPoint.v;
@@ -1904,3 +2308,47 @@ void OutlineField (
 		
 }	// end "OutlineField" 
 
+
+
+//------------------------------------------------------------------------------------
+//                   Copyright 1988-2020 Purdue Research Foundation
+//
+//	Function name:		void ReleaseFieldOutlineCacheMemory
+//
+//	Software purpose:	The purpose of this routine is to release the memory for the
+//							field outline cache for the input image window.
+//
+//	Parameters in:		Pointer to the window information structure.
+//
+//	Parameters out:	None
+//
+// Value Returned:	None
+//
+// Called By:			GetFieldOutlineCache
+//							DisposeOfImageWindowSupportMemory in SWindowInfo.cpp
+//							~CMWindowInfo in SWindowInfo_class.cpp
+//
+//	Coded By:			agent						Date: 10/18/2026
+//	Revised By:			agent						Date: 10/18/2026
+
+void ReleaseFieldOutlineCacheMemory (
+				WindowInfoPtr						windowInfoPtr)
+
+{
+	FieldOutlineCachePtr				fieldOutlineCachePtr;
+	
+	
+	if (windowInfoPtr != NULL && windowInfoPtr->fieldOutlineCachePtr != NULL)
+		{
+		fieldOutlineCachePtr = windowInfoPtr->fieldOutlineCachePtr;
+		
+		CheckAndDisposePtr ((Ptr)fieldOutlineCachePtr->labelPointsPtr);
+		CheckAndDisposePtr ((Ptr)fieldOutlineCachePtr->pointsPtr);
+		CheckAndDisposePtr ((Ptr)fieldOutlineCachePtr->labelValidPtr);
+		
+		windowInfoPtr->fieldOutlineCachePtr = (FieldOutlineCachePtr)CheckAndDisposePtr (
+																			(Ptr)fieldOutlineCachePtr);
+		
+		}	// end "if (windowInfoPtr != NULL && ..."
+		
+}	// end "ReleaseFieldOutlineCacheMemory"
@@ -18,7 +18,7 @@
 //
 //	Authors:					Larry L. Biehl
 //
-//	Revision date:			04/12/2020
+//	Revision date:			10/18/2026
 //
 //	Language:				C
 //
@@ -238,7 +238,7 @@ SInt16 WriteStatistics (
 // Called By:			ChangeProjectBaseImage in SProject
 //
 //	Coded By:			Larry L. Biehl			Date: 06/26/1990
-//	Revised By:			Larry L. Biehl			Date: 07/14/1997	
+//	Revised By:			agent						Date: 10/18/2026	
 
 void AdjustFieldBoundaries (
 				FileInfoPtr							fileInfoPtr)
@@ -280,6 +280,8 @@ void AdjustFieldBoundaries (
 		
 		}	// end "for (point=0; ..."
 		
+	InvalidateFieldOutlineCache ();
+		
 	return;																						
 																				
 }	// end "AdjustFieldBoundaries" 
@@ -3244,7 +3246,7 @@ void InitializeNewProject (
 // Called By:	
 //
 //	Coded By:			Larry L. Biehl			Date: 12/29/1988
-//	Revised By:			Larry L. Biehl			Date: 12/06/2019
+//	Revised By:			agent						Date: 10/18/2026
 
 void InitializeProjectStructure (
 				Handle								projectInfoHandle,
@@ -3281,6 +3283,15 @@ void InitializeProjectStructure (
 		gProjectInfoPtr->knnLabelsPtr = NULL;
 		gProjectInfoPtr->knnDataValuesPtr = NULL;
 		gProjectInfoPtr->knnCounter = 0;
+		
+		gProjectInfoPtr->classNameIndexPtr = NULL;
+		gProjectInfoPtr->fieldNameIndexPtr = NULL;
+		gProjectInfoPtr->classNameIndexSize = 0;
+		gProjectInfoPtr->fieldNameIndexSize = 0;
+		gProjectInfoPtr->nameIndexStatisticsClasses = -1;
+		gProjectInfoPtr->nameIndexStatisticsFields = -1;
+		gProjectInfoPtr->nameIndexStorageClasses = -1;
+		gProjectInfoPtr->nameIndexStorageFields = -1;
 			
 		gProjectInfoPtr->startLine = 1;
 		gProjectInfoPtr->startColumn = 1;
@@ -4196,7 +4207,7 @@ void	OpenProjectImageWindow (void)
 //							CreateNewProject in SProject.cpp
 //
 //	Coded By:			Larry L. Biehl			Date: 03/22/1991
-//	Revised By:			Larry L. Biehl			Date: 08/15/2019
+//	Revised By:			agent						Date: 10/18/2026
 
 void ReleaseProjectHandles (
 				ProjectInfoPtr						inputProjectInfoPtr)
@@ -4289,6 +4300,17 @@ void ReleaseProjectHandles (
 		
 		gProjectInfoPtr->knnDataValuesPtr =
 										CheckAndDisposePtr (gProjectInfoPtr->knnDataValuesPtr);
+		
+		gProjectInfoPtr->classNameIndexPtr = (SInt16*)CheckAndDisposePtr (
+													(Ptr)gProjectInfoPtr->classNameIndexPtr);
+		
+		gProjectInfoPtr->fieldNameIndexPtr = (SInt16*)CheckAndDisposePtr (
+													(Ptr)gProjectInfoPtr->fieldNameIndexPtr);
+
+				// The field outlines cached for the image windows are no longer
+				// valid.
+				
+		InvalidateFieldOutlineCache ();
 
 		}	// end "if (inputProjectInfoPtr != NULL)" 
 		
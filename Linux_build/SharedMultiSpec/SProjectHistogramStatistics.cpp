@@ -18,7 +18,7 @@
 //
 //	Authors:					Larry L. Biehl
 //
-//	Revision date:			12/06/2019
+//	Revision date:			10/18/2026
 //
 //	Language:				C
 //
@@ -105,6 +105,10 @@ void	 	GetSumOfClassFieldColumns (
 				HUInt32Ptr							histogramDataPtr, 
 				UInt32								numberColumns);
 
+SInt32 	GetStatFieldHistogramSlot (
+				SInt16								fieldNumber,
+				Boolean*								loadedFlagPtr);
+
 void 		GetTransformedChannelMinMaxes (
 				UInt16								numberOutputChannels, 
 				UInt16*								channelListPtr,
@@ -162,6 +166,11 @@ Boolean 	LoadGraphData (
 				FileInfoPtr							fileInfoPtr,
 				SInt16								indexStart);
 
+void 		MergeStatFieldHistogram (
+				SInt32								fieldSlot,
+				UInt32								indexStart,
+				UInt16								channelStart);
+
 void 		LoadProjectClassFieldNames (
 				Str31*								stringPtr,
 				Boolean								classNameFlag);
@@ -181,6 +190,11 @@ void 		SetSomeStatHistogramGraphParameters (
 				GraphPtr								graphRecordPtr,
 				SInt16								statsWindowMode);
 
+void 		SetupStatFieldHistogramAccumulators (
+				FileInfoPtr							fileInfoPtr, 
+				SInt16								statsWindowMode,
+				SInt16								outputGroupCode);
+
 Boolean	SetupStatHistogramMemory (
 				FileInfoPtr							fileInfoPtr, 
 				SInt16								statsWindowMode);
@@ -655,6 +669,86 @@ void GetSumOfClassFieldColumns (
 
 
 
+//------------------------------------------------------------------------------------
+//                   Copyright 1988-2020 Purdue Research Foundation
+//
+//	Function name:		SInt32 GetStatFieldHistogramSlot
+//
+//	Software purpose:	The purpose of this routine is to get the accumulator slot
+//							for the field histogram of the input field. If the field has
+//							not been read yet, the next free slot is initialized with the
+//							bin layout for each feature and returned. The caller marks
+//							the slot as loaded after the field has been read.
+//
+//	Parameters in:		Field number
+//
+//	Parameters out:	Flag indicating whether the slot already contains the field
+//								histogram
+//
+// Value Returned:	Slot index; -1 if no accumulator is available.
+// 
+// Called By:			HistogramFieldStats
+//
+//	Coded By:			agent						Date: 10/18/2026
+//	Revised By:			agent						Date: 10/18/2026
+
+SInt32 GetStatFieldHistogramSlot (
+				SInt16								fieldNumber,
+				Boolean*								loadedFlagPtr)
+
+{
+	HUInt32Ptr							endHistogramDataPtr,
+											histogramDataPtr;
+											
+	SInt32								fieldSlot;
+	
+	UInt32								numberBins,
+											numberFeatures;
+	
+	
+	*loadedFlagPtr = FALSE;
+	
+	if (gStatHistogramSpecsPtr->fieldHistogramBufferPtr == NULL)
+																							return (-1);
+	
+	fieldSlot = gStatHistogramSpecsPtr->fieldHistogramSlotPtr[fieldNumber];
+	if (fieldSlot >= 0)
+		{
+		*loadedFlagPtr = TRUE;
+																					return (fieldSlot);
+																					
+		}	// end "if (fieldSlot >= 0)"
+	
+	fieldSlot = gStatHistogramSpecsPtr->numberFieldHistogramSlotsUsed;
+	if (fieldSlot >= gStatHistogramSpecsPtr->numberFieldHistogramSlots)
+																							return (-1);
+	
+	numberBins = gStatHistogramSpecsPtr->initialNumberHistogramDataBins;
+	numberFeatures = gStatHistogramSpecsPtr->numberFeatures;
+	
+			// The bin layout for each feature is stored after the last slot.
+			
+	BlockMoveData (
+		&gStatHistogramSpecsPtr->fieldHistogramRangePtr[
+			gStatHistogramSpecsPtr->numberFieldHistogramSlots*numberFeatures],
+		&gStatHistogramSpecsPtr->fieldHistogramRangePtr[fieldSlot*numberFeatures],
+		numberFeatures*sizeof (HistogramSummary));
+	
+	histogramDataPtr = &gStatHistogramSpecsPtr->fieldHistogramDataPtr[
+														(UInt32)fieldSlot*numberFeatures*numberBins];
+	endHistogramDataPtr = &histogramDataPtr[numberFeatures*numberBins];
+			
+	for (; histogramDataPtr<endHistogramDataPtr; histogramDataPtr++)
+		*histogramDataPtr = 0;
+		
+	gStatHistogramSpecsPtr->fieldHistogramCountPtr[fieldSlot] = 0;
+	
+	return (fieldSlot);
+			
+}	// end "GetStatFieldHistogramSlot" 
+
+
+
 //------------------------------------------------------------------------------------
 //                   Copyright 1988-2020 Purdue Research Foundation
 //
@@ -1179,6 +1273,7 @@ SInt16 HistogramFieldStats (
 	
 	SInt32								column,
 											countSkip,
+											fieldSlot,
 											line,
 											lineEnd,
 											lineInterval,
@@ -1203,8 +1298,12 @@ SInt16 HistogramFieldStats (
 											localNumberChannels,
 											numberFeatures,
 											returnCode;
+	
+	UInt16								fieldHistogramChannel;
 											
 	Boolean								eigenvectorTypeFlag,
+											fieldHistogramFillFlag,
+											fieldHistogramLoadedFlag,
 											histogramIndexSkipFlag,
 											polygonFieldFlag,
 											transformDataFlag,
@@ -1247,6 +1346,9 @@ SInt16 HistogramFieldStats (
 	histogramDataPtr = gStatHistogramSpecsPtr->histogramDataPtr;
 	histogramRangePtr = gStatHistogramSpecsPtr->histogramRangePtr;
 	totalNumberPixels = 0;
+	fieldSlot = -1;
+	fieldHistogramChannel = 0;
+	fieldHistogramFillFlag = FALSE;
 	
 			// Save the field number for this field in case it is needed later as
 			// "the last field used".
@@ -1322,20 +1424,64 @@ SInt16 HistogramFieldStats (
 				
 		else	// outputGroupCode == kClassFieldGrouping
 			{
-					// Set parameters for listing class or field data in a 
-					// field/class grouping.
-					// Note that the input value is used for channelStart.	
-			
-			featureNumber = channelStart;	
+					// If the histograms for this field have already been compiled
+					// for all features, just merge the histogram for this channel
+					// into the requested column.
+					
+			fieldSlot = GetStatFieldHistogramSlot (fieldNumber,
+																&fieldHistogramLoadedFlag);
 			
-			localNumberChannels = 1;
-			if (transformDataFlag)	
+			if (fieldHistogramLoadedFlag)
+				{
+				MergeStatFieldHistogram (fieldSlot, indexStart, channelStart);
+																								return (1);
+																								
+				}	// end "if (fieldHistogramLoadedFlag)"
+				
+			if (fieldSlot >= 0)
+				{
+						// Set parameters for compiling the histograms for all features
+						// of the field into the field accumulator.
+						
+				fieldHistogramFillFlag = TRUE;
+				fieldHistogramChannel = channelStart;
+				
+				featureNumber = 0;
+				channelStart = 0;
 				localNumberChannels = gStatHistogramSpecsPtr->numberChannels;
-			
-			storageColumnStart = indexStart;
-			storageColumnEnd = indexStart + 1;
-			
-			histogramIndex = indexStart * numberBins;
+				localChannelsPtr = (UInt16*)GetHandlePointer (
+															gStatHistogramSpecsPtr->channelsHandle);
+				
+				storageColumnStart = 0;
+				storageColumnEnd = gStatHistogramSpecsPtr->numberFeatures;
+				
+				histogramDataPtr = &gStatHistogramSpecsPtr->fieldHistogramDataPtr[
+															(UInt32)fieldSlot*numberFeatures*numberBins];
+				histogramRangePtr = &gStatHistogramSpecsPtr->fieldHistogramRangePtr[
+																				fieldSlot*numberFeatures];
+				
+				histogramIndex = 0;
+				
+				}	// end "if (fieldSlot >= 0)"
+				
+			else	// fieldSlot < 0
+				{
+						// Set parameters for listing class or field data in a 
+						// field/class grouping.
+						// Note that the input value is used for channelStart.	
+				
+				featureNumber = channelStart;	
+				
+				localNumberChannels = 1;
+				if (transformDataFlag)	
+					localNumberChannels = gStatHistogramSpecsPtr->numberChannels;
+				
+				storageColumnStart = indexStart;
+				storageColumnEnd = indexStart + 1;
+				
+				histogramIndex = indexStart * numberBins;
+				
+				}	// end "else fieldSlot < 0"
 			
 			}	// end "if (outputGroupCode == kClassFieldGrouping)" 
 		
@@ -1428,7 +1574,8 @@ SInt16 HistogramFieldStats (
 	histogramIndexSkipFlag = FALSE;
 	if (outputGroupCode == kChannelGrouping || 
 				gStatHistogramSpecsPtr->histogramOutputCode == kPlotData || 
-						gStatHistogramSpecsPtr->histogramOutputCode == 0)
+						gStatHistogramSpecsPtr->histogramOutputCode == 0 ||
+								fieldHistogramFillFlag)
 		histogramIndexSkipFlag = TRUE;	
 		
 	updateNumberLinesFlag = TRUE;
@@ -1611,6 +1758,20 @@ SInt16 HistogramFieldStats (
 																								
 	if (gStatHistogramSpecsPtr->histogramOutputCode == 0)
 																								return (1);
+																								
+	if (fieldHistogramFillFlag)
+		{
+				// Mark the field accumulator as loaded and merge the histogram for
+				// the requested channel into the requested column.
+				
+		gStatHistogramSpecsPtr->fieldHistogramCountPtr[fieldSlot] = totalNumberPixels;
+		gStatHistogramSpecsPtr->fieldHistogramSlotPtr[fieldNumber] = fieldSlot;
+		gStatHistogramSpecsPtr->numberFieldHistogramSlotsUsed++;
+		
+		MergeStatFieldHistogram (fieldSlot, indexStart, fieldHistogramChannel);
+																								return (1);
+		
+		}	// end "if (fieldHistogramFillFlag)"
 		
 				// Update the total number of pixels in the histogram;				
 				
@@ -2443,6 +2604,13 @@ SInt16 HistogramStatsControl (
 																			kOriginalStats, 
 																			kDontIncludeClusterFields);
 					
+							// Get the memory for the field histogram accumulators if
+							// they can be used.
+							
+					SetupStatFieldHistogramAccumulators (fileInfoPtr,
+																		statsWindowMode,
+																		outputGroupCode);
+					
 							// Intialize the nextTime variables to indicate when the next
 							// check should occur for a command-. and status information.
 							
@@ -2519,6 +2687,10 @@ SInt16 HistogramStatsControl (
 					
 					gStatHistogramSpecsPtr->channelMaxPtr = 
 							CheckAndDisposePtr (gStatHistogramSpecsPtr->channelMaxPtr);
+					
+					gStatHistogramSpecsPtr->fieldHistogramBufferPtr = 
+							CheckAndDisposePtr (gStatHistogramSpecsPtr->fieldHistogramBufferPtr);
+					gStatHistogramSpecsPtr->numberFieldHistogramSlots = 0;
 						
 					}	// end "if (gStatHistogramSpecsPtr != NULL)" 
 					
@@ -4297,6 +4469,14 @@ Boolean LoadStatHistogramSpecs (
 			gStatHistogramSpecsPtr->histogramDataPtr = NULL;
 			gStatHistogramSpecsPtr->featurePtr = NULL;
 			
+			gStatHistogramSpecsPtr->fieldHistogramBufferPtr = NULL;
+			gStatHistogramSpecsPtr->fieldHistogramRangePtr = NULL;
+			gStatHistogramSpecsPtr->fieldHistogramDataPtr = NULL;
+			gStatHistogramSpecsPtr->fieldHistogramCountPtr = NULL;
+			gStatHistogramSpecsPtr->fieldHistogramSlotPtr = NULL;
+			gStatHistogramSpecsPtr->numberFieldHistogramSlots = 0;
+			gStatHistogramSpecsPtr->numberFieldHistogramSlotsUsed = 0;
+			
 			gStatHistogramSpecsPtr->featureHandle = NULL;
 			gStatHistogramSpecsPtr->channelsHandle = NULL;
 			gStatHistogramSpecsPtr->classHandle = NULL;
@@ -4471,6 +4651,84 @@ Boolean LoadStatHistogramSpecs (
 
 
 
+//------------------------------------------------------------------------------------
+//                   Copyright 1988-2020 Purdue Research Foundation
+//
+//	Function name:		void MergeStatFieldHistogram
+//
+//	Software purpose:	The purpose of this routine is to add the histogram for the
+//							requested channel in the input field accumulator slot to the
+//							requested histogram column.
+//
+//	Parameters in:		Field accumulator slot
+//							Histogram column to add to
+//							Channel (feature) index
+//
+//	Parameters out:	None
+//
+// Value Returned:	None
+// 
+// Called By:			HistogramFieldStats
+//
+//	Coded By:			agent						Date: 10/18/2026
+//	Revised By:			agent						Date: 10/18/2026
+
+void MergeStatFieldHistogram (
+				SInt32								fieldSlot,
+				UInt32								indexStart,
+				UInt16								channelStart)
+
+{
+	HistogramSummaryPtr				columnRangePtr,
+											fieldRangePtr;
+	
+	HUInt32Ptr							columnDataPtr,
+											fieldDataPtr;
+	
+	UInt32								binIndex,
+											maxIndex,
+											minIndex,
+											numberBins,
+											numberFeatures,
+											numberPixels;
+	
+	
+	numberBins = gStatHistogramSpecsPtr->initialNumberHistogramDataBins;
+	numberFeatures = gStatHistogramSpecsPtr->numberFeatures;
+	numberPixels = gStatHistogramSpecsPtr->fieldHistogramCountPtr[fieldSlot];
+	
+	fieldRangePtr = &gStatHistogramSpecsPtr->fieldHistogramRangePtr[
+															fieldSlot*numberFeatures + channelStart];
+	fieldDataPtr = &gStatHistogramSpecsPtr->fieldHistogramDataPtr[
+										((UInt32)fieldSlot*numberFeatures + channelStart)*numberBins];
+	
+	columnRangePtr = &gStatHistogramSpecsPtr->histogramRangePtr[indexStart];
+	columnDataPtr = &gStatHistogramSpecsPtr->histogramDataPtr[indexStart*numberBins];
+	
+	columnRangePtr->badValues += fieldRangePtr->badValues;
+	
+	if (numberPixels > 0)
+		{
+		columnRangePtr->minValue = MIN (columnRangePtr->minValue, fieldRangePtr->minValue);
+		columnRangePtr->maxValue = MAX (columnRangePtr->maxValue, fieldRangePtr->maxValue);
+		
+				// Only the bins between the minimum and maximum values can contain
+				// data.
+				
+		minIndex = GetBinIndexForStatDataValue (fieldRangePtr->minValue, fieldRangePtr);
+		maxIndex = GetBinIndexForStatDataValue (fieldRangePtr->maxValue, fieldRangePtr);
+		
+		for (binIndex=minIndex; binIndex<=maxIndex; binIndex++)
+			columnDataPtr[binIndex] += fieldDataPtr[binIndex];
+		
+		}	// end "if (numberPixels > 0)"
+		
+	gStatHistogramSpecsPtr->totalNumberValues += numberPixels;
+			
+}	// end "MergeStatFieldHistogram" 
+
+
+
 //------------------------------------------------------------------------------------
 //                   Copyright 1988-2020 Purdue Research Foundation
 //
@@ -4671,6 +4929,143 @@ void SetStatHistogramGraphTitles (
 
 
 
+//------------------------------------------------------------------------------------
+//                   Copyright 1988-2020 Purdue Research Foundation
+//
+//	Function name:		void SetupStatFieldHistogramAccumulators
+//
+//	Software purpose:	The purpose of this routine is to get the memory for the
+//							per field histogram accumulators that are used when the
+//							histograms are listed with class/field grouping. Without them
+//							each training field is read once for every feature. No
+//							accumulators are used if there is not enough memory; the
+//							fields are then read for each feature as before.
+//
+//	Parameters in:		File information pointer
+//							Statistics window mode
+//							Output group code
+//
+//	Parameters out:	None
+//
+// Value Returned:	None
+// 
+// Called By:			HistogramStatsControl
+//
+//	Coded By:			agent						Date: 10/18/2026
+//	Revised By:			agent						Date: 10/18/2026
+
+void SetupStatFieldHistogramAccumulators (
+				FileInfoPtr							fileInfoPtr, 
+				SInt16								statsWindowMode,
+				SInt16								outputGroupCode)
+
+{
+	HistogramSummaryPtr				savedHistogramRangePtr;
+	HUInt32Ptr							savedHistogramDataPtr;
+	Ptr									bufferPtr;
+	
+	SInt64								bytesNeeded,
+											longestContBlock;
+	
+	SInt32								index,
+											numberSlots;
+	
+	UInt32								numberBins,
+											numberFeatures;
+	
+	SInt16								classStorage;
+	
+	
+	gStatHistogramSpecsPtr->fieldHistogramBufferPtr = NULL;
+	gStatHistogramSpecsPtr->numberFieldHistogramSlots = 0;
+	gStatHistogramSpecsPtr->numberFieldHistogramSlotsUsed = 0;
+	
+	numberBins = gStatHistogramSpecsPtr->initialNumberHistogramDataBins;
+	numberFeatures = gStatHistogramSpecsPtr->numberFeatures;
+	
+	if (gStatHistogramSpecsPtr->histogramOutputCode != kListData ||
+				outputGroupCode != kClassFieldGrouping ||
+						statsWindowMode == kCoordinateListMode ||
+								numberFeatures <= 1)
+																									return;
+	
+	if (statsWindowMode == kClassListMode)
+		numberSlots = gProjectInfoPtr->numberStatTrainFields;
+		
+	else	// statsWindowMode == kFieldListMode
+		{
+		classStorage = gProjectInfoPtr->storageClass[gProjectInfoPtr->currentClass];
+		numberSlots = 
+					gProjectInfoPtr->classNamesPtr[classStorage].numberOfTrainFields;
+		
+		}	// end "else statsWindowMode == kFieldListMode"
+		
+	if (numberSlots <= 0)
+																									return;
+	
+			// Get the number of bytes needed for the histogram summaries (one extra
+			// set is used to store the bin layout for each feature), the histogram
+			// data, the pixel counts and the field to slot table.
+			
+	bytesNeeded = (SInt64)(numberSlots+1) * numberFeatures * sizeof (HistogramSummary) +
+						(SInt64)numberSlots * numberFeatures * numberBins * sizeof (UInt32) +
+							(SInt64)numberSlots * sizeof (UInt32) +
+								(SInt64)gProjectInfoPtr->numberStorageFields * sizeof (SInt32);
+	
+	MGetFreeMemory (&longestContBlock);
+	
+	if (bytesNeeded+40000 > longestContBlock || bytesNeeded > SInt32_MAX)
+																									return;
+	
+	bufferPtr = MNewPointer (bytesNeeded);
+	if (bufferPtr == NULL)
+																									return;
+	
+	gStatHistogramSpecsPtr->fieldHistogramBufferPtr = bufferPtr;
+	
+	gStatHistogramSpecsPtr->fieldHistogramRangePtr = (HistogramSummaryPtr)bufferPtr;
+	bufferPtr += (numberSlots+1) * numberFeatures * sizeof (HistogramSummary);
+	
+	gStatHistogramSpecsPtr->fieldHistogramDataPtr = (HUInt32Ptr)bufferPtr;
+	bufferPtr += numberSlots * numberFeatures * numberBins * sizeof (UInt32);
+	
+	gStatHistogramSpecsPtr->fieldHistogramCountPtr = (UInt32*)bufferPtr;
+	bufferPtr += numberSlots * sizeof (UInt32);
+	
+	gStatHistogramSpecsPtr->fieldHistogramSlotPtr = (SInt32*)bufferPtr;
+	
+	for (index=0; index<gProjectInfoPtr->numberStorageFields; index++)
+		gStatHistogramSpecsPtr->fieldHistogramSlotPtr[index] = -1;
+		
+	gStatHistogramSpecsPtr->numberFieldHistogramSlots = numberSlots;
+	
+			// Load the bin layout for each feature into the extra set of histogram
+			// summaries. Feature k uses the same layout as the class/field grouping
+			// columns for channel set k.
+			
+	savedHistogramRangePtr = gStatHistogramSpecsPtr->histogramRangePtr;
+	savedHistogramDataPtr = gStatHistogramSpecsPtr->histogramDataPtr;
+	
+	gStatHistogramSpecsPtr->histogramRangePtr = 
+			&gStatHistogramSpecsPtr->fieldHistogramRangePtr[numberSlots*numberFeatures];
+	gStatHistogramSpecsPtr->histogramDataPtr = 
+													gStatHistogramSpecsPtr->fieldHistogramDataPtr;
+	
+	InitializeStatHistogramBuffers (fileInfoPtr,
+												kChannelGrouping,
+												numberFeatures,
+												gStatHistogramSpecsPtr->featurePtr,
+												0,
+												gStatHistogramSpecsPtr->channelMinPtr, 
+												gStatHistogramSpecsPtr->channelMaxPtr);
+	
+	gStatHistogramSpecsPtr->histogramRangePtr = savedHistogramRangePtr;
+	gStatHistogramSpecsPtr->histogramDataPtr = savedHistogramDataPtr;
+			
+}	// end "SetupStatFieldHistogramAccumulators" 
+
+
+
 //------------------------------------------------------------------------------------
 //                   Copyright 1988-2020 Purdue Research Foundation
 //
@@ -18,7 +18,7 @@
 //
 //	Authors:					Larry L. Biehl
 //
-//	Revision date:			11/25/2019
+//	Revision date:			10/18/2026
 //
 //	Language:				C
 //
@@ -44,6 +44,16 @@
 
 
 
+SInt64 GetClassDataValuesFromPixelData (
+				SInt16								classNumber,
+				UInt16*								channelsPtr,
+				SInt16								numberChannels,
+				HDoublePtr							doubleDataValuePtr,
+				HDoublePtr							transformMatrixPtr,
+				HDoublePtr							transformFeatureMeansPtr,
+				UInt16								numberFeatures,
+				SInt16								optionsCode);
+
 double FindMaxDiagonalValueInSquareMatrix (
 				HDoublePtr 							squareMatrixPtr, 
 				UInt32								matrixSize);
@@ -233,7 +243,7 @@ UInt32 FindMinValueInVector (
 //							UpdateClassLOOStats in SLOOCovariance.cpp
 //
 //	Coded By:			Larry L. Biehl			Date: 10/29/1992
-//	Revised By:			Larry L. Biehl			Date: 08/26/2010	
+//	Revised By:			agent						Date: 10/18/2026
 
 SInt64 GetClassDataValues (
 				FileIOInstructionsPtr			fileIOInstructionsPtr, 
@@ -270,6 +280,27 @@ SInt64 GetClassDataValues (
 			
 	gNextTime = TickCount ();
 	
+			// Use the training pixel matrix if it has already been loaded for the
+			// project. This saves reading the training fields again.
+	
+	if (gProjectInfoPtr->pixelDataLoadedFlag)
+		{
+		totalNumberPixels = GetClassDataValuesFromPixelData (classNumber,
+																				channelsPtr,
+																				numberChannels,
+																				doubleDataValuePtr,
+																				transformMatrixPtr,
+																				transformFeatureMeansPtr,
+																				numberFeatures,
+																				optionsCode);
+		
+		if (totalNumberPixels >= 0)
+																	return (totalNumberPixels);
+		
+		totalNumberPixels = 0;
+		
+		}	// end "if (gProjectInfoPtr->pixelDataLoadedFlag)"
+	
 			// Get the class storage number.													
 						
 	classStorage = gProjectInfoPtr->storageClass[classNumber];
@@ -374,6 +405,215 @@ SInt64 GetClassDataValues (
 
 
 
+//------------------------------------------------------------------------------------
+//                   Copyright 1988-2020 Purdue Research Foundation
+//
+//	Function name:		SInt64 GetClassDataValuesFromPixelData
+//
+//	Software purpose:	The purpose of this routine is to load the input floating point
+//							vector with the data values for the specified class from the
+//							project training pixel matrix that was loaded for the k nearest
+//							neighbor and support vector machine classifiers. This saves
+//							reading the training fields from the image file again.
+//							The matrix contains all of the project statistics channels for
+//							each training pixel along with the class number for the pixel.
+//
+//	Parameters in:		Same as for GetClassDataValues
+//
+//	Parameters out:	None
+//
+// Value Returned:	Number of pixels loaded for the class.
+//							-1 if the pixel matrix cannot be used for this request.
+//
+// Called By:			GetClassDataValues
+//
+//	Coded By:			agent						Date: 10/18/2026
+//	Revised By:			agent						Date: 10/18/2026
+
+SInt64 GetClassDataValuesFromPixelData (
+				SInt16								classNumber,
+				UInt16*								channelsPtr,
+				SInt16								numberChannels,
+				HDoublePtr							doubleDataValuePtr,
+				HDoublePtr							transformMatrixPtr,
+				HDoublePtr							transformFeatureMeansPtr,
+				UInt16								numberFeatures,
+				SInt16								optionsCode)
+
+{
+	HDoublePtr							pixelValuesPtr,
+											sampleValuesPtr;
+
+	SInt16*								channelIndexPtr;
+
+	HPFieldIdentifiersPtr			fieldIdentPtr;
+
+	SInt64								classSampleCount,
+											numberPixels,
+											sample,
+											sampleInterval;
+
+	UInt32								numberStatisticsChannels;
+
+	SInt16								channel,
+											classStorage,
+											fieldNumber,
+											index;
+
+	UInt16								classLabel;
+
+	Boolean								transformDataFlag;
+
+
+	if (!gProjectInfoPtr->pixelDataLoadedFlag ||
+			gProjectInfoPtr->knnDataValuesPtr == NULL ||
+				gProjectInfoPtr->knnLabelsPtr == NULL ||
+					gProjectInfoPtr->knnCounter <= 0 ||
+						(optionsCode & kNoTrainingSamples))
+																						return (-1);
+
+			// Cluster type fields are not used for the class data values. Use the
+			// image file if the class contains one of these fields.
+
+	fieldIdentPtr = gProjectInfoPtr->fieldIdentPtr;
+	classStorage = gProjectInfoPtr->storageClass[classNumber];
+	fieldNumber = gProjectInfoPtr->classNamesPtr[classStorage].firstFieldNumber;
+	while (fieldNumber != -1)
+		{
+		if (fieldIdentPtr[fieldNumber].fieldType == kTrainingType &&
+							fieldIdentPtr[fieldNumber].pointType == kClusterType)
+																						return (-1);
+
+		fieldNumber = fieldIdentPtr[fieldNumber].nextField;
+
+		}	// end "while (fieldNumber != -1)"
+
+	numberStatisticsChannels = gProjectInfoPtr->numberStatisticsChannels;
+
+			// Get the location of each of the requested channels in the pixel
+			// matrix. The matrix cannot be used if one of the channels is not a
+			// project statistics channel.
+
+	channelIndexPtr = (SInt16*)MNewPointer (numberChannels * sizeof (SInt16));
+	if (channelIndexPtr == NULL)
+																						return (-1);
+
+	for (channel=0; channel<numberChannels; channel++)
+		{
+		channelIndexPtr[channel] = -1;
+		for (index=0; index<(SInt16)numberStatisticsChannels; index++)
+			{
+			if (gProjectInfoPtr->channelsPtr[index] == (SInt16)channelsPtr[channel])
+				{
+				channelIndexPtr[channel] = index;
+				break;
+
+				}	// end "if (gProjectInfoPtr->channelsPtr[index] == ..."
+
+			}	// end "for (index=0; index<numberStatisticsChannels; index++)"
+
+		if (channelIndexPtr[channel] < 0)
+			{
+			CheckAndDisposePtr ((Ptr)channelIndexPtr);
+																						return (-1);
+
+			}	// end "if (channelIndexPtr[channel] < 0)"
+
+		}	// end "for (channel=0; channel<numberChannels; channel++)"
+
+	transformDataFlag = (transformMatrixPtr != NULL && numberFeatures > 0);
+
+	sampleValuesPtr = NULL;
+	if (transformDataFlag)
+		{
+		sampleValuesPtr = (HDoublePtr)MNewPointer (numberChannels * sizeof (double));
+		if (sampleValuesPtr == NULL)
+			{
+			CheckAndDisposePtr ((Ptr)channelIndexPtr);
+																						return (-1);
+
+			}	// end "if (sampleValuesPtr == NULL)"
+
+		}	// end "if (transformDataFlag)"
+
+			// Count the pixels in the class to determine the interval to use.
+			// Labels in the pixel matrix are the 1-based class numbers.
+
+	classLabel = (UInt16)(classNumber + 1);
+	classSampleCount = 0;
+	for (sample=0; sample<gProjectInfoPtr->knnCounter; sample++)
+		{
+		if (gProjectInfoPtr->knnLabelsPtr[sample] == classLabel)
+			classSampleCount++;
+
+		}	// end "for (sample=0; sample<gProjectInfoPtr->knnCounter; sample++)"
+
+	sampleInterval = 1;
+	if (gFeatureExtractionSpecsPtr != NULL && (optionsCode & kComputeColumnInterval))
+		{
+		sampleInterval = (SInt64)((double)classSampleCount/
+							gFeatureExtractionSpecsPtr->maximumPixelsPerClass + 0.5);
+		sampleInterval = MAX (sampleInterval, 1);
+
+		}	// end "if (gFeatureExtractionSpecsPtr != NULL && ..."
+
+	numberPixels = 0;
+	classSampleCount = 0;
+	pixelValuesPtr = gProjectInfoPtr->knnDataValuesPtr;
+	for (sample=0; sample<gProjectInfoPtr->knnCounter; sample++)
+		{
+		if (gProjectInfoPtr->knnLabelsPtr[sample] == classLabel)
+			{
+			if (classSampleCount % sampleInterval == 0)
+				{
+				if (transformDataFlag)
+					{
+					for (channel=0; channel<numberChannels; channel++)
+						sampleValuesPtr[channel] =
+												pixelValuesPtr[channelIndexPtr[channel]];
+
+					TransformDataVector (sampleValuesPtr,
+												transformMatrixPtr,
+												transformFeatureMeansPtr,
+												doubleDataValuePtr,
+												numberChannels,
+												numberFeatures);
+
+					doubleDataValuePtr += numberFeatures;
+
+					}	// end "if (transformDataFlag)"
+
+				else	// !transformDataFlag
+					{
+					for (channel=0; channel<numberChannels; channel++)
+						doubleDataValuePtr[channel] =
+												pixelValuesPtr[channelIndexPtr[channel]];
+
+					doubleDataValuePtr += numberChannels;
+
+					}	// end "else !transformDataFlag"
+
+				numberPixels++;
+
+				}	// end "if (classSampleCount % sampleInterval == 0)"
+
+			classSampleCount++;
+
+			}	// end "if (gProjectInfoPtr->knnLabelsPtr[sample] == classLabel)"
+
+		pixelValuesPtr += numberStatisticsChannels;
+
+		}	// end "for (sample=0; sample<gProjectInfoPtr->knnCounter; sample++)"
+
+	CheckAndDisposePtr ((Ptr)channelIndexPtr);
+	CheckAndDisposePtr ((Ptr)sampleValuesPtr);
+
+	return (numberPixels);
+
+}	// end "GetClassDataValuesFromPixelData"
+
+
+
 //------------------------------------------------------------------------------------
 //                   Copyright 1988-2020 Purdue Research Foundation
 //
@@ -2496,7 +2496,9 @@ extern void ClassifyDialogOK (
 				SInt16								listResultsTestCode,
 				SInt16								listResultsTrainingCode,
 				SInt16								parallelPipedCode,
-				SInt16								nearestNeighborKValue); 
+				SInt16								nearestNeighborKValue,
+				Boolean								batchTargetsFlag,
+				Boolean								float32ComputeFlag); 
 	                
 extern SInt16 ClassifyDialogOnClassificationProcedure (
 				DialogPtr							dialogPtr, 
@@ -2527,6 +2529,10 @@ extern SInt16 ClassifyDialogOnTargetFile (
 				DialogSelectArea*					dialogSelectAreaPtr,
 				Boolean*								createImageOverlayFlagPtr);
 								
+extern void ClassifyDialogSetFloat32ComputeItem (
+				DialogPtr							dialogPtr,
+				SInt16								classificationProcedure);
+								
 extern Boolean ClassifyDialogSetLeaveOneOutItems (
 				DialogPtr							dialogPtr,
 				SInt16								classificationProcedure,
@@ -2672,6 +2678,8 @@ extern SInt16 DeleteSpecifiedClusters (
 
 extern Boolean CreateClusterMaskFile (void);
 
+extern SInt16 GetClusterPassStatisticsCode (void);
+
 extern Boolean GetNextClusterArea (
 				ProjectInfoPtr						projectClassInfoPtr,
 				UInt16*								channelsPtr,
@@ -4771,6 +4779,9 @@ extern void SetType (
 				CMFileStream*						fileStreamPtr,
 				SInt32								type);
 
+extern void SetUpChannelLineBlocks (
+				FileIOInstructionsPtr			fileIOInstructionsPtr);
+
 extern SInt16 SetUpFileIOInstructions (
 				FileIOInstructionsPtr			fileIOInstructionsPtr,
 				AreaDescription*					areaDescriptionPtr,
@@ -4807,6 +4818,9 @@ extern void SetUpGeneralFileIOInstructions (
 				UInt16								forceByteCode,
 				FileIOInstructionsPtr*			outputFileIOInstructionsPtrPtr);
 
+extern void SetUpSequentialReadBuffer (
+				FileIOInstructionsPtr			fileIOInstructionsPtr);
+
 extern SInt16 SetVolume (
 				CMFileStream*						fileStreamPtr,
 				SInt16								messageCode);
@@ -6453,6 +6467,14 @@ extern Boolean DetermineIfMaskDataInLine (
 				UInt32								columnInterval,
 				UInt32								maskValueRequest);
 
+extern Boolean DetermineIfMaskRunsInLine (
+				MaskRunPtr							maskRunPtr,
+				UInt32								numberMaskRuns,
+				UInt32								maskColumnStart,
+				UInt32								numberSamples,
+				UInt32								columnInterval,
+				UInt32								maskValueRequest);
+
 extern UInt32 GetFirstMaskLine (
 				MaskInfoPtr							maskInfoPtr,
 				UInt16								maskValueRequest,
@@ -7489,6 +7511,9 @@ extern SInt16 LinkFiles (
 				SInt16								fileFormat,
 				Handle								windowInfoHandle);
 
+extern SInt16 LinkMultiSpecStackFiles (
+				Handle								windowInfoHandle);
+
 extern void LoadClassNameDescriptions (
 				Handle								windowInfoHandle);
 
@@ -7595,6 +7620,8 @@ extern void GetPolygonLabelPoint (
 				HPFieldPointsPtr					fieldPointsPtr,
 				LongPoint*							labelPointPtr);
 
+extern void InvalidateFieldOutlineCache (void);
+
 extern void OutlineFieldsControl (
 				SInt16								statsWindowMode,
 				WindowPtr							windowPtr,
@@ -7608,6 +7635,9 @@ extern void OutlineFieldsInProjectWindows (
 				SInt16								statsWindowMode,
 				Boolean								clearFieldAreaFlag);
 
+extern void ReleaseFieldOutlineCacheMemory (
+				WindowInfoPtr						windowInfoPtr);
+
 		// end SOutlineFields.cpp
 
 
@@ -9314,6 +9344,9 @@ extern SInt16 TransformCoordinatePoint (
 
 		// Routines in SSaveWrite.cpp	
 
+extern void DeleteENVIHeaderFile (
+				FileInfoPtr							fileInfoPtr);
+
 extern SInt16 FindEndOfLineCode (
 				ParmBlkPtr							paramBlockPtr,
 				CMFileStream*						fileStreamPtr,
@@ -9337,6 +9370,9 @@ extern UCharPtr SkipToNextCarriageReturn	(
 extern Boolean WriteArcViewSupportFiles (
 				FileInfoPtr							fileInfoPtr);
 
+extern Boolean WriteENVIHeaderFile (
+				FileInfoPtr							fileInfoPtr);
+
 extern Boolean WriteErdasHeader (
 				FileInfoPtr							fileInfoPtr, 
 				UInt8*								headerRecordPtr, 
@@ -9832,6 +9868,8 @@ extern void GetUniqueFieldName (
 				UCharPtr								outputStringPtr,
 				SInt16								prefixLength);
 
+extern void InvalidateProjectNameIndexes (void);
+
 extern void InvalPopUpCovarianceToUse (void);
 
 extern void LoadClassNamesIntoList (
@@ -10850,6 +10888,12 @@ extern Boolean CreateResultsDiskFiles (
 				SInt16								numberClasses,
 				SInt16								numberProbabilityClasses);
 
+extern Boolean CreateResultsDiskFiles (
+				SInt16								lOutputStorageType,
+				SInt16								numberClasses,
+				SInt16								numberProbabilityClasses,
+				Boolean								promptFlag);
+
 extern double DetermineHistogramBinWidth (
 				double								inMinValue,
 				double								inMaxValue,
@@ -18,7 +18,7 @@
 //
 //	Authors:					Larry L. Biehl
 //
-//	Revision date:			04/16/2020
+//	Revision date:			10/18/2026
 //
 //	Language:				C
 //
@@ -93,6 +93,20 @@ void RecodeThematicImageDialogSetThresholdItems (
 				SInt16								thresholdImageSelection,
 				Handle								thresholdFileInfoHandle);	
 
+UInt32 RecodeThematicLine (
+				HUInt16Ptr							ioBuffer2Ptr,
+				HUInt16Ptr							thresholdBuffer2Ptr,
+				UInt32								numberColumns,
+				SInt16								compareParameterCode,
+				UInt16								thresholdValue,
+				UInt16								newRecodedValue);
+
+SInt16 WriteRecodedLines (
+				CMFileStream*						outFileStreamPtr,
+				HUCharPtr							bufferPtr,
+				UInt32								writePosOff,
+				UInt32								count);
+
 
 
 //------------------------------------------------------------------------------------
@@ -124,25 +138,31 @@ Boolean DoRecodeThematicImage (
 {
 	CMFileStream*						outFileStreamPtr;
 	
+	HUCharPtr							blockBufferPtr;
+	
 	HUInt16Ptr							ioBuffer2Ptr,
 				 							thresholdBuffer2Ptr;
 	
 	SInt32								startTick;
 											
-	UInt32								columnEnd,
+	UInt32								blockCount,
+											blockPosOff,
+											columnEnd,
 											columnStart,
 											count,
 											lastPercentComplete,
 											line,
 											lineCount,
 											lineEnd,
+											lineValuesChanged,
 											//linesLeft,
 											lineStart,
+											maxBlockCount,
+											numberBlockLines,
 											numberColumns,
 											numberLines,
 											numberSamples,
 											percentComplete,
-											previousValuesChanged,
 											sample,
 											tempCount,
 											thresholdColumnEnd,
@@ -240,6 +260,22 @@ Boolean DoRecodeThematicImage (
 	thresholdBuffer2Ptr = (HUInt16Ptr)gOutputBuffer2Ptr;
 	if (!differentThresholdFileFlag)	
 		thresholdBuffer2Ptr = (HUInt16Ptr)ioBuffer2Ptr;	
+	
+			// Get a buffer to collect recoded lines that are next to each other in
+			// the file so that they can be written with one write. Limit the buffer
+			// to about 1 megabyte. The lines are written one at a time if the
+			// memory is not available.
+			
+	numberBlockLines = MAX (1, 1048576 / MAX (count, 1));
+	numberBlockLines = MIN (numberBlockLines, numberLines);
+	maxBlockCount = numberBlockLines * count;
+	
+	blockBufferPtr = NULL;
+	if (numberBlockLines > 1)
+		blockBufferPtr = (HUCharPtr)MNewPointer (maxBlockCount);
+		
+	blockCount = 0;
+	blockPosOff = 0;
 																					  
 			// Load total number of lines in status information.						
 			
@@ -294,8 +330,6 @@ Boolean DoRecodeThematicImage (
 	thresholdLine = thresholdLineStart;
 	for (line=lineStart; line<=lineEnd; line++)
 		{
-		previousValuesChanged = valuesChanged;
-	
 				// Display line status information.											
 				
 		lineCount++;
@@ -343,79 +377,17 @@ Boolean DoRecodeThematicImage (
 				
 			}	// end "if (differentThresholdFileFlag)"
 			
-		switch (recodeThematicImagePtr->compareParameterCode)
-			{
-			case 1:		// <=
-				for (sample=0; sample<numberColumns; sample++)
-					{
-					if (thresholdBuffer2Ptr[sample] <= thresholdValue)
-						{
-						if (ioBuffer2Ptr[sample] != newRecodedValue)
-							{
-							ioBuffer2Ptr[sample] = newRecodedValue;
-							valuesChanged++;
-							
-							}	// end "if (ioBuffer2Ptr[sample] != newRecodedValue)"
-						
-						}	// end "if (thresholdBuffer2Ptr[sample] <= thresholdValue)" 
-		   			
-		   		}	// end "for (sample=0; sample<numberColumns; sample++)"
-				break;
-				
-			case 2:		// >=
-				for (sample=0; sample<numberColumns; sample++)
-					{
-					if (thresholdBuffer2Ptr[sample] >= thresholdValue)
-						{
-						if (ioBuffer2Ptr[sample] != newRecodedValue)
-							{
-							ioBuffer2Ptr[sample] = newRecodedValue;
-							valuesChanged++;
-							
-							}	// end "if (ioBuffer2Ptr[sample] != newRecodedValue)"
-						
-						}	// end "if (thresholdBuffer2Ptr[sample] >= thresholdValue)" 
-		   			
-		   		}	// end "for (sample=0; sample<numberColumns; sample++)"
-				break;
-				
-			case 3:		// =
-				for (sample=0; sample<numberColumns; sample++)
-					{
-					if (thresholdBuffer2Ptr[sample] == thresholdValue)
-						{
-						if (ioBuffer2Ptr[sample] != newRecodedValue)
-							{
-							ioBuffer2Ptr[sample] = newRecodedValue;
-							valuesChanged++;
-							
-							}	// end "if (ioBuffer2Ptr[sample] != newRecodedValue)"
-						
-						}	// end "if (thresholdBuffer2Ptr[sample] = thresholdValue)" 
-		   			
-		   		}	// end "for (sample=0; sample<numberColumns; sample++)"
-				break;
-				
-			case 4:		// ~=
-				for (sample=0; sample<numberColumns; sample++)
-					{
-					if (thresholdBuffer2Ptr[sample] != thresholdValue)
-						{
-						if (ioBuffer2Ptr[sample] != newRecodedValue)
-							{
-							ioBuffer2Ptr[sample] = newRecodedValue;
-							valuesChanged++;
-							
-							}	// end "if (ioBuffer2Ptr[sample] != newRecodedValue)"
-						
-						}	// end "if (thresholdBuffer2Ptr[sample] != thresholdValue)" 
-		   			
-		   		}	// end "for (sample=0; sample<numberColumns; sample++)"
-				break;
-			
-			}	// end "switch (recodeThematicImagePtr->compareParameterCode)"
+		lineValuesChanged = RecodeThematicLine (
+												ioBuffer2Ptr,
+												thresholdBuffer2Ptr,
+												numberColumns,
+												recodeThematicImagePtr->compareParameterCode,
+												thresholdValue,
+												newRecodedValue);
+		
+		valuesChanged += lineValuesChanged;
 			
-		if (valuesChanged != previousValuesChanged)
+		if (lineValuesChanged > 0)
 			{			
 					// Write revised data back out to file.
 					
@@ -432,7 +404,7 @@ Boolean DoRecodeThematicImage (
 																gImageFileInfoPtr->swapBytesFlag)
 				Swap2Bytes (ioBuffer2Ptr, numberColumns);
 			
-					// Next set pointer to correct location for writing.	
+					// Next get the location for writing.	
 						
 			writePosOff = (UInt32)GetFilePositionOffset (fileIOInstructions1Ptr,
 																		gImageFileInfoPtr,
@@ -442,18 +414,37 @@ Boolean DoRecodeThematicImage (
 																		columnEnd,
 																		&numberSamples,
 																		&tempCount,
-																		&endHalfByte);		
+																		&endHalfByte);
+			
+			if (blockBufferPtr != NULL)
+				{
+						// Write the lines collected so far if this line does not
+						// follow them in the file or the buffer is full.
+						
+				if (blockCount > 0 && (writePosOff != blockPosOff + blockCount || 
+														blockCount + count > maxBlockCount))
+					{
+					errCode = WriteRecodedLines (outFileStreamPtr, 
+															blockBufferPtr, 
+															blockPosOff, 
+															blockCount);
+					blockCount = 0;
+					
+					}	// end "if (blockCount > 0 && ..."
+					
+				if (blockCount == 0)
+					blockPosOff = writePosOff;
+					
+				BlockMoveData (gOutputBufferPtr, &blockBufferPtr[blockCount], count);
+				blockCount += count;
+				
+				}	// end "if (blockBufferPtr != NULL)"
 				
-			errCode = MSetMarker (outFileStreamPtr, 
-												fsFromStart, 
-												writePosOff,
-												kErrorMessages);
-			
-			if (errCode == noErr)
-				errCode = MWriteData (outFileStreamPtr, 
-												&count, 
-												gOutputBufferPtr, 
-												kErrorMessages);
+			else	// blockBufferPtr == NULL
+				errCode = WriteRecodedLines (outFileStreamPtr, 
+														gOutputBufferPtr, 
+														writePosOff, 
+														count);
 											
 			if (errCode != noErr)
 				{
@@ -462,7 +453,7 @@ Boolean DoRecodeThematicImage (
 				
 				}	// end "if (errCode != noErr)"
 				
-			}	// end "if (valuesChanged != previousValuesChanged)"
+			}	// end "if (lineValuesChanged > 0)"
 		
 				// Update dialog status information.		
 	
@@ -507,6 +498,22 @@ Boolean DoRecodeThematicImage (
 		thresholdLine++;
 										
 		}	// end "for (line=1; line<=lineEnd; line++)" 
+		
+			// Write any recoded lines that are left in the block buffer.
+			
+	if (blockCount > 0 && returnCode != 2)
+		{
+		errCode = WriteRecodedLines (outFileStreamPtr, 
+												blockBufferPtr, 
+												blockPosOff, 
+												blockCount);
+		
+		if (errCode != noErr)
+			returnCode = 2;
+			
+		}	// end "if (blockCount > 0 && returnCode != 2)"
+		
+	CheckAndDisposePtr ((Ptr)blockBufferPtr);
 	
 	//if (returnCode == 0)
 	//	LoadDItemValue (gStatusDialogPtr, IDC_Status18, lineCount);
@@ -1691,3 +1698,137 @@ void RecodeThematicImageDialogSetThresholdItems (
 	
 }	// end "RecodeThematicImageDialogSetThresholdItems"  
 
+
+
+//------------------------------------------------------------------------------------
+//                   Copyright 1988-2020 Purdue Research Foundation
+//
+//	Function name:		UInt32 RecodeThematicLine
+//
+//	Software purpose:	The purpose of this routine is to recode the values in the
+//							input line of thematic data for which the threshold line
+//							values meet the compare condition. The loops do not branch
+//							on each sample so that the compiler can vectorize them.
+//
+//	Parameters in:		Line of thematic data and threshold data as 2-byte values.
+//
+//	Parameters out:	Recoded line of thematic data.
+//
+// Value Returned:	Number of values that were changed.
+// 
+// Called By:			DoRecodeThematicImage in SRecodeThematicImage.cpp
+//
+//	Coded By:			agent						Date: 10/18/2026
+//	Revised By:			agent						Date: 10/18/2026
+
+UInt32 RecodeThematicLine (
+				HUInt16Ptr							ioBuffer2Ptr,
+				HUInt16Ptr							thresholdBuffer2Ptr,
+				UInt32								numberColumns,
+				SInt16								compareParameterCode,
+				UInt16								thresholdValue,
+				UInt16								newRecodedValue)
+
+{
+	UInt32								recodeFlag,
+											sample,
+											valuesChanged;
+	
+	
+	valuesChanged = 0;
+	
+	switch (compareParameterCode)
+		{
+		case 1:		// <=
+			for (sample=0; sample<numberColumns; sample++)
+				{
+				recodeFlag = (thresholdBuffer2Ptr[sample] <= thresholdValue);
+				valuesChanged += recodeFlag & (ioBuffer2Ptr[sample] != newRecodedValue);
+				ioBuffer2Ptr[sample] = (recodeFlag) ? newRecodedValue : ioBuffer2Ptr[sample];
+				
+				}	// end "for (sample=0; sample<numberColumns; sample++)"
+			break;
+			
+		case 2:		// >=
+			for (sample=0; sample<numberColumns; sample++)
+				{
+				recodeFlag = (thresholdBuffer2Ptr[sample] >= thresholdValue);
+				valuesChanged += recodeFlag & (ioBuffer2Ptr[sample] != newRecodedValue);
+				ioBuffer2Ptr[sample] = (recodeFlag) ? newRecodedValue : ioBuffer2Ptr[sample];
+				
+				}	// end "for (sample=0; sample<numberColumns; sample++)"
+			break;
+			
+		case 3:		// =
+			for (sample=0; sample<numberColumns; sample++)
+				{
+				recodeFlag = (thresholdBuffer2Ptr[sample] == thresholdValue);
+				valuesChanged += recodeFlag & (ioBuffer2Ptr[sample] != newRecodedValue);
+				ioBuffer2Ptr[sample] = (recodeFlag) ? newRecodedValue : ioBuffer2Ptr[sample];
+				
+				}	// end "for (sample=0; sample<numberColumns; sample++)"
+			break;
+			
+		case 4:		// ~=
+			for (sample=0; sample<numberColumns; sample++)
+				{
+				recodeFlag = (thresholdBuffer2Ptr[sample] != thresholdValue);
+				valuesChanged += recodeFlag & (ioBuffer2Ptr[sample] != newRecodedValue);
+				ioBuffer2Ptr[sample] = (recodeFlag) ? newRecodedValue : ioBuffer2Ptr[sample];
+				
+				}	// end "for (sample=0; sample<numberColumns; sample++)"
+			break;
+			
+		}	// end "switch (compareParameterCode)"
+		
+	return (valuesChanged);
+	
+}	// end "RecodeThematicLine"
+
+
+
+//------------------------------------------------------------------------------------
+//                   Copyright 1988-2020 Purdue Research Foundation
+//
+//	Function name:		SInt16 WriteRecodedLines
+//
+//	Software purpose:	The purpose of this routine is to write the input buffer of
+//							recoded thematic data to the specified location in the
+//							output file.
+//
+//	Parameters in:		File stream, buffer, file position and number of bytes.
+//
+//	Parameters out:	None
+//
+// Value Returned:	Error code for file operations.
+// 
+// Called By:			DoRecodeThematicImage in SRecodeThematicImage.cpp
+//
+//	Coded By:			agent						Date: 10/18/2026
+//	Revised By:			agent						Date: 10/18/2026
+
+SInt16 WriteRecodedLines (
+				CMFileStream*						outFileStreamPtr,
+				HUCharPtr							bufferPtr,
+				UInt32								writePosOff,
+				UInt32								count)
+
+{
+	SInt16								errCode;
+	
+	
+	errCode = MSetMarker (outFileStreamPtr, 
+									fsFromStart, 
+									writePosOff,
+									kErrorMessages);
+	
+	if (errCode == noErr)
+		errCode = MWriteData (outFileStreamPtr, 
+										&count, 
+										bufferPtr, 
+										kErrorMessages);
+										
+	return (errCode);
+	
+}	// end "WriteRecodedLines"
+
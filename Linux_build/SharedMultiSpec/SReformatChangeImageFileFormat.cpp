@@ -1808,6 +1808,18 @@ void ChangeImageFileFormat ()
 														kDoNotAllowForThreadedIO,
 														&fileIOInstructionsPtr);
 			
+					// Read the input file in large sequential pieces when a new 
+					// file is being written. The input file may be changed in place
+					// for the other output file options.
+			
+			if (continueFlag && 
+						reformatOptionsPtr->outputFileCode == kNewFileMenuItem)
+				{
+				SetUpSequentialReadBuffer (fileIOInstructionsPtr);
+				SetUpChannelLineBlocks (fileIOInstructionsPtr);
+				
+				}	// end "if (continueFlag && ..."
+			
 					// If the request is to adjust the selected channels by a selected
 					// channel check if separate read of the file will be required. This
 					// occurs if the the selected channel to adjust the channels by is not
@@ -18,7 +18,7 @@
 //
 //	Authors:					Larry L. Biehl
 //
-//	Revision date:			08/29/2020
+//	Revision date:			10/18/2026
 //
 //	Language:				C
 //
@@ -892,7 +892,10 @@ void AppendFileDialogOK (
 //
 //	Software purpose:	The purpose of this routine is to obtain the 
 //							new header information and reformat that information
-//							to ERDAS format and rewrite the header file.
+//							to ERDAS format and rewrite the header file. For image
+//							files without a header, the information is written to an
+//							ENVI header file next to the image file instead so that
+//							the image data is not moved.
 //
 //	Parameters in:		None
 //
@@ -903,7 +906,7 @@ void AppendFileDialogOK (
 // Called By:			SReformatControl in SReformatChangeImageFileFormat.cpp
 //
 //	Coded By:			Larry L. Biehl			Date: 08/28/1988
-//	Revised By:			Larry L. Biehl			Date: 11/20/1991
+//	Revised By:			agent						Date: 10/18/2026
 
 void ChangeErdasHeader (void)
 
@@ -918,6 +921,8 @@ void ChangeErdasHeader (void)
 	
 	SInt16								errCode,
 											requestedFormat;
+	
+	Boolean								enviHeaderFileFlag;
 	                                                  
 	
 	if (ChangeErdasHeaderDialog (gImageFileInfoPtr, &requestedFormat))
@@ -928,17 +933,57 @@ void ChangeErdasHeader (void)
 				// processFlag == 1:  Do Write New Erdas Header Request				
 				// processFlag == 2:  Do Change Erdas Header Request					
 		
-		if (gImageFileInfoPtr->format == 0)
+		if (gImageFileInfoPtr->format == 0 ||
+										gImageFileInfoPtr->multiSpecHeaderFileFlag)
 			{
 			MSetCursor (kWait);
-			if (InsertNewErdasHeader (gImageFileInfoPtr, requestedFormat))
-				gImageFileInfoPtr->format = requestedFormat;
+			
+					// An ENVI header file cannot describe 4-bit data or bytes before
+					// or after each line or channel. The header is inserted at the
+					// front of the image file as before for these cases.
+					
+			enviHeaderFileFlag = (gImageFileInfoPtr->numberBits != 4 &&
+											gImageFileInfoPtr->numberPreLineBytes == 0 &&
+											gImageFileInfoPtr->numberPostLineBytes == 0 &&
+											gImageFileInfoPtr->numberPreChannelBytes == 0 &&
+											gImageFileInfoPtr->numberPostChannelBytes == 0);
+			
+					// Write the header information to a header file next to the image
+					// file so that the image data does not need to be moved. The
+					// header is only inserted at the front of the image file if the
+					// header file cannot describe the image or cannot be written.
+					
+			if (enviHeaderFileFlag && WriteENVIHeaderFile (gImageFileInfoPtr))
+				{
+				gImageFileInfoPtr->format = kENVIType;
+				gImageFileInfoPtr->multiSpecHeaderFileFlag = TRUE;
+				
+				}	// end "if (enviHeaderFileFlag && WriteENVIHeaderFile (..."
+				
+			else if (gImageFileInfoPtr->format == 0 ||
+								(!enviHeaderFileFlag &&
+											gImageFileInfoPtr->numberHeaderBytes == 0))
+				{
+						// Remove any header file written earlier so that it does not
+						// take precedence over the inserted header.
+						
+				if (gImageFileInfoPtr->multiSpecHeaderFileFlag)
+					{
+					DeleteENVIHeaderFile (gImageFileInfoPtr);
+					gImageFileInfoPtr->multiSpecHeaderFileFlag = FALSE;
+					
+					}	// end "if (gImageFileInfoPtr->multiSpecHeaderFileFlag)"
+				
+				if (InsertNewErdasHeader (gImageFileInfoPtr, requestedFormat))
+					gImageFileInfoPtr->format = requestedFormat;
+					
+				SetFileReadOnly (fileStreamPtr);
 				
-			SetFileReadOnly (fileStreamPtr);
+				}	// end "else if (gImageFileInfoPtr->format == 0 || ..."
 			
 			MInitCursor ();
 			
-			}	// end "if (gImageFileInfoPtr->format == 0)" 
+			}	// end "if (gImageFileInfoPtr->format == 0 || ..." 
 		
 		else	// gImageFileInfoPtr->format != 0 
 			{
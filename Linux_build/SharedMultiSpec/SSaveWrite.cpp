@@ -18,7 +18,7 @@
 //
 //	Authors:					Larry L. Biehl
 //
-//	Revision date:			08/24/2020
+//	Revision date:			10/18/2026
 //
 //	Language:				C
 //
@@ -210,6 +210,10 @@ void		ReadTransformationGetFileSizes (
 				UInt32*								computedFileSize2Ptr,
 				UInt32*								computedFileSize3Ptr);
 
+void		SetUpENVIHeaderFileStream (
+				FileInfoPtr 						fileInfoPtr,
+				CMFileStream*						headerStreamPtr);
+
 Boolean 	WriteArcViewWorldFile (
 				FileInfoPtr 						fileInfoPtr);
 
@@ -221,6 +225,10 @@ SInt16 	WriteArcViewMapInformation (
 Boolean 	WriteArcViewHeaderFile (
 				FileInfoPtr 						fileInfoPtr);
 
+SInt16 	WriteENVIHeaderMapInfo (
+				FileInfoPtr 						fileInfoPtr,
+				CMFileStream*						headerStreamPtr);
+
 SInt16 	WriteGeoTIFFInformation (
 				FileInfoPtr 						fileInfoPtr,
 				CMFileStream*						fileStreamPtr,
@@ -262,6 +270,47 @@ Boolean 	WriteTextOutputFile (
 
 
 
+//------------------------------------------------------------------------------------
+//                   Copyright 1988-2020 Purdue Research Foundation
+//
+//	Function name:		void DeleteENVIHeaderFile
+//
+//	Software purpose:	This routine deletes the ENVI header file that MultiSpec wrote
+//							next to the image file. This is done when the header
+//							information is to be inserted at the front of the image file
+//							so that the old header file does not take precedence when the
+//							image file is opened again.
+//
+//	Parameters in:		file information pointer
+//
+//	Parameters out:	None
+//
+//	Value Returned:	None
+//
+// Called By:			ChangeErdasHeader in SReformatUtilities.cpp
+//
+//	Coded By:			agent						Date: 10/18/2026
+//	Revised By:			agent						Date: 10/18/2026
+
+void DeleteENVIHeaderFile (
+				FileInfoPtr 						fileInfoPtr)
+
+{
+	CMFileStream						headerFileStream;
+
+
+	if (fileInfoPtr != NULL)
+		{
+		SetUpENVIHeaderFileStream (fileInfoPtr, &headerFileStream);
+
+		MDeleteFile (&headerFileStream, kErrorMessages);
+
+		}	// end "if (fileInfoPtr != NULL)"
+
+}	// end "DeleteENVIHeaderFile"
+
+
+
 //------------------------------------------------------------------------------------
 //                   Copyright 1992-2020 Purdue Research Foundation
 //
@@ -5204,6 +5253,66 @@ Boolean SaveTextOutputAs (void)
 
 
 
+//------------------------------------------------------------------------------------
+//                   Copyright 1988-2020 Purdue Research Foundation
+//
+//	Function name:		void SetUpENVIHeaderFileStream
+//
+//	Software purpose:	This routine sets up the file stream for the ENVI header file
+//							that MultiSpec writes next to the image file. The header file
+//							is in the same folder as the image file and its name is the
+//							image file name with .hdr added to the end. The suffix of the
+//							image file is kept so that a header file for another image
+//							file with the same base name is not used.
+//
+//	Parameters in:		file information pointer
+//
+//	Parameters out:	header file stream
+//
+//	Value Returned:	None
+//
+// Called By:			DeleteENVIHeaderFile in SSaveWrite.cpp
+//							WriteENVIHeaderFile in SSaveWrite.cpp
+//
+//	Coded By:			agent						Date: 10/18/2026
+//	Revised By:			agent						Date: 10/18/2026
+
+void SetUpENVIHeaderFileStream (
+				FileInfoPtr 						fileInfoPtr,
+				CMFileStream*						headerStreamPtr)
+
+{
+	FileStringPtr						headerFileNamePtr;
+
+	CMFileStream*						fileStreamPtr;
+
+
+	fileStreamPtr = GetFileStreamPointer (fileInfoPtr);
+
+	CopyFileStream (headerStreamPtr, fileStreamPtr);
+
+	headerFileNamePtr =
+					(FileStringPtr)GetFilePathPPointerFromFileStream (headerStreamPtr);
+
+	ConcatFilenameSuffix (headerFileNamePtr, (StringPtr)"\0.hdr\0");
+
+	SetType (headerStreamPtr, kTEXTFileType);
+
+			// Make sure that the settings for the header file indicate that it is
+			// closed to start with. Otherwise we may end up closing the file
+			// for 'fileInfoPtr'.
+
+	IndicateFileClosed (headerStreamPtr);
+
+			// Now get wide character and unicode names.
+
+	SetFileDoesNotExist (headerStreamPtr, kKeepUTF8CharName);
+	UpdateFileNameInformation (headerStreamPtr, NULL);
+
+}	// end "SetUpENVIHeaderFileStream"
+
+
+
 //------------------------------------------------------------------------------------
 //                   Copyright 1988-2020 Purdue Research Foundation
 //
@@ -6054,6 +6163,373 @@ SInt16 WriteArcViewMapInformation (
 
 
 
+//------------------------------------------------------------------------------------
+//                   Copyright 1988-2020 Purdue Research Foundation
+//
+//	Function name:		Boolean WriteENVIHeaderFile
+//
+//	Software purpose:	This routine writes an ENVI formatted header file next to the
+//							image file describing the image file. This allows header
+//							information to be added or changed without moving the image
+//							data in the file. The header file name is the image file
+//							name with .hdr added to the end. The description identifies
+//							the header file as one written by MultiSpec so that it will
+//							take precedence over any header in the image file when the
+//							image file is opened again.
+//
+//	Parameters in:		file information pointer
+//
+//	Parameters out:	None
+//
+//	Value Returned:	true - if ENVI header file written without problem
+//							false - if error writing ENVI header file.
+//
+// Called By:			ChangeErdasHeader in SReformatUtilities.cpp
+//
+//	Coded By:			agent						Date: 10/18/2026
+//	Revised By:			agent						Date: 10/18/2026
+
+Boolean WriteENVIHeaderFile (
+				FileInfoPtr 						fileInfoPtr)
+
+{
+	CMFileStream						headerFileStream;
+
+	CMFileStream						*fileStreamPtr,
+											*headerStreamPtr;
+
+	char									*fileTypePtr,
+											*interleavePtr;
+
+	UInt32								count;
+
+	SInt16								byteOrder,
+											dataType,
+											errCode;
+
+
+	errCode = -1;
+	if (fileInfoPtr != NULL)
+		{
+		fileStreamPtr = GetFileStreamPointer (fileInfoPtr);
+
+				// Set up the header stream so that the file is written in the same
+				// folder as the image file.
+
+		headerStreamPtr = &headerFileStream;
+		SetUpENVIHeaderFileStream (fileInfoPtr, headerStreamPtr);
+
+		SInt16 vRefNum = GetVolumeReferenceNumber (fileStreamPtr);
+
+				// Create the header file in the same volume as that for the image file.
+
+		errCode = CreateNewFile (headerStreamPtr,
+											vRefNum,
+											'ttxt',
+											kErrorMessages,
+											kReplaceFlag);
+
+		if (errCode == noErr)
+			{
+					// Write the identifier and the description which indicates that
+					// MultiSpec wrote the header file.
+
+			count = sprintf ((char*)gTextString,
+									"ENVI%sdescription = {%s  MultiSpec header file}%s",
+									gEndOfLine,
+									gEndOfLine,
+									gEndOfLine);
+
+			errCode = MWriteData (headerStreamPtr, &count, gTextString, kErrorMessages);
+
+			}	// end "if (errCode == noErr)"
+
+		if (errCode == noErr)
+			{
+					// Write the image size and the number of header bytes.
+
+			count = sprintf ((char*)gTextString,
+									"samples = %u%slines = %u%sbands = %u%s"
+									"header offset = %u%s",
+									(unsigned int)fileInfoPtr->numberColumns,
+									gEndOfLine,
+									(unsigned int)fileInfoPtr->numberLines,
+									gEndOfLine,
+									(unsigned int)fileInfoPtr->numberChannels,
+									gEndOfLine,
+									(unsigned int)fileInfoPtr->numberHeaderBytes,
+									gEndOfLine);
+
+			errCode = MWriteData (headerStreamPtr, &count, gTextString, kErrorMessages);
+
+			}	// end "if (errCode == noErr)"
+
+		if (errCode == noErr)
+			{
+					// Write "file type". Thematic images are written as ENVI
+					// classification files with the number of classes.
+
+			fileTypePtr = (char*)"ENVI Standard";
+			if (fileInfoPtr->thematicType)
+				fileTypePtr = (char*)"ENVI Classification";
+
+			count = sprintf ((char*)gTextString,
+									"file type = %s%s",
+									fileTypePtr,
+									gEndOfLine);
+
+			if (fileInfoPtr->thematicType)
+				count += sprintf ((char*)&gTextString[count],
+										"classes = %u%s",
+										(unsigned int)fileInfoPtr->numberClasses,
+										gEndOfLine);
+
+			errCode = MWriteData (headerStreamPtr, &count, gTextString, kErrorMessages);
+
+			}	// end "if (errCode == noErr)"
+
+		if (errCode == noErr)
+			{
+					// Write "data type", "interleave" and "byte order". The ENVI
+					// byte order is 0 for little endian and 1 for big endian.
+
+			dataType = 1;
+			if (fileInfoPtr->dataTypeCode == kRealType)
+				{
+				dataType = 4;
+				if (fileInfoPtr->numberBytes == 8)
+					dataType = 5;
+
+				}	// end "if (fileInfoPtr->dataTypeCode == kRealType)"
+
+			else if (fileInfoPtr->numberBytes == 2)
+				{
+				dataType = 12;
+				if (fileInfoPtr->signedDataFlag)
+					dataType = 2;
+
+				}	// end "else if (fileInfoPtr->numberBytes == 2)"
+
+			else if (fileInfoPtr->numberBytes == 4)
+				{
+				dataType = 13;
+				if (fileInfoPtr->signedDataFlag)
+					dataType = 3;
+
+				}	// end "else if (fileInfoPtr->numberBytes == 4)"
+
+			if (fileInfoPtr->bandInterleave == kBSQ)
+				interleavePtr = (char*)"bsq";
+
+			else if (fileInfoPtr->bandInterleave == kBIS)
+				interleavePtr = (char*)"bip";
+
+			else	// fileInfoPtr->bandInterleave != kBSQ && != kBIS
+				interleavePtr = (char*)"bil";
+
+			byteOrder = 0;
+			if (gBigEndianFlag != fileInfoPtr->swapBytesFlag)
+				byteOrder = 1;
+
+			count = sprintf ((char*)gTextString,
+									"data type = %d%sinterleave = %s%sbyte order = %d%s",
+									dataType,
+									gEndOfLine,
+									interleavePtr,
+									gEndOfLine,
+									byteOrder,
+									gEndOfLine);
+
+			errCode = MWriteData (headerStreamPtr, &count, gTextString, kErrorMessages);
+
+			}	// end "if (errCode == noErr)"
+
+		if (errCode == noErr)
+			{
+					// Write "xstart" and "ystart".
+
+			count = sprintf ((char*)gTextString,
+									"xstart = %u%systart = %u%s",
+									(unsigned int)fileInfoPtr->startColumn,
+									gEndOfLine,
+									(unsigned int)fileInfoPtr->startLine,
+									gEndOfLine);
+
+			errCode = MWriteData (headerStreamPtr, &count, gTextString, kErrorMessages);
+
+			}	// end "if (errCode == noErr)"
+
+		if (errCode == noErr)
+			errCode = WriteENVIHeaderMapInfo (fileInfoPtr, headerStreamPtr);
+
+		CloseFile (headerStreamPtr);
+
+		}	// end "if (fileInfoPtr != NULL)"
+
+	return (errCode == noErr);
+
+}	// end "WriteENVIHeaderFile"
+
+
+
+//------------------------------------------------------------------------------------
+//                   Copyright 1988-2020 Purdue Research Foundation
+//
+//	Function name:		SInt16 WriteENVIHeaderMapInfo
+//
+//	Software purpose:	This routine writes the map information to the ENVI header
+//							file in the "map info" format that ReadENVIHeaderMapInfo
+//							reads. The reference pixel is given as 1.5 since MultiSpec
+//							map coordinates are for the center of the upper left pixel.
+//
+//	Parameters in:		file information pointer
+//							header file stream pointer
+//
+//	Parameters out:	None
+//
+//	Value Returned:	Error code for file operations.
+//
+// Called By:			WriteENVIHeaderFile in SSaveWrite.cpp
+//
+//	Coded By:			agent						Date: 10/18/2026
+//	Revised By:			agent						Date: 10/18/2026
+
+SInt16 WriteENVIHeaderMapInfo (
+				FileInfoPtr 						fileInfoPtr,
+				CMFileStream*						headerStreamPtr)
+
+{
+	MapProjectionInfoPtr				mapProjectionInfoPtr;
+
+	char									*datumPtr,
+											*projectionNamePtr,
+											*unitsPtr;
+
+	UInt32								count;
+
+	SInt16								errCode = noErr,
+											projectionCode,
+											referenceSystemCode;
+
+
+	mapProjectionInfoPtr = (MapProjectionInfoPtr)GetHandlePointer (
+																	fileInfoPtr->mapProjectionHandle,
+																	kLock);
+
+	if (mapProjectionInfoPtr != NULL &&
+				(mapProjectionInfoPtr->planarCoordinate.horizontalPixelSize != 0 ||
+						mapProjectionInfoPtr->planarCoordinate.verticalPixelSize != 0))
+		{
+		referenceSystemCode = mapProjectionInfoPtr->gridCoordinate.referenceSystemCode;
+		projectionCode = mapProjectionInfoPtr->gridCoordinate.projectionCode;
+
+				// Get the projection name that GetProjectionNameInfo recognizes.
+
+		if (referenceSystemCode == kGeographicRSCode)
+			projectionNamePtr = (char*)"Geographic Lat/Lon";
+
+		else if (referenceSystemCode >= kUTM_NAD27RSCode &&
+															referenceSystemCode <= kUTMRSCode)
+			projectionNamePtr = (char*)"UTM";
+
+		else if (referenceSystemCode == kStatePlaneNAD27RSCode ||
+													referenceSystemCode == kStatePlaneNAD83RSCode)
+			projectionNamePtr = (char*)"SPCS";
+
+		else if (projectionCode == kAlbersConicalEqualAreaCode)
+			projectionNamePtr = (char*)"ACEA";
+
+		else if (projectionCode == kLambertAzimuthalEqualAreaCode)
+			projectionNamePtr = (char*)"Lambert Azimuthal Equal Area";
+
+		else if (projectionCode == kPolarStereographicCode)
+			projectionNamePtr = (char*)"Polar Stereographic";
+
+		else	// projection name not recognized by GetProjectionNameInfo
+			projectionNamePtr = (char*)"Arbitrary";
+
+		switch (mapProjectionInfoPtr->geodetic.datumCode)
+			{
+			case kWGS84Code:
+				datumPtr = (char*)"WGS-84";
+				break;
+
+			case kNAD27Code:
+				datumPtr = (char*)"North America 1927";
+				break;
+
+			case kNAD83Code:
+				datumPtr = (char*)"North America 1983";
+				break;
+
+			default:
+				datumPtr = (char*)"Unknown";
+				break;
+
+			}	// end "switch (mapProjectionInfoPtr->geodetic.datumCode)"
+
+		switch (mapProjectionInfoPtr->planarCoordinate.mapUnitsCode)
+			{
+			case kDecimalDegreesCode:
+				unitsPtr = (char*)"Degrees";
+				break;
+
+			case kFeetCode:
+				unitsPtr = (char*)"Feet";
+				break;
+
+			default:
+				unitsPtr = (char*)"Meters";
+				break;
+
+			}	// end "switch (...->planarCoordinate.mapUnitsCode)"
+
+				// Write the projection name, reference pixel, upper left map
+				// coordinates and pixel size.
+
+		count = sprintf ((char*)gTextString,
+								"map info = {%s, 1.5, 1.5, %.7f, %.7f, %.11g, %.11g, ",
+								projectionNamePtr,
+								mapProjectionInfoPtr->planarCoordinate.xMapCoordinate11,
+								mapProjectionInfoPtr->planarCoordinate.yMapCoordinate11,
+								mapProjectionInfoPtr->planarCoordinate.horizontalPixelSize,
+								mapProjectionInfoPtr->planarCoordinate.verticalPixelSize);
+
+				// UTM includes the zone and hemisphere before the datum. The units
+				// are always meters for UTM.
+
+		if (referenceSystemCode >= kUTM_NAD27RSCode && referenceSystemCode <= kUTMRSCode)
+			{
+			count += sprintf ((char*)&gTextString[count],
+									"%d, ",
+									abs (mapProjectionInfoPtr->gridCoordinate.gridZone));
+
+			if (mapProjectionInfoPtr->gridCoordinate.gridZone < 0)
+				count += sprintf ((char*)&gTextString[count], "South, ");
+
+			else	// ...->gridCoordinate.gridZone >= 0
+				count += sprintf ((char*)&gTextString[count], "North, ");
+
+			}	// end "if (referenceSystemCode >= kUTM_NAD27RSCode && ..."
+
+		count += sprintf ((char*)&gTextString[count],
+								"%s, units=%s}%s",
+								datumPtr,
+								unitsPtr,
+								gEndOfLine);
+
+		errCode = MWriteData (headerStreamPtr, &count, gTextString, kErrorMessages);
+
+		}	// end "if (mapProjectionInfoPtr != NULL && ..."
+
+	CheckAndUnlockHandle (fileInfoPtr->mapProjectionHandle);
+
+	return (errCode);
+
+}	// end "WriteENVIHeaderMapInfo"
+
+
+
 //------------------------------------------------------------------------------------
 //                   Copyright 1988-2020 Purdue Research Foundation
 //
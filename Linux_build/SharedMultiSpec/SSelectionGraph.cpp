@@ -18,7 +18,7 @@
 //
 //	Authors:					Larry L. Biehl
 //
-//	Revision date:			11/20/2019
+//	Revision date:			10/18/2026
 //
 //	Language:				C
 //
@@ -63,6 +63,13 @@
 Boolean 	CheckMemoryForStatisticsIO  (
 				SelectionIOInfoPtr				selectionIOInfoPtr);
 
+SInt16 	GetProfileFromCache  (
+				SelectionIOInfoPtr				selectionIOInfoPtr,
+				FileIOInstructionsPtr			fileIOInstructionsPtr,
+				UInt32								line,
+				UInt32								column,
+				HDoublePtr*							profilePtrPtr);
+
 
 
 //------------------------------------------------------------------------------------
@@ -91,7 +98,8 @@ Boolean CheckMemoryForStatisticsIO  (
 {	                                          
 	SInt32								totalBytesNeeded;
 	
-	Boolean								changedFlag,
+	Boolean								cacheOKFlag,
+											changedFlag,
 											continueFlag;
 	
 	
@@ -121,12 +129,191 @@ Boolean CheckMemoryForStatisticsIO  (
 			
 		}	// end "if (continueFlag)" 
 		
+	if (continueFlag)
+		{
+				// Check handle for the spectral profile cache. The cache is not 
+				// required; single pixel values will be read directly from the 
+				// file if the memory is not available.
+				
+		totalBytesNeeded = kProfileCacheNumberBlocks * kProfileCacheBlockColumns *
+									(UInt32)gImageWindowInfoPtr->totalNumberChannels *
+																						sizeof (double);
+								
+		CheckHandleSize (&selectionIOInfoPtr->profileCacheHandle, 
+								&cacheOKFlag, 
+								&changedFlag, 
+								totalBytesNeeded);
+								
+		if (!cacheOKFlag)
+			selectionIOInfoPtr->profileCacheHandle = 
+							UnlockAndDispose (selectionIOInfoPtr->profileCacheHandle);
+		
+				// The data in the cache are no longer valid.
+				
+		selectionIOInfoPtr->profileCacheWindow = gActiveImageWindow;
+		selectionIOInfoPtr->profileCacheNextSlot = 0;
+		for (int index=0; index<kProfileCacheNumberBlocks; index++)
+			selectionIOInfoPtr->profileCacheLine[index] = -1;
+			
+		}	// end "if (continueFlag)" 
+		
 	return (continueFlag);
 
 }	// end "CheckMemoryForStatisticsIO"    
 
 
 
+//------------------------------------------------------------------------------------
+//                   Copyright 1988-2020 Purdue Research Foundation
+//
+//	Function name:		SInt16 GetProfileFromCache
+//
+//	Software purpose:	This routine returns a pointer to the BIS real8 data values for
+//							all channels of the requested pixel. The values are taken from
+//							the spectral profile cache if the block of columns that the 
+//							pixel is in has already been read. Otherwise the block of 
+//							columns is read from the file into the next slot in the cache.
+//							For BSQ and BIL files, reading a block of columns takes about
+//							the same number of file seeks as reading one pixel, so moving 
+//							the selection around within the cached area requires no file IO.
+//
+//	Parameters in:		Pointer to the selection IO structure
+//							Pointer to the general file IO instructions
+//							Line and column of the pixel
+//
+//	Parameters out:	Pointer to the data values for the pixel
+//
+// Value Returned:	noErr if okay
+//							error code from GetLineOfData if there was an IO problem
+// 
+// Called By:			ShowGraphWindowSelection in SSelectionGraph.cpp
+//
+//	Coded By:			agent						Date: 10/18/2026
+//	Revised By:			agent						Date: 10/18/2026
+
+SInt16 GetProfileFromCache  (
+				SelectionIOInfoPtr				selectionIOInfoPtr,
+				FileIOInstructionsPtr			fileIOInstructionsPtr,
+				UInt32								line,
+				UInt32								column,
+				HDoublePtr*							profilePtrPtr)
+
+{
+	HDoublePtr							cachePtr,
+											slotPtr;
+	
+	UInt32								blockNumberValues,
+											columnEnd,
+											columnStart,
+											numberChannels;
+	
+	SInt32								columnBlock;
+	
+	SInt16								errCode,
+											slot;
+	
+	
+	numberChannels = gImageWindowInfoPtr->totalNumberChannels;
+	
+			// Read directly into the output buffer if no cache is available.
+			
+	if (selectionIOInfoPtr->profileCacheHandle == NULL)
+		{
+		errCode = SetUpFileIOInstructions (fileIOInstructionsPtr,
+														&gAreaDescription,
+														numberChannels,
+														NULL,
+														kDetermineSpecialBILFlag);
+			                
+		if (errCode == noErr)
+			errCode = GetLineOfData (fileIOInstructionsPtr,
+												line, 
+												column,
+												column,
+												1,
+												gInputBufferPtr,
+												gOutputBufferPtr);
+												
+		CloseUpFileIOInstructions (fileIOInstructionsPtr, &gAreaDescription);
+		
+		*profilePtrPtr = (HDoublePtr)gOutputBufferPtr;
+																							return (errCode);
+		
+		}	// end "if (selectionIOInfoPtr->profileCacheHandle == NULL)"
+	
+	cachePtr = (HDoublePtr)GetHandlePointer (
+											selectionIOInfoPtr->profileCacheHandle, kLock);
+	blockNumberValues = kProfileCacheBlockColumns * numberChannels;
+	
+	columnBlock = (column - 1) / kProfileCacheBlockColumns;
+	columnStart = columnBlock * kProfileCacheBlockColumns + 1;
+	
+			// Check if the block of columns is already in the cache.
+			
+	for (slot=0; slot<kProfileCacheNumberBlocks; slot++)
+		{
+		if (selectionIOInfoPtr->profileCacheLine[slot] == (SInt32)line &&
+						selectionIOInfoPtr->profileCacheColumnBlock[slot] == columnBlock)
+			{
+			slotPtr = &cachePtr[slot*blockNumberValues];
+			*profilePtrPtr = &slotPtr[(column-columnStart)*numberChannels];
+																							return (noErr);
+			
+			}	// end "if (selectionIOInfoPtr->profileCacheLine[slot] == ..."
+		
+		}	// end "for (slot=0; slot<kProfileCacheNumberBlocks; slot++)"
+	
+			// Read the block of columns into the next cache slot.
+	
+	columnEnd = columnStart + kProfileCacheBlockColumns - 1;
+	columnEnd = MIN (columnEnd, gImageWindowInfoPtr->maxNumberColumns);
+	
+	gAreaDescription.columnStart = columnStart;
+	gAreaDescription.columnEnd = columnEnd;
+	
+	errCode = SetUpFileIOInstructions (fileIOInstructionsPtr,
+													&gAreaDescription,
+													numberChannels,
+													NULL,
+													kDetermineSpecialBILFlag);
+			                
+	if (errCode == noErr)
+		errCode = GetLineOfData (fileIOInstructionsPtr,
+											line, 
+											columnStart,
+											columnEnd,
+											1,
+											gInputBufferPtr,
+											gOutputBufferPtr);
+												
+	CloseUpFileIOInstructions (fileIOInstructionsPtr, &gAreaDescription);
+	
+	gAreaDescription.columnStart = column;
+	gAreaDescription.columnEnd = column;
+	
+	if (errCode != noErr)
+																							return (errCode);
+	
+	slot = selectionIOInfoPtr->profileCacheNextSlot;
+	slotPtr = &cachePtr[slot*blockNumberValues];
+	
+	BlockMoveData (gOutputBufferPtr, 
+						slotPtr, 
+						(columnEnd - columnStart + 1) * numberChannels * sizeof (double));
+	
+	selectionIOInfoPtr->profileCacheLine[slot] = line;
+	selectionIOInfoPtr->profileCacheColumnBlock[slot] = columnBlock;
+	selectionIOInfoPtr->profileCacheNextSlot = 
+											(slot + 1) % kProfileCacheNumberBlocks;
+	
+	*profilePtrPtr = &slotPtr[(column-columnStart)*numberChannels];
+	
+	return (noErr);
+
+}	// end "GetProfileFromCache" 
+
+
+
 //------------------------------------------------------------------------------------
 //                   Copyright 1988-2020 Purdue Research Foundation
 //
@@ -376,6 +563,7 @@ void ShowGraphWindowSelection (
 	FileIOInstructionsPtr			fileIOInstructionsPtr;
 	HChannelStatisticsPtr			channelStatsPtr;  
 	GraphPtr								selectionGraphRecordPtr;
+	HDoublePtr							profilePtr;
 	SelectionIOInfoPtr				selectionIOInfoPtr; 
 	HSumSquaresStatisticsPtr		totalSumSquaresPtr;
 	HUCharPtr							tiledBufferPtr;
@@ -812,37 +1000,34 @@ void ShowGraphWindowSelection (
 				{					
 				gAreaDescription.lineEnd = gAreaDescription.lineStart;
 				gAreaDescription.columnEnd = gAreaDescription.columnStart;
+				
+						// The cache is only valid for the image window that it was
+						// loaded for.
+						
+				if (selectionIOInfoPtr->profileCacheWindow != gActiveImageWindow)
+					{
+					selectionIOInfoPtr->profileCacheWindow = gActiveImageWindow;
+					for (int index=0; index<kProfileCacheNumberBlocks; index++)
+						selectionIOInfoPtr->profileCacheLine[index] = -1;
+					
+					}	// end "if (...->profileCacheWindow != gActiveImageWindow)"
 			
-						// Load some of the File IO Instructions structure that pertain
-						// to the specific area being used.
+						// Get the data values for the pixel from the spectral profile
+						// cache. The block of columns containing the pixel is read 
+						// into the cache if needed.
 						
-				errCode = SetUpFileIOInstructions (
-														fileIOInstructionsPtr,
-														&gAreaDescription,
-														gImageWindowInfoPtr->totalNumberChannels,
-														NULL,
-														kDetermineSpecialBILFlag);
-			                
-				if (errCode == noErr)
-					errCode = GetLineOfData (fileIOInstructionsPtr,
-														gAreaDescription.lineStart, 
-														gAreaDescription.columnStart,
-														gAreaDescription.columnStart,
-														1,
-														gInputBufferPtr,
-														gOutputBufferPtr);
+				errCode = GetProfileFromCache (selectionIOInfoPtr,
+															fileIOInstructionsPtr,
+															gAreaDescription.lineStart, 
+															gAreaDescription.columnStart,
+															&profilePtr);
 								
 				if (errCode != noErr)
 					vectorLength = 0;
-		
-						// Close up any File IO Instructions structure that pertain
-						// to the specific area that was classified.
-						
-				CloseUpFileIOInstructions (fileIOInstructionsPtr, &gAreaDescription);
 				
 				if (continueFlag)				
 					LoadGraphYVector (selectionGraphRecordPtr, 
-											(double*)gOutputBufferPtr,
+											(double*)profilePtr,
 											vectorLength,
 											1);
 				
@@ -871,6 +1056,7 @@ void ShowGraphWindowSelection (
 													gAreaDescription.columnEnd);
 				
 		CheckAndUnlockHandle (selectionIOInfoPtr->ioBufferHandle);
+		CheckAndUnlockHandle (selectionIOInfoPtr->profileCacheHandle);
 		CheckAndUnlockHandle (selectionIOInfoPtr->channelStatsHandle);
 		CheckAndUnlockHandle (selectionIOInfoPtr->sumSquaresHandle);
 			
@@ -922,6 +1108,8 @@ void ShowGraphWindowSelection (
 									UnlockAndDispose (selectionIOInfoPtr->sumSquaresHandle);
 		selectionIOInfoPtr->ioBufferHandle = 
 									UnlockAndDispose (selectionIOInfoPtr->ioBufferHandle);
+		selectionIOInfoPtr->profileCacheHandle = 
+									UnlockAndDispose (selectionIOInfoPtr->profileCacheHandle);
 		
 		}	// end "if (!memoryOKFlag)" 
 				
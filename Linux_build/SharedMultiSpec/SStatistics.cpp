@@ -18,7 +18,7 @@
 //
 //	Authors:					Larry L. Biehl
 //
-//	Revision date:			02/18/2020
+//	Revision date:			10/18/2026
 //
 //	Language:				C
 //
@@ -185,6 +185,12 @@ SInt16 gStatisticsWindHeight = 147;  // 117
 		// Prototypes for routines in this file that are only called by
 		// other routines in this file.
 
+void AddNameToProjectNameIndex (
+				SInt16*								nameIndexPtr,
+				UInt32								nameIndexSize,
+				UCharPtr								namePtr,
+				SInt16								entry);
+
 Boolean AddPointsToProject (
 				SInt16								pointType,
 				SInt16								currentStorageField);
@@ -217,6 +223,14 @@ void DrawStatPopUp (
 void DrawStatPrompt (
 				SInt16								menuItem);
 
+SInt16 FindClassNameInIndex (
+				SInt16								currentStorage,
+				UCharPtr								namePtr);
+
+SInt16 FindFieldNameInIndex (
+				SInt16								currentField,
+				UCharPtr								namePtr);
+
 SInt16 GetControlValue (
 				WindowPtr							windowPtr,
 				ControlHandle						controlHandle);
@@ -229,6 +243,9 @@ SInt16 GetCurrentField (
 				SInt16								classNumber,
 				SInt16								classFieldNumber);
 
+UInt32 GetNameHashValue (
+				UCharPtr								namePtr);
+
 void HideStatControl (
 				ControlHandle						controlHandle);
 
@@ -248,6 +265,10 @@ void SetStatControlTitle (
 				ControlHandle						controlHandle,
 				char*									titleStringPtr);
 
+Boolean SetUpClassNameIndex (void);
+
+Boolean SetUpFieldNameIndex (void);
+
 void ShowStatControl (
 				ControlHandle						controlHandle);
 
@@ -728,7 +749,7 @@ void ActivateStatControls (void)
 //							AddFieldToProject in SStatistics.cpp
 //
 //	Coded By:			Larry L. Biehl			Date: 02/22/1989
-//	Revised By:			Larry L. Biehl			Date: 11/21/2019
+//	Revised By:			agent						Date: 10/18/2026
 
 Boolean AddClassToProject (
 				UCharPtr								classNamePtr)
@@ -793,6 +814,25 @@ Boolean AddClassToProject (
    classNamesPtr[currentStorageClass].classNumber =
 											(SInt16)gProjectInfoPtr->numberStatisticsClasses;
 
+			// Add the name to the hashed class name index if the index is current
+			// and there is room. Otherwise it will be rebuilt when next used.
+
+   if (gProjectInfoPtr->classNameIndexPtr != NULL &&
+			gProjectInfoPtr->nameIndexStorageClasses == (SInt16)currentStorageClass &&
+				gProjectInfoPtr->nameIndexStatisticsClasses == (SInt16)currentClass &&
+					4 * (currentStorageClass + 1) <= gProjectInfoPtr->classNameIndexSize)
+		{
+      AddNameToProjectNameIndex (gProjectInfoPtr->classNameIndexPtr,
+											gProjectInfoPtr->classNameIndexSize,
+											classNamesPtr[currentStorageClass].name,
+											(SInt16)currentStorageClass);
+
+      gProjectInfoPtr->nameIndexStorageClasses = gProjectInfoPtr->numberStorageClasses;
+      gProjectInfoPtr->nameIndexStatisticsClasses =
+										(SInt16)gProjectInfoPtr->numberStatisticsClasses;
+
+		}	// end "if (gProjectInfoPtr->classNameIndexPtr != NULL && ..."
+
 			// Set the type of statistics to be used for the class. If the project stats
 			// are mixed then set to original stats. Also if the project stats are
 			// enhanced, then set to original stats.
@@ -894,7 +934,7 @@ Boolean AddClassToProject (
 //							StatisticsWControlEvent SStatistics.cpp
 //
 //	Coded By:			Larry L. Biehl			Date: 09/30/1988
-//	Revised By:			Larry L. Biehl			Date: 05/05/2019
+//	Revised By:			agent						Date: 10/18/2026
 
 Boolean AddFieldToProject (
 				SInt16								currentClass,
@@ -1103,6 +1143,29 @@ Boolean AddFieldToProject (
 
 			}	// end "else classNamesPtr[currentStorageClass]..."
 
+				// Add the name to the hashed field name index if the index is
+				// current and there is room. Otherwise it will be rebuilt when
+				// next used.
+
+      if (gProjectInfoPtr->fieldNameIndexPtr != NULL &&
+				gProjectInfoPtr->nameIndexStorageFields == currentStorageField &&
+					gProjectInfoPtr->nameIndexStatisticsFields ==
+											gProjectInfoPtr->numberStatisticsFields - 1 &&
+						4 * ((UInt32)currentStorageField + 1) <=
+													gProjectInfoPtr->fieldNameIndexSize)
+			{
+         AddNameToProjectNameIndex (gProjectInfoPtr->fieldNameIndexPtr,
+												gProjectInfoPtr->fieldNameIndexSize,
+												fieldIdentPtr[currentStorageField].name,
+												currentStorageField);
+
+         gProjectInfoPtr->nameIndexStorageFields =
+													gProjectInfoPtr->numberStorageFields;
+         gProjectInfoPtr->nameIndexStatisticsFields =
+													gProjectInfoPtr->numberStatisticsFields;
+
+			}	// end "if (gProjectInfoPtr->fieldNameIndexPtr != NULL && ..."
+
 				// Set the statistics up-to-date flags depending on whether field
 				// is for testing or training.
 
@@ -1190,6 +1253,52 @@ Boolean AddFieldToProject (
 
 
 
+//------------------------------------------------------------------------------------
+//                   Copyright 1988-2020 Purdue Research Foundation
+//
+//	Function name:		void AddNameToProjectNameIndex
+//
+//	Software purpose:	The purpose of this routine is to add the input class storage
+//							or field number to the input hashed name index. The next empty
+//							slot after the slot for the hash value of the name is used.
+//
+//	Parameters in:		Pointer to the name index.
+//							Number of slots in the name index. This is a power of 2.
+//							Pointer to the pascal name string.
+//							Class storage or field number to be stored.
+//
+//	Parameters out:	None
+//
+// Value Returned:	None
+//
+// Called By:			AddClassToProject
+//							AddFieldToProject
+//							SetUpClassNameIndex
+//							SetUpFieldNameIndex
+//
+//	Coded By:			agent						Date: 10/18/2026
+//	Revised By:			agent						Date: 10/18/2026
+
+void AddNameToProjectNameIndex (
+				SInt16*								nameIndexPtr,
+				UInt32								nameIndexSize,
+				UCharPtr								namePtr,
+				SInt16								entry)
+
+{
+	UInt32								slot;
+
+
+	slot = GetNameHashValue (namePtr) & (nameIndexSize - 1);
+	while (nameIndexPtr[slot] != -1)
+		slot = (slot + 1) & (nameIndexSize - 1);
+
+	nameIndexPtr[slot] = entry;
+
+}	// end "AddNameToProjectNameIndex"
+
+
+
 //------------------------------------------------------------------------------------
 //                   Copyright 1988-2020 Purdue Research Foundation
 //
@@ -1593,7 +1702,7 @@ SInt16 AddSpecifiedStringToClassName (
 //							NewClassFieldDialog in SStatistics.cpp
 //
 //	Coded By:			Larry L. Biehl			Date: 01/18/1989
-//	Revised By:			Larry L. Biehl			Date: 06/14/2002	
+//	Revised By:			agent						Date: 10/18/2026	
 
 SInt16 CheckForDuplicateClassName (
 				SInt16								currentStorage,
@@ -1603,7 +1712,8 @@ SInt16 CheckForDuplicateClassName (
    char*									charPtr;
    HPClassNamesPtr					classNamesPtr;
 
-   SInt16								classStorage,
+   SInt16								classNumber,
+											classStorage,
 											numChars;
 
    UInt16								classIndex;
@@ -1624,6 +1734,17 @@ SInt16 CheckForDuplicateClassName (
       classNamesPtr = (HPClassNamesPtr)GetHandleStatusAndPointer (
 											gProjectInfoPtr->classNamesHandle, &handleStatus);
 
+				// Use the hashed class name index if it can be set up. Otherwise
+				// check each of the class names.
+
+      classNumber = FindClassNameInIndex (currentStorage, (UCharPtr)namePtr);
+      if (classNumber >= 0)
+			{
+         MHSetState (gProjectInfoPtr->classNamesHandle, handleStatus);
+																				return (classNumber);
+
+			}	// end "if (classNumber >= 0)"
+
       for (classIndex = 0;
 				classIndex < gProjectInfoPtr->numberStatisticsClasses;
 					classIndex++)
@@ -1684,7 +1805,7 @@ SInt16 CheckForDuplicateClassName (
 // Called By:
 //
 //	Coded By:			Larry L. Biehl			Date: 01/18/1989
-//	Revised By:			Larry L. Biehl			Date: 03/15/2017	
+//	Revised By:			agent						Date: 10/18/2026	
 
 SInt16 CheckForDuplicateFieldName (
 				SInt16								currentField,
@@ -1722,6 +1843,22 @@ SInt16 CheckForDuplicateFieldName (
       fieldIdentPtr = (HPFieldIdentifiersPtr)GetHandleStatusAndPointer (
 									gProjectInfoPtr->fieldIdentifiersHandle, &handleStatus2);
 
+				// Use the hashed field name index if it can be set up. Otherwise
+				// check each of the field names.
+
+      field = FindFieldNameInIndex (currentField, (UCharPtr)namePtr);
+      if (field >= -1)
+			{
+         MHSetState (gProjectInfoPtr->classNamesHandle, handleStatus1);
+         MHSetState (gProjectInfoPtr->fieldIdentifiersHandle, handleStatus2);
+
+         if (field >= 0)
+																								return (2);
+
+																								return (0);
+
+			}	// end "if (field >= -1)"
+
       for (classIndex = 0;
 				classIndex < gProjectInfoPtr->numberStatisticsClasses;
 				classIndex++)
@@ -3504,6 +3641,162 @@ void FieldListStatMode (
 
 
 
+//------------------------------------------------------------------------------------
+//                   Copyright 1988-2020 Purdue Research Foundation
+//
+//	Function name:		SInt16 FindClassNameInIndex
+//
+//	Software purpose:	The purpose of this routine is to use the hashed class name
+//							index to find a project class with the input name.
+//
+//	Parameters in:		Class storage number to skip; -1 if none.
+//							Pointer to the pascal name string.
+//
+//	Parameters out:	None
+//
+// Value Returned:	>0: class number of the class with the same name.
+//							 0: no class has the same name.
+//							-1: the index could not be set up.
+//
+// Called By:			CheckForDuplicateClassName
+//
+//	Coded By:			agent						Date: 10/18/2026
+//	Revised By:			agent						Date: 10/18/2026
+
+SInt16 FindClassNameInIndex (
+				SInt16								currentStorage,
+				UCharPtr								namePtr)
+
+{
+	HPClassNamesPtr					classNamesPtr;
+	SInt16*								nameIndexPtr;
+
+	UInt32								slot;
+
+	SInt16								classNumber,
+											classStorage;
+
+	UInt16								classIndex;
+
+
+	if (!SetUpClassNameIndex ())
+																							return (-1);
+
+	classNamesPtr = gProjectInfoPtr->classNamesPtr;
+	nameIndexPtr = gProjectInfoPtr->classNameIndexPtr;
+
+	slot = GetNameHashValue (namePtr) & (gProjectInfoPtr->classNameIndexSize - 1);
+	while (nameIndexPtr[slot] != -1)
+		{
+		classStorage = nameIndexPtr[slot];
+
+		if (classStorage != currentStorage &&
+				CompareStringsNoCase ((UCharPtr)classNamesPtr[classStorage].name,
+												namePtr,
+												classNamesPtr[classStorage].name[0] + 1) == 0)
+			{
+					// Get the class number for this storage number. Search the
+					// class list if the number in the class structure is not
+					// current.
+
+			classNumber = classNamesPtr[classStorage].classNumber;
+			if (classNumber < 1 ||
+					classNumber > (SInt16)gProjectInfoPtr->numberStatisticsClasses ||
+						gProjectInfoPtr->storageClass[classNumber-1] != classStorage)
+				{
+				classNumber = 0;
+				for (classIndex=0;
+						classIndex<gProjectInfoPtr->numberStatisticsClasses;
+							classIndex++)
+					{
+					if (gProjectInfoPtr->storageClass[classIndex] == classStorage)
+						{
+						classNumber = classIndex + 1;
+						break;
+
+						}	// end "if (...->storageClass[classIndex] == classStorage)"
+
+					}	// end "for (classIndex=0; ..."
+
+				}	// end "if (classNumber < 1 || ..."
+
+			if (classNumber > 0)
+																					return (classNumber);
+
+			}	// end "if (classStorage != currentStorage && ..."
+
+		slot = (slot + 1) & (gProjectInfoPtr->classNameIndexSize - 1);
+
+		}	// end "while (nameIndexPtr[slot] != -1)"
+
+	return (0);
+
+}	// end "FindClassNameInIndex"
+
+
+
+//------------------------------------------------------------------------------------
+//                   Copyright 1988-2020 Purdue Research Foundation
+//
+//	Function name:		SInt16 FindFieldNameInIndex
+//
+//	Software purpose:	The purpose of this routine is to use the hashed field name
+//							index to find a project field with the input name.
+//
+//	Parameters in:		Field number to skip; -1 if none.
+//							Pointer to the pascal name string.
+//
+//	Parameters out:	None
+//
+// Value Returned:	>=0: field number of the field with the same name.
+//							 -1: no field has the same name.
+//							 -2: the index could not be set up.
+//
+// Called By:			CheckForDuplicateFieldName
+//
+//	Coded By:			agent						Date: 10/18/2026
+//	Revised By:			agent						Date: 10/18/2026
+
+SInt16 FindFieldNameInIndex (
+				SInt16								currentField,
+				UCharPtr								namePtr)
+
+{
+	HPFieldIdentifiersPtr			fieldIdentPtr;
+	SInt16*								nameIndexPtr;
+
+	UInt32								slot;
+
+	SInt16								field;
+
+
+	if (!SetUpFieldNameIndex ())
+																							return (-2);
+
+	fieldIdentPtr = gProjectInfoPtr->fieldIdentPtr;
+	nameIndexPtr = gProjectInfoPtr->fieldNameIndexPtr;
+
+	slot = GetNameHashValue (namePtr) & (gProjectInfoPtr->fieldNameIndexSize - 1);
+	while (nameIndexPtr[slot] != -1)
+		{
+		field = nameIndexPtr[slot];
+
+		if (field != currentField &&
+				CompareStringsNoCase ((UCharPtr)fieldIdentPtr[field].name,
+												namePtr,
+												fieldIdentPtr[field].name[0] + 1) == 0)
+																						return (field);
+
+		slot = (slot + 1) & (gProjectInfoPtr->fieldNameIndexSize - 1);
+
+		}	// end "while (nameIndexPtr[slot] != -1)"
+
+	return (-1);
+
+}	// end "FindFieldNameInIndex"
+
+
+
 //------------------------------------------------------------------------------------
 //                   Copyright 1988-2020 Purdue Research Foundation
 //
@@ -3988,6 +4281,57 @@ void GetLineColFromList (
 
 
 
+//------------------------------------------------------------------------------------
+//                   Copyright 1988-2020 Purdue Research Foundation
+//
+//	Function name:		UInt32 GetNameHashValue
+//
+//	Software purpose:	The purpose of this routine is to get the hash value for the
+//							input pascal string ignoring the case of the characters. Names
+//							that compare the same with CompareStringsNoCase have the same
+//							hash value.
+//
+//	Parameters in:		Pointer to the pascal name string.
+//
+//	Parameters out:	None
+//
+// Value Returned:	Hash value for the name.
+//
+// Called By:			AddNameToProjectNameIndex
+//							FindClassNameInIndex
+//							FindFieldNameInIndex
+//
+//	Coded By:			agent						Date: 10/18/2026
+//	Revised By:			agent						Date: 10/18/2026
+
+UInt32 GetNameHashValue (
+				UCharPtr								namePtr)
+
+{
+	UInt32								hashValue,
+											index,
+											numberCharacters;
+
+
+			// Include the count byte so that names with different lengths will
+			// most likely be in different slots.
+
+	numberCharacters = (UInt32)namePtr[0] + 1;
+
+	hashValue = 2166136261u;
+	for (index=0; index<numberCharacters; index++)
+		{
+		hashValue ^= (UInt32)toupper (namePtr[index]);
+		hashValue *= 16777619;
+
+		}	// end "for (index=0; index<numberCharacters; index++)"
+
+	return (hashValue);
+
+}	// end "GetNameHashValue"
+
+
+
 //------------------------------------------------------------------------------------
 //                   Copyright 1988-2020 Purdue Research Foundation
 //
@@ -4408,6 +4752,45 @@ void HideStatControl (
 
 
 
+//------------------------------------------------------------------------------------
+//                   Copyright 1988-2020 Purdue Research Foundation
+//
+//	Function name:		void InvalidateProjectNameIndexes
+//
+//	Software purpose:	The purpose of this routine is to indicate that the hashed
+//							class and field name indexes need to be rebuilt the next
+//							time that they are used. It is called when names are changed
+//							or when classes or fields are cut or pasted.
+//
+//	Parameters in:		None
+//
+//	Parameters out:	None
+//
+// Value Returned:	None
+//
+// Called By:			CutClass in SEditStatistics.cpp
+//							CutField in SEditStatistics.cpp
+//							EditClassFieldDialog in SEditStatistics.cpp
+//							PasteClassFields in SEditStatistics.cpp
+//							PasteField in SEditStatistics.cpp
+//
+//	Coded By:			agent						Date: 10/18/2026
+//	Revised By:			agent						Date: 10/18/2026
+
+void InvalidateProjectNameIndexes (void)
+
+{
+	if (gProjectInfoPtr != NULL)
+		{
+		gProjectInfoPtr->nameIndexStorageClasses = -1;
+		gProjectInfoPtr->nameIndexStorageFields = -1;
+
+		}	// end "if (gProjectInfoPtr != NULL)"
+
+}	// end "InvalidateProjectNameIndexes"
+
+
+
 //------------------------------------------------------------------------------------
 //                   Copyright 1988-2020 Purdue Research Foundation
 //
@@ -6703,6 +7086,196 @@ void SetStatControlTitle (
 
 
 
+//------------------------------------------------------------------------------------
+//                   Copyright 1988-2020 Purdue Research Foundation
+//
+//	Function name:		Boolean SetUpClassNameIndex
+//
+//	Software purpose:	The purpose of this routine is to make sure that the hashed
+//							class name index is current. The index is rebuilt if the
+//							number of classes is different than when it was built. The
+//							index is made at least 4 times the number of classes so that
+//							classes can be added to it before it needs to be rebuilt.
+//
+//	Parameters in:		None
+//
+//	Parameters out:	None
+//
+// Value Returned:	TRUE if the index can be used.
+//							FALSE if memory for the index is not available.
+//
+// Called By:			FindClassNameInIndex
+//
+//	Coded By:			agent						Date: 10/18/2026
+//	Revised By:			agent						Date: 10/18/2026
+
+Boolean SetUpClassNameIndex (void)
+
+{
+	HPClassNamesPtr					classNamesPtr;
+
+	UInt32								index,
+											nameIndexSize;
+
+	SInt16								classStorage;
+
+	UInt16								classIndex;
+
+
+	if (gProjectInfoPtr->classNameIndexPtr != NULL &&
+			gProjectInfoPtr->nameIndexStorageClasses ==
+											gProjectInfoPtr->numberStorageClasses &&
+				gProjectInfoPtr->nameIndexStatisticsClasses ==
+											(SInt16)gProjectInfoPtr->numberStatisticsClasses)
+																							return (TRUE);
+
+	nameIndexSize = 64;
+	while (nameIndexSize < 4 * ((UInt32)gProjectInfoPtr->numberStorageClasses + 1))
+		nameIndexSize *= 2;
+
+	if (gProjectInfoPtr->classNameIndexPtr == NULL ||
+								gProjectInfoPtr->classNameIndexSize != nameIndexSize)
+		{
+		gProjectInfoPtr->classNameIndexPtr = (SInt16*)CheckAndDisposePtr (
+													(Ptr)gProjectInfoPtr->classNameIndexPtr);
+
+		gProjectInfoPtr->classNameIndexPtr =
+								(SInt16*)MNewPointer (nameIndexSize * sizeof (SInt16));
+		gProjectInfoPtr->classNameIndexSize = 0;
+
+		if (gProjectInfoPtr->classNameIndexPtr == NULL)
+																							return (FALSE);
+
+		gProjectInfoPtr->classNameIndexSize = nameIndexSize;
+
+		}	// end "if (gProjectInfoPtr->classNameIndexPtr == NULL || ..."
+
+	for (index=0; index<nameIndexSize; index++)
+		gProjectInfoPtr->classNameIndexPtr[index] = -1;
+
+	classNamesPtr = gProjectInfoPtr->classNamesPtr;
+	for (classIndex=0;
+			classIndex<gProjectInfoPtr->numberStatisticsClasses;
+				classIndex++)
+		{
+		classStorage = gProjectInfoPtr->storageClass[classIndex];
+
+		AddNameToProjectNameIndex (gProjectInfoPtr->classNameIndexPtr,
+											nameIndexSize,
+											(UCharPtr)classNamesPtr[classStorage].name,
+											classStorage);
+
+		}	// end "for (classIndex=0; ..."
+
+	gProjectInfoPtr->nameIndexStorageClasses = gProjectInfoPtr->numberStorageClasses;
+	gProjectInfoPtr->nameIndexStatisticsClasses =
+										(SInt16)gProjectInfoPtr->numberStatisticsClasses;
+
+	return (TRUE);
+
+}	// end "SetUpClassNameIndex"
+
+
+
+//------------------------------------------------------------------------------------
+//                   Copyright 1988-2020 Purdue Research Foundation
+//
+//	Function name:		Boolean SetUpFieldNameIndex
+//
+//	Software purpose:	The purpose of this routine is to make sure that the hashed
+//							field name index is current. The index is rebuilt if the
+//							number of fields is different than when it was built. Only
+//							the fields that belong to the project classes are included.
+//
+//	Parameters in:		None
+//
+//	Parameters out:	None
+//
+// Value Returned:	TRUE if the index can be used.
+//							FALSE if memory for the index is not available.
+//
+// Called By:			FindFieldNameInIndex
+//
+//	Coded By:			agent						Date: 10/18/2026
+//	Revised By:			agent						Date: 10/18/2026
+
+Boolean SetUpFieldNameIndex (void)
+
+{
+	HPClassNamesPtr					classNamesPtr;
+	HPFieldIdentifiersPtr			fieldIdentPtr;
+
+	UInt32								index,
+											nameIndexSize;
+
+	SInt16								classStorage,
+											field;
+
+	UInt16								classIndex;
+
+
+	if (gProjectInfoPtr->fieldNameIndexPtr != NULL &&
+			gProjectInfoPtr->nameIndexStorageFields ==
+											gProjectInfoPtr->numberStorageFields &&
+				gProjectInfoPtr->nameIndexStatisticsFields ==
+											gProjectInfoPtr->numberStatisticsFields)
+																							return (TRUE);
+
+	nameIndexSize = 64;
+	while (nameIndexSize < 4 * ((UInt32)gProjectInfoPtr->numberStorageFields + 1))
+		nameIndexSize *= 2;
+
+	if (gProjectInfoPtr->fieldNameIndexPtr == NULL ||
+								gProjectInfoPtr->fieldNameIndexSize != nameIndexSize)
+		{
+		gProjectInfoPtr->fieldNameIndexPtr = (SInt16*)CheckAndDisposePtr (
+													(Ptr)gProjectInfoPtr->fieldNameIndexPtr);
+
+		gProjectInfoPtr->fieldNameIndexPtr =
+								(SInt16*)MNewPointer (nameIndexSize * sizeof (SInt16));
+		gProjectInfoPtr->fieldNameIndexSize = 0;
+
+		if (gProjectInfoPtr->fieldNameIndexPtr == NULL)
+																							return (FALSE);
+
+		gProjectInfoPtr->fieldNameIndexSize = nameIndexSize;
+
+		}	// end "if (gProjectInfoPtr->fieldNameIndexPtr == NULL || ..."
+
+	for (index=0; index<nameIndexSize; index++)
+		gProjectInfoPtr->fieldNameIndexPtr[index] = -1;
+
+	classNamesPtr = gProjectInfoPtr->classNamesPtr;
+	fieldIdentPtr = gProjectInfoPtr->fieldIdentPtr;
+	for (classIndex=0;
+			classIndex<gProjectInfoPtr->numberStatisticsClasses;
+				classIndex++)
+		{
+		classStorage = gProjectInfoPtr->storageClass[classIndex];
+
+		field = classNamesPtr[classStorage].firstFieldNumber;
+		while (field > -1)
+			{
+			AddNameToProjectNameIndex (gProjectInfoPtr->fieldNameIndexPtr,
+												nameIndexSize,
+												(UCharPtr)fieldIdentPtr[field].name,
+												field);
+
+			field = fieldIdentPtr[field].nextField;
+
+			}	// end "while (field > -1)"
+
+		}	// end "for (classIndex=0; ..."
+
+	gProjectInfoPtr->nameIndexStorageFields = gProjectInfoPtr->numberStorageFields;
+	gProjectInfoPtr->nameIndexStatisticsFields = gProjectInfoPtr->numberStatisticsFields;
+
+	return (TRUE);
+
+}	// end "SetUpFieldNameIndex"
+
+
+
 //------------------------------------------------------------------------------------
 //                   Copyright 1988-2020 Purdue Research Foundation
 //
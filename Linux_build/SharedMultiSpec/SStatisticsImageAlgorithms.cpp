@@ -19,7 +19,7 @@
 //	Authors:					Chulhee Lee
 //								Larry L. Biehl
 //
-//	Revision date:			04/17/2020
+//	Revision date:			10/18/2026
 //
 //	Language:				C
 //
@@ -199,6 +199,12 @@ void 		FS_find_STI_size (
 				SInt32								numberFeatures,
 				UInt32*								STI_size);
 
+void		FS_get_mean_std_min_max (
+				CLASS_INFO_STR* 					class_info_ptr,
+				SInt32								numberFeatures,
+				double*								min_mean_std_height_ptr,
+				double*								max_mean_std_height_ptr);
+
 void		FS_gen_make_stat_image_same_scale (
 				CLASS_INFO_STR* 					class_info,
 				SInt16*								classPtr,
@@ -517,11 +523,9 @@ void FS_gen_make_stat_image_same_scale (
 	unsigned char						*cor, *final_cor, erdas_header[128];
 	
 	double								max_mean_std_height,
-											min_mean_std_height,
-			 								sd;
+											min_mean_std_height;
 	
-	UInt32 								i,
-											j;
+	UInt32 								i;
 											
 	UInt32								count,
 											final_cor_size,
@@ -541,19 +545,7 @@ void FS_gen_make_stat_image_same_scale (
 				
 		max_mean_std_height= -1e10;
 		min_mean_std_height= 1e10;
-		for (i=0; i<(UInt32)no_class; i++)
-			for (j=0; j<(UInt32)numberFeatures; j++)
-				{
-				sd = sqrt (fabs ((class_info+i)->fvar[j]));
-	  
-			 	if ((class_info+i)->fmean[j] +HOW_MANY_SD*sd > max_mean_std_height)
-			  		max_mean_std_height = (class_info+i)->fmean[j] +HOW_MANY_SD*sd;
-			   
-			 	if ((class_info+i)->fmean[j] -HOW_MANY_SD*sd < min_mean_std_height)
-			   	min_mean_std_height = (class_info+i)->fmean[j] -HOW_MANY_SD*sd;
-			   	
-			 	}	// end "for (j=0; j<n; j++)"
-
+				
 				// check user specified value	
 			
 		if (STI_info.mean_min_max_flag == 3)
@@ -562,6 +554,19 @@ void FS_gen_make_stat_image_same_scale (
 			min_mean_std_height = STI_info.meanmin_all;
 			
 			}	// end "if (STI_info.mean_min_max_flag == 3)"
+			
+		else if (STI_info.mean_min_max_flag != 2)
+			{
+					// The overall min and max is not needed when the min and max for
+					// each class/field are used.
+					
+			for (i=0; i<(UInt32)no_class; i++)
+				FS_get_mean_std_min_max (class_info+i,
+													numberFeatures,
+													&min_mean_std_height,
+													&max_mean_std_height);
+			
+			}	// end "else if (STI_info.mean_min_max_flag != 2)"
 		
 				// Initialize some parameters.
 				
@@ -581,8 +586,7 @@ void FS_gen_make_stat_image_same_scale (
    
 				// Initialize cor memory to be all index to white pixels.
 				
-		for (i=0; i<final_cor_size; i++)
-			cor[i] = G_white_char;
+		memset (cor, G_white_char, final_cor_size);
 
 				// Allocate memory for image
 				
@@ -593,14 +597,14 @@ void FS_gen_make_stat_image_same_scale (
       if (final_cor == NULL)
 			{
 			*ERROR_FLAG = 111;
+			CheckAndDisposePtr (cor);
 																										return;
 			
 			}	// end "if (final_cor == NULL)"
    
 				// Initialize final_cor memory to be all index to white pixels.
    
-		for (i=0; i<final_cor_size; i++)
-			final_cor[i] = G_white_char;
+		memset (final_cor, G_white_char, final_cor_size);
       
       FS_make_cor_mean_std (featurePtr,
 										numberFeatures,
@@ -617,8 +621,13 @@ void FS_gen_make_stat_image_same_scale (
 										areaCode);
 	 
 		if (*ERROR_FLAG != 0)
+			{
+			CheckAndDisposePtr (final_cor);
+			CheckAndDisposePtr (cor);
 																										return;
 			
+			}	// end "if (*ERROR_FLAG != 0)"
+			
 				// Make ERDAS Header
       
       newFileInfoPtr->numberLines = L_image_size_row;
@@ -781,6 +790,67 @@ void FS_gen_make_stat_image_same_scale (
 
 
 
+//------------------------------------------------------------------------------------
+//                   Copyright 1988-2020 Purdue Research Foundation
+//
+//	Function name:		void FS_get_mean_std_min_max
+//
+//	Software purpose:	Update the input min and max with the range of the mean
+//							+/- HOW_MANY_SD standard deviations over all features for the
+//							input class/field.
+//
+//	Parameters in:		Class/field information
+//							Number of features
+//
+//	Parameters out:	Minimum and maximum of mean +/- standard deviation
+//
+// Value Returned:	None	
+// 
+// Called By:			FS_gen_make_stat_image_same_scale
+//							FS_make_cor_mean_std
+//
+//	Coded By:			agent						Date: 10/18/2026
+//	Revised By:			agent						Date: 10/18/2026
+
+void FS_get_mean_std_min_max (
+				CLASS_INFO_STR* 					class_info_ptr,
+				SInt32								numberFeatures,
+				double*								min_mean_std_height_ptr,
+				double*								max_mean_std_height_ptr)
+				
+{
+	double								*fmean,
+											*fvar;
+											
+	double								max_mean_std_height,
+											min_mean_std_height,
+											sd;
+	
+	SInt32								j;
+	
+	
+	fmean = class_info_ptr->fmean;
+	fvar = class_info_ptr->fvar;
+	
+	max_mean_std_height = *max_mean_std_height_ptr;
+	min_mean_std_height = *min_mean_std_height_ptr;
+	
+	for (j=0; j<numberFeatures; j++)
+		{
+		sd = HOW_MANY_SD * sqrt (fabs (fvar[j]));
+		
+		max_mean_std_height = MAX (max_mean_std_height, fmean[j] + sd);
+		min_mean_std_height = MIN (min_mean_std_height, fmean[j] - sd);
+		
+		}	// end "for (j=0; j<numberFeatures; j++)"
+		
+	*max_mean_std_height_ptr = max_mean_std_height;
+	*min_mean_std_height_ptr = min_mean_std_height;
+	
+}	// end "FS_get_mean_std_min_max"
+
+
+
 //------------------------------------------------------------------------------------
 //                   Copyright 1988-2020 Purdue Research Foundation
 //
@@ -820,12 +890,14 @@ void FS_make_cor_mean_std (
 											grid_space,
 											longest_number,
 											low_bound,
-											sd,
 											upper_bound,
 											x,
 											y;
 									
 	double								*fmean;
+	
+	unsigned char						*class_cor,
+											*half_image;
 									
 	SInt32								a,
 											avail_mean_height,
@@ -886,12 +958,13 @@ void FS_make_cor_mean_std (
 		
 				// Put correlation in color code
 	
+      class_cor = cor + class_index * L_size_row * L_size_col;
+      half_image = (class_info+class_index)->half_image;
+		
       for (k=i=0; i<numberFeatures; i++)
 			{
          for (j=0; j<=i; j++,k++)
-            cor[L_size_col*i+j + class_index * L_size_row * L_size_col] = 
-							cor[L_size_col*j+i + class_index * L_size_row * L_size_col] 
-									= (class_info+class_index)->half_image[k];
+            class_cor[L_size_col*i+j] = class_cor[L_size_col*j+i] = half_image[k];
 							
 			}	// end "for (k=i=0; i<n; i++)"
 
@@ -933,21 +1006,10 @@ void FS_make_cor_mean_std (
 					
 			max_mean_std_height= -1e10;
 			min_mean_std_height= 1e10;
-			for (j=0; j<numberFeatures; j++)
-				{
-				sd = sqrt (fabs ((class_info+class_index)->fvar[j]));
-	  
-			 	if ((class_info+class_index)->fmean[j] + HOW_MANY_SD*sd >
-																					max_mean_std_height)
-			  		max_mean_std_height = (class_info+class_index)->fmean[j] +
-																							HOW_MANY_SD*sd;
-			   
-			 	if ((class_info+class_index)->fmean[j] - HOW_MANY_SD*sd <
-																					min_mean_std_height)
-			   	min_mean_std_height =
-										(class_info+class_index)->fmean[j] - HOW_MANY_SD*sd;
-			   	
-			 	}	// end "for (j=0; j<n; j++)"
+			FS_get_mean_std_min_max (class_info+class_index,
+												numberFeatures,
+												&min_mean_std_height,
+												&max_mean_std_height);
 					
 					// Allow a little extra space.
 				
@@ -1445,21 +1507,39 @@ void FS_make_half_STI (
 {
 	double 								x,
 											y;
+											
+	double*								sdPtr;
 	
 	SInt32 								i,
 											j,
 											k,
 											l;
-											
+	
+	
+			// Get the standard deviation for each band once instead of taking the
+			// square root for each element of the half matrix.
+			
+	sdPtr = (double*)MNewPointer (n * sizeof (double));
+	
+	if (sdPtr != NULL)
+		{
+		for (i=0; i<n; i++)
+			sdPtr[i] = sqrt (fabs (var[i]));
+			
+		}	// end "if (sdPtr != NULL)"
 											
 	for (l=0,i=0; i<n; i++)
 		{
 		for (j=0; j<=i; j++,l++)
 			{
 			x = cov[l];
-			y = var[i] * var[j];
-
-			y = sqrt (fabs (y));
+			
+			if (sdPtr != NULL)
+				y = sdPtr[i] * sdPtr[j];
+				
+			else	// sdPtr == NULL
+				y = sqrt (fabs (var[i] * var[j]));
+				
 			if (y <= 0)	// no variation in the band
 	   		k = G_black_char;
 			
@@ -1481,6 +1561,8 @@ void FS_make_half_STI (
 			}	// end "for (j=0; j<=i; j++,l++)"
 			
 		}	// end "for (l=0,i=0; i<n; i++)"
+		
+	CheckAndDisposePtr (sdPtr);
 	 
 }	// end "FS_make_half_STI"
 
@@ -18,7 +18,7 @@
 //
 //	Authors:					Larry L. Biehl, Ravi Budruk
 //
-//	Revision date:			04/16/2020
+//	Revision date:			10/18/2026
 //
 //	Language:				C
 //
@@ -105,6 +105,9 @@ Boolean 	GetNumberNonZeroLeadingDigits (
 				double								floorLogDataValue,
 				UInt16*								nonZeroIntevalDigitsPtr);
 
+void		SetUniqueResultsFileName (
+				CMFileStream*						resultsFileStreamPtr);
+
 
 //------------------------------------------------------------------------------------
 //                   Copyright 1988-2020 Purdue Research Foundation
@@ -1141,7 +1144,7 @@ Boolean CreateBackgroundImageFile (
 // Called By:			CreateResultsDiskFiles in SUtility.cpp
 //
 //	Coded By:			Larry L. Biehl			Date: 09/18/1989
-//	Revised By:			Larry L. Biehl			Date: 04/12/2020
+//	Revised By:			agent						Date: 10/18/2026
 
 Boolean CreateResultsDiskFile (
 				SInt32								numberLines, 
@@ -1238,6 +1241,16 @@ Boolean CreateResultsDiskFile (
 			filePathPointer =
 					(FileStringPtr)GetFilePathPPointerFromFileInfo (fileZeroInfoPtr);
 		
+		else if (!promptFlag && gImageFileInfoPtr != NULL)
+			{
+					// Files created without a prompt are named after the image
+					// being processed so that each image gets its own set.
+					
+			filePathPointer =
+					(FileStringPtr)GetFilePathPPointerFromFileInfo (gImageFileInfoPtr);
+			
+			}	// end "else if (!promptFlag && gImageFileInfoPtr != NULL)"
+		
 		else	// fileZeroInfoPtr == NULL
 			{
 					// Try using the file info from the project
@@ -1315,6 +1328,15 @@ Boolean CreateResultsDiskFile (
 		
 		}	// end "if (lOutputStorageType & kClusterMaskCode)"
 		
+	if (resultsFilePathPtr[0] == 0 && !promptFlag && gImageFileInfoPtr != NULL)
+		{
+		filePathPointer =
+					(FileStringPtr)GetFilePathPPointerFromFileInfo (gImageFileInfoPtr);
+		CopyFileStringToFileString (filePathPointer, resultsFilePathPtr, _MAX_PATH);
+		RemoveSuffix (resultsFilePathPtr);
+		
+		}	// end "if (resultsFilePathPtr[0] == 0 && !promptFlag && ..."
+		
 	if (resultsFilePathPtr[0] == 0)
 		{
 		if (gProjectInfoPtr != NULL)
@@ -1586,6 +1608,13 @@ Boolean CreateResultsDiskFile (
 			resultsFileStreamPtr->parentFSRef = fileStreamPtr->parentFSRef;
 		#endif	// defined multispec_mac
 		
+				// The echo files get here for every classification. The other files
+				// only get here for the batch target images which are named after
+				// the image file; do not let those replace existing files.
+				
+		if (!(lOutputStorageType & (kEchoFieldsCode+kEchoClassesCode)))
+			SetUniqueResultsFileName (resultsFileStreamPtr);
+		
 		#if defined multispec_wx
 			if (errCode == noErr)
 				{
@@ -1758,13 +1787,57 @@ Boolean CreateResultsDiskFile (
 //							HistogramStatsControl in SProjectHistogramStatistics.cpp
 //
 //	Coded By:			Larry L. Biehl			Date: 02/19/1991
-//	Revised By:			Larry L. Biehl			Date: 03/27/2017	
+//	Revised By:			agent						Date: 10/18/2026
 
 Boolean CreateResultsDiskFiles (
 				SInt16								lOutputStorageType, 
 				SInt16								numberClasses,
 				SInt16								numberProbabilityClasses)
 
+{
+	return (CreateResultsDiskFiles (lOutputStorageType,
+												numberClasses,
+												numberProbabilityClasses,
+												TRUE));
+																					
+}	// end "CreateResultsDiskFiles"
+
+
+
+//------------------------------------------------------------------------------------
+//                   Copyright 1988-2020 Purdue Research Foundation
+//
+//	Function name:		Boolean CreateResultsDiskFiles
+//
+//	Software purpose:	The purpose of this routine is to set up the disk
+//							file(s) to write the results to. The user is asked for the
+//							name of the classification and probability files when
+//							promptFlag is TRUE; otherwise they are named after the
+//							active image file and created in its directory.
+//
+//	Parameters in:		lOutputStorageType: Code indicating which type of files should 
+//								be set up.
+//							numberClasses: Number of classes
+//							numberProbabilityClasses: number of probability classes
+//							promptFlag: TRUE if the user is to be asked for file names
+//
+//	Parameters out:				
+//
+// Value Returned:	True: if result disk files were setup and opened okay.
+//							False: if the result disk files could not be set up.
+//
+// Called By:			CreateResultsDiskFiles in SUtilities.cpp
+//							ClassifyBatchTargetImages in SClassify.cpp
+//
+//	Coded By:			Larry L. Biehl			Date: 02/19/1991
+//	Revised By:			agent						Date: 10/18/2026
+
+Boolean CreateResultsDiskFiles (
+				SInt16								lOutputStorageType, 
+				SInt16								numberClasses,
+				SInt16								numberProbabilityClasses,
+				Boolean								promptFlag)
+
 {
 	DiskFileListPtr					diskFileListPtr;
 	
@@ -1940,10 +2013,10 @@ Boolean CreateResultsDiskFiles (
 															numberClasses,
 															classifyColors,
 															diskFileListPtr,
-															TRUE,
-															0,
-															0,
-															FALSE);
+															promptFlag,
+															echoVRefNum,
+															parID,
+															fSSpecFlag);
 			
 		gAreaDescription.diskFileFormat = savedDiskFileFormat;
 					
@@ -1984,10 +2057,10 @@ Boolean CreateResultsDiskFiles (
 															numberProbabilityClasses,
 															probabilityColors,
 															diskFileListPtr,
-															TRUE,
-															0,
-															0,
-															FALSE);
+															promptFlag,
+															echoVRefNum,
+															parID,
+															fSSpecFlag);
 		
 		if (diskFileListPtr->fileInfoH != NULL)
 			{
@@ -7795,6 +7868,106 @@ void SetMapToWindowUnitsVariables (
 
 
 
+//------------------------------------------------------------------------------------
+//                   Copyright 1988-2020 Purdue Research Foundation
+//
+//	Function name:		void SetUniqueResultsFileName
+//
+//	Software purpose:	The purpose of this routine is to make sure that the name in
+//							the input results file stream is not that of an existing
+//							file. If it is, _2, _3, etc. is inserted in front of the
+//							suffix until a name is found that is not being used.
+//
+//	Parameters in:		Pointer to the results file stream
+//
+//	Parameters out:	None
+//
+// Value Returned:	None
+// 
+// Called By:			CreateResultsDiskFile in SUtilities.cpp
+//
+//	Coded By:			agent						Date: 10/18/2026
+//	Revised By:			agent						Date: 10/18/2026
+
+void SetUniqueResultsFileName (
+				CMFileStream*						resultsFileStreamPtr)
+
+{
+	CMFileStream						checkFileStream;
+	
+	UInt8									suffixString[64],
+											versionSuffixString[80];
+	
+	FileStringPtr						resultsFilePathPtr;
+	
+	SInt16								errCode;
+	
+	UInt16								baseLength,
+											index,
+											suffixLength,
+											version;
+	
+	
+	resultsFilePathPtr =
+				(FileStringPtr)GetFilePathPPointerFromFileStream (resultsFileStreamPtr);
+	suffixLength = 0;
+	baseLength = GetFileStringLength (resultsFilePathPtr);
+	
+			// Find the start of the suffix in the file name. Note that the first
+			// 2 bytes of the string are used for the string length.
+	
+	for (index=baseLength+1; index>1; index--)
+		{
+		if (resultsFilePathPtr[index] == '/' || resultsFilePathPtr[index] == '\\')
+			break;
+		
+		if (resultsFilePathPtr[index] == '.')
+			{
+			suffixLength = baseLength - index + 2;
+			baseLength = index - 2;
+			break;
+			
+			}	// end "if (resultsFilePathPtr[index] == '.')"
+		
+		}	// end "for (index=baseLength+1; index>1; index--)"
+	
+	suffixLength = MIN (suffixLength, 60);
+	suffixString[0] = 0;
+	memcpy (&suffixString[1], &resultsFilePathPtr[baseLength+2], suffixLength);
+	suffixString[suffixLength+1] = 0;
+	
+	for (version=2; version<1000; version++)
+		{
+		InitializeFileStream (&checkFileStream, resultsFileStreamPtr);
+		errCode = OpenFileReadOnly (&checkFileStream,
+												kResolveAliasChains,
+												kLockFile,
+												kVerifyFileStream);
+		CloseFile (&checkFileStream);
+		
+		if (errCode != noErr)
+			break;
+		
+				// The file exists. Try the next version of the name.
+		
+		versionSuffixString[0] = 0;
+		sprintf ((char*)&versionSuffixString[1],
+					"_%hu%s",
+					version,
+					(char*)&suffixString[1]);
+		
+		SetFileStringLength (resultsFilePathPtr, baseLength);
+		ConcatFilenameSuffix (resultsFilePathPtr, versionSuffixString);
+		
+		SetFileDoesNotExist (resultsFileStreamPtr, kKeepUTF8CharName);
+		UpdateFileNameInformation (resultsFileStreamPtr, NULL);
+		
+		}	// end "for (version=2; version<1000; version++)"
+	
+}	// end "SetUniqueResultsFileName"
+
+
+
 //------------------------------------------------------------------------------------
 //                   Copyright 1988-2020 Purdue Research Foundation
 //
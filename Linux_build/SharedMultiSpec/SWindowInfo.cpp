@@ -190,7 +190,7 @@ Boolean CheckIfEntireImage (
 // Called By:			ModalFileSpecification in SFileIO.cpp
 //
 //	Coded By:			Larry L. Biehl			Date: 12/24/1991
-//	Revised By:			Larry L. Biehl			Date: 11/02/1999	
+//	Revised By:			agent						Date: 10/18/2026
 
 void DisposeOfImageWindowSupportMemory (
 				WindowInfoPtr						windowInfoPtr)
@@ -223,6 +223,10 @@ void DisposeOfImageWindowSupportMemory (
 				// Dispose of off screen bit/pix map and storage for offscreen image.											
 		
 		ReleaseOffscreenSupportMemory (windowInfoPtr);
+		
+				// Dispose of the field outlines cached for the window.
+				
+		ReleaseFieldOutlineCacheMemory (windowInfoPtr);
 			
 		}	// end "if (windowInfoPtr)" 
 			
@@ -3094,7 +3098,7 @@ Boolean ImageWindowIsAvailable (
 //							GetWindowInfoStructures in MWindow.c
 //
 //	Coded By:			Larry L. Biehl			Date: 03/07/1991
-//	Revised By:			Larry L. Biehl			Date: 01/10/2020
+//	Revised By:			agent						Date: 10/18/2026
 
 Handle InitializeWindowInfoStructure (
 				Handle								windowInfoHandle,
@@ -3186,6 +3190,7 @@ Handle InitializeWindowInfoStructure (
 		
 		windowInfoPtr->graphViewCPtr = NULL;
 		windowInfoPtr->supportFileStreamPtr = NULL;
+		windowInfoPtr->fieldOutlineCachePtr = NULL;
 		windowInfoPtr->maskFileStreamPtr = NULL;
 		//windowInfoPtr->descriptionH = NULL;
 		windowInfoPtr->displayLevelHandle = NULL;
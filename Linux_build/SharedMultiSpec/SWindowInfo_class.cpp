@@ -129,7 +129,7 @@ CMWindowInfo::CMWindowInfo (
 // Called By:	
 //
 //	Coded By:			Larry L. Biehl			Date: 06/05/1995
-//	Revised By:			Larry L. Biehl			Date: 02/26/1997	
+//	Revised By:			agent						Date: 10/18/2026
 
 CMWindowInfo::~CMWindowInfo ()
 
@@ -165,6 +165,8 @@ CMWindowInfo::~CMWindowInfo ()
 	   		
 		ReleaseOffscreenSupportMemory ();
 		
+		ReleaseFieldOutlineCacheMemory (windowInfoPtr);
+		
 		}	// end "if (windowInfoPtr != NULL)"
 		
 	m_windowInfoHandle = UnlockAndDispose (m_windowInfoHandle);
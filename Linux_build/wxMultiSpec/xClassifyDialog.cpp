@@ -19,7 +19,7 @@
 //
 //	Authors:					Larry L. Biehl
 //
-//	Revision date:			05/28/2020
+//	Revision date:			10/18/2026
 //
 //	Language:				C++
 //
@@ -122,6 +122,8 @@ CMClassifyDialog::CMClassifyDialog (
 	m_trainingAreaFlag = FALSE;
 	m_imageAreaFlag = FALSE;
 	m_thresholdResultsFlag = FALSE;
+	m_batchTargetsFlag = FALSE;
+	m_float32ComputeFlag = FALSE;
 	m_classWeightsSelection = -1;
 	m_thresholdPercent = (float)0.;
 	m_knnThreshold = 1;
@@ -720,6 +722,22 @@ void CMClassifyDialog::CreateControls ()
 
 	bSizer124->Add (bSizer126, 0, wxALL, 5);
 
+	m_checkBox17 = new wxCheckBox (this,
+												IDC_BatchTargets,
+												wxT("Also classify other compatible images"),
+												wxDefaultPosition,
+												wxDefaultSize,
+												0);
+	bSizer124->Add (m_checkBox17, 0, wxLEFT, 20);
+
+	m_checkBox18 = new wxCheckBox (this,
+												IDC_Float32Compute,
+												wxT("Use single precision for maximum likelihood"),
+												wxDefaultPosition,
+												wxDefaultSize,
+												0);
+	bSizer124->Add (m_checkBox18, 0, wxLEFT|wxTOP, 20);
+
 	bSizer127 = new wxBoxSizer (wxHORIZONTAL);
 
 	m_staticText182 = new wxStaticText (this,
@@ -943,7 +961,7 @@ void CMClassifyDialog::CreateControls ()
 //	Called By:			
 //
 //	Coded By:			Larry L. Biehl			Date: 02/27/1996
-//	Revised By:			Larry L. Biehl			Date: 05/04/2019
+//	Revised By:			agent						Date: 10/18/2026
 
 SInt16 CMClassifyDialog::DoDialog (void)
 
@@ -1012,7 +1030,9 @@ SInt16 CMClassifyDialog::DoDialog (void)
 								m_listResultsTestCode,
 								m_listResultsTrainingCode,
 								m_parallelPipedCode,
-								m_nearestNeighborKValue);
+								m_nearestNeighborKValue,
+								m_batchTargetsFlag,
+								m_float32ComputeFlag);
 
 		}	// end "if (returnCode == IDOK)"
     
@@ -1361,6 +1381,8 @@ void CMClassifyDialog::OnClassificationProcedureSelendok (
 													 m_thresholdResultsFlag,
 													 m_thresholdAllowedFlag);
 
+		ClassifyDialogSetFloat32ComputeItem (this, m_classificationProcedure);
+
 		if (weightsSelection > 0)
 			{
 			HideDialogItem (this, IDC_WeightsEqual);
@@ -1724,6 +1746,10 @@ void CMClassifyDialog::OnInitDialog (
 	if (!m_diskFileFlag)
 		MHideDialogItem (this, IDC_DiskCombo);
 
+	m_batchTargetsFlag = gClassifySpecsPtr->batchTargetsFlag;
+	m_float32ComputeFlag = gClassifySpecsPtr->float32ComputeFlag;
+	ClassifyDialogSetFloat32ComputeItem (this, m_classificationProcedure);
+
 	m_selectImageOverlaySelection = selectImageOverlaySelection - 1;
 
 			// Palette to use.             
@@ -2060,6 +2086,12 @@ bool CMClassifyDialog::TransferDataFromWindow ()
 	
 	wxCheckBox* imagewindowcb = (wxCheckBox*)FindWindow (IDC_ImageWindowOverlay);
 	m_createImageOverlayFlag = imagewindowcb->GetValue ();
+	
+	wxCheckBox* batchtargetscb = (wxCheckBox*)FindWindow (IDC_BatchTargets);
+	m_batchTargetsFlag = batchtargetscb->GetValue ();
+	
+	wxCheckBox* float32cb = (wxCheckBox*)FindWindow (IDC_Float32Compute);
+	m_float32ComputeFlag = float32cb->GetValue ();
 
 	m_classSelection = m_classesCtrl->GetSelection ();
 	m_classWeightsSelection = m_weightsCtrl->GetSelection ();
@@ -2168,6 +2200,12 @@ bool CMClassifyDialog::TransferDataToWindow ()
 	
 	wxCheckBox* imagewindowcb = (wxCheckBox*)FindWindow (IDC_ImageWindowOverlay);
 	imagewindowcb->SetValue (m_createImageOverlayFlag);
+	
+	wxCheckBox* batchtargetscb = (wxCheckBox*)FindWindow (IDC_BatchTargets);
+	batchtargetscb->SetValue (m_batchTargetsFlag);
+	
+	wxCheckBox* float32cb = (wxCheckBox*)FindWindow (IDC_Float32Compute);
+	float32cb->SetValue (m_float32ComputeFlag);
 
 	m_classesCtrl->SetSelection (m_classSelection);
 	if (m_classWeightsSelection >= 0)
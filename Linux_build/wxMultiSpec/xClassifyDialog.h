@@ -222,7 +222,9 @@ class CMClassifyDialog : public CMDialog
 												*m_checkBox13,
 												*m_checkBox14,
 												*m_checkBox15,
-												*m_checkBox16;
+												*m_checkBox16,
+												*m_checkBox17,
+												*m_checkBox18;
 	
 		wxChoice								*m_fileFormatCtrl,
 												*m_overlayCtrl,
@@ -303,9 +305,11 @@ class CMClassifyDialog : public CMDialog
 	
 		UInt16								m_classifyProcedureEnteredCode;
 
-		Boolean								m_createImageOverlayFlag,
+		Boolean								m_batchTargetsFlag,
+												m_createImageOverlayFlag,
 												m_createProbabilityFileFlag,
 												m_diskFileFlag,
+												m_float32ComputeFlag,
 												m_imageAreaFlag,
 												m_initializedFlag,
 												m_optionKeyFlag,
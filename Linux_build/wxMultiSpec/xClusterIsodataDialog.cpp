@@ -19,7 +19,7 @@
 //
 //	Authors:					Abdur Rahman Maud, Larry L. Biehl
 //
-//	Revision date:			06/17/2020
+//	Revision date:			10/18/2026
 //
 //	Language:				C++
 //
@@ -64,6 +64,7 @@ BEGIN_EVENT_TABLE (CMISODATAClusterDialog, CMDialog)
 	EVT_RADIOBUTTON (IDC_1stCovEigenvector, CMISODATAClusterDialog::On1stCovEigenvector)
 	EVT_RADIOBUTTON (IDC_EigenvectorVolume, CMISODATAClusterDialog::OnEigenvectorVolume)
 	EVT_RADIOBUTTON (IDC_OnePassCluster, CMISODATAClusterDialog::OnOnePassCluster)
+	EVT_RADIOBUTTON (IDC_SampleSeededCenters, CMISODATAClusterDialog::OnSampleSeededCenters)
 
 	EVT_TEXT (IDC_ColumnEnd, CMISODATAClusterDialog::CheckColumnEnd)
 	EVT_TEXT (IDC_ColumnStart, CMISODATAClusterDialog::CheckColumnStart)
@@ -256,6 +257,14 @@ void CMISODATAClusterDialog::CreateControls ()
 														0);
    SetUpToolTip (m_OnePassRadioBtn, IDS_ToolTip99);
    sbSizer3->Add (m_OnePassRadioBtn, wxSizerFlags(0).Border(wxALL, 5));
+
+   m_SampleSeedsRadioBtn = new wxRadioButton (sbSizer3->GetStaticBox (),
+																IDC_SampleSeededCenters,
+																wxT("Spread from pixel sample"),
+																wxDefaultPosition,
+																wxDefaultSize,
+																0);
+   sbSizer3->Add (m_SampleSeedsRadioBtn, wxSizerFlags(0).Border(wxALL, 5));
 	
    m_checkBox2 = new wxCheckBox (sbSizer3->GetStaticBox (),
                                  IDC_ProjectClassMeans,
@@ -600,9 +609,12 @@ int CMISODATAClusterDialog::GetRadioSelection ()
    else if (m_EigenVolumeRadioBtn->GetValue ())
       retval = 1;
 	
-   else
+   else if (m_OnePassRadioBtn->GetValue ())
       retval = 2;
 	
+   else
+      retval = 3;
+	
    return retval;
       
 }	// end "GetRadioSelection"
@@ -731,10 +743,10 @@ void CMISODATAClusterDialog::OnInitDialog (
 			// Set default text selection to first edit text item
 	
    UInt16 defaultTextIndex;
-   if (gClusterSpecsPtr->initializationOption != 4)
+   if (gClusterSpecsPtr->initializationOption != 3)
       defaultTextIndex = IDC_NumberClusters;
 
-   else	// gClusterSpecsPtr->initializationOption == 4
+   else	// gClusterSpecsPtr->initializationOption == 3
       defaultTextIndex = IDC_Convergence;
 
    SelectDialogItemText (this, defaultTextIndex, 0, SInt16_MAX);
@@ -764,6 +776,16 @@ void CMISODATAClusterDialog::OnProjectClassMeans (
 
 
 
+void CMISODATAClusterDialog::OnSampleSeededCenters (
+				wxCommandEvent&					event)
+
+{
+   UpdateOptionSettings ();
+
+}	// end "OnSampleSeededCenters"
+
+
+
 void CMISODATAClusterDialog::OnClassComboSelendok (
 				wxCommandEvent&					event)
 
@@ -789,9 +811,12 @@ void CMISODATAClusterDialog::SetRadioSelection (
 	else if (setval == 1)
    	m_EigenVolumeRadioBtn->SetValue (1);
 	
-	else
+	else if (setval == 2)
    	m_OnePassRadioBtn->SetValue (1);
 	
+	else
+   	m_SampleSeedsRadioBtn->SetValue (1);
+	
 }	// end "SetRadioSelection"
 
 
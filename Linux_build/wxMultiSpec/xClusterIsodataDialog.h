@@ -26,7 +26,7 @@
 //	Brief description:	Header file for the CMClassifyDialog class
 //
 //	Written By:				Abdur Rahman Maud		Date: ??/??/2009
-//	Revised By:				Larry L. Biehl			Date: 02/25/2020
+//	Revised By:				agent						Date: 10/18/2026
 //	
 //------------------------------------------------------------------------------------
 
@@ -82,6 +82,9 @@ class CMISODATAClusterDialog : public CMDialog
 		void	OnProjectClassMeans (
 				wxCommandEvent&					event);
 
+		void	OnSampleSeededCenters (
+				wxCommandEvent&					event);
+
 		void	On1stCovEigenvector (
 				wxCommandEvent&					event);
 		DECLARE_EVENT_TABLE ()
@@ -118,6 +121,7 @@ class CMISODATAClusterDialog : public CMDialog
 		wxRadioButton						*m_1stCovEigenRadioBtn,
 												*m_EigenVolumeRadioBtn,
 												*m_OnePassRadioBtn,
+												*m_SampleSeedsRadioBtn,
 												*m_radioBtn8,
 												*m_radioBtn9;
 
@@ -1518,6 +1518,7 @@
 #define IDS_Cluster51                   1751
 #define IDC_OrientationAngle            1752
 #define IDS_Cluster52                   1752
+#define IDS_Cluster53                   1753
 #define IDC_CoordinateUnits             1753
 #define IDC_Preview                     1754
 #define IDC_StartLCCheckBox             1755
@@ -1664,6 +1665,9 @@
 #define IDC_DATA_LIST       				1918
 
 #define IDC_ChannelsSubset					1921
+#define IDC_SampleSeededCenters         1923
+#define IDC_BatchTargets                1924
+#define IDC_Float32Compute              1925
         
 #define IDS_ListData1                   2001
 #define IDS_ListData2                   2002
@@ -2011,6 +2015,11 @@
 #define IDS_FileIO201                   2701
 #define IDS_FileIO202                   2702
 #define IDS_FileIO203                   2703
+#define IDS_FileIO204                   2704
+#define IDS_FileIO205                   2705
+#define IDS_FileIO206                   2706
+#define IDS_FileIO207                   2707
+#define IDS_FileIO208                   2708
 #define IDS_InstrumentName01            3001
 #define IDS_InstrumentName02            3002
 #define IDS_InstrumentName03            3003
@@ -2282,6 +2291,7 @@
 #define IDS_FileType42                  6742
 #define IDS_FileType43                  6743
 #define IDS_FileType44                  6744
+#define IDS_FileType46                  6746
 #define IDS_Compression01               6801
 #define IDS_Compression02               6802
 #define IDS_Compression03               6803
@@ -18,7 +18,7 @@
 //
 //	Authors:					Larry L. Biehl
 //
-//	Revision date:			09/27/2019
+//	Revision date:			10/18/2026
 //
 //	Language:				C++
 //
@@ -93,6 +93,8 @@ CMClassifyDialog::CMClassifyDialog (
 	m_trainingAreaFlag = FALSE;
 	m_imageAreaFlag = FALSE;
 	m_thresholdResultsFlag = FALSE;
+	m_batchTargetsFlag = FALSE;
+	m_float32ComputeFlag = FALSE;
 	m_classWeightsSelection = -1;
 	m_thresholdPercent = (float)0.;
 	m_diskFileFlag = FALSE;
@@ -340,6 +342,8 @@ void CMClassifyDialog::DoDataExchange (
 	DDX_Check (pDX, IDC_ThresholdResults, m_thresholdResultsFlag); 
 	DDX_Check (pDX, IDC_ImageWindowOverlay, m_createImageOverlayFlag);
 	DDX_CBIndex (pDX, IDC_ImageOverlayCombo, m_selectImageOverlaySelection);
+	DDX_Check (pDX, IDC_BatchTargets, m_batchTargetsFlag);
+	DDX_Check (pDX, IDC_Float32Compute, m_float32ComputeFlag);
 	//}}AFX_DATA_MAP 
 	     
 	if (!pDX->m_bSaveAndValidate)
@@ -436,7 +440,7 @@ void CMClassifyDialog::DoDataExchange (
 //	Called By:			
 //
 //	Coded By:			Larry L. Biehl			Date: 02/27/1996
-//	Revised By:			Larry L. Biehl			Date: 05/26/2017	
+//	Revised By:			agent						Date: 10/18/2026	
 
 SInt16 CMClassifyDialog::DoDialog (void)
 
@@ -505,7 +509,9 @@ SInt16 CMClassifyDialog::DoDialog (void)
 								m_listResultsTestCode,
 								m_listResultsTrainingCode,
 								m_parallelPipedCode,
-								m_nearestNeighborKValue);
+								m_nearestNeighborKValue,
+								m_batchTargetsFlag,
+								m_float32ComputeFlag);
 					                                 
 		}	// end "if (returnCode == IDOK)"
 	
@@ -972,6 +978,10 @@ BOOL CMClassifyDialog::OnInitDialog (void)
 		
 	if (!m_diskFileFlag)
 		MHideDialogItem (this, IDC_DiskCombo);
+		
+	m_batchTargetsFlag = gClassifySpecsPtr->batchTargetsFlag;
+	m_float32ComputeFlag = gClassifySpecsPtr->float32ComputeFlag;
+	ClassifyDialogSetFloat32ComputeItem (this, m_classificationProcedure);
 
 	m_selectImageOverlaySelection = selectImageOverlaySelection - 1;
 	
@@ -1121,6 +1131,8 @@ void CMClassifyDialog::OnSelendokClassificationProcedure ()
 													m_thresholdResultsFlag,
 													m_thresholdAllowedFlag);
 
+		ClassifyDialogSetFloat32ComputeItem (this, m_classificationProcedure);
+
 		if (weightsSelection > 0)
 			{
 			HideDialogItem (this, IDC_WeightsEqual);
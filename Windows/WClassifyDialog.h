@@ -67,9 +67,11 @@ class CMClassifyDialog : public CMDialog
 
 		UInt16								m_classifyProcedureEnteredCode;
 	
-		BOOL									m_createImageOverlayFlag,
+		BOOL									m_batchTargetsFlag,
+												m_createImageOverlayFlag,
 												m_createProbabilityFileFlag,
 												m_diskFileFlag,
+												m_float32ComputeFlag,
 												m_imageAreaFlag,
 												m_testAreaFlag,
 												m_thresholdResultsFlag,
@@ -18,7 +18,7 @@
 //
 //	Authors:					Larry L. Biehl
 //
-//	Revision date:			02/29/2020
+//	Revision date:			10/18/2026
 //
 //	Language:				C++
 //
@@ -47,6 +47,7 @@ BEGIN_MESSAGE_MAP (CMISODATAClusterDialog, CDialog)
 	ON_BN_CLICKED (IDC_EigenvectorVolume, OnEigenvectorVolume)
 	ON_BN_CLICKED (IDC_OnePassCluster, OnOnePassCluster)
 	ON_BN_CLICKED (IDC_ProjectClassMeans, OnProjectClassMeans)
+	ON_BN_CLICKED (IDC_SampleSeededCenters, OnSampleSeededCenters)
 	ON_BN_CLICKED (IDC_1stCovEigenvector, On1stCovEigenvector)
 	ON_BN_CLICKED (IDEntireImage, ToEntireImage)
 	ON_BN_CLICKED (IDSelectedImage, ToSelectedImage)
@@ -400,10 +401,10 @@ BOOL CMISODATAClusterDialog::OnInitDialog ()
 			// Set default text selection to first edit text item
 	
 	UInt16  defaultTextIndex;
-	if (gClusterSpecsPtr->initializationOption != 4)
+	if (gClusterSpecsPtr->initializationOption != 3)
 		defaultTextIndex = IDC_NumberClusters;
 	
-	else	// gClusterSpecsPtr->initializationOption == 4
+	else	// gClusterSpecsPtr->initializationOption == 3
 		defaultTextIndex = IDC_Convergence;
 	
 	SelectDialogItemText (this, defaultTextIndex, 0, SInt16_MAX);
@@ -432,6 +433,15 @@ void CMISODATAClusterDialog::OnProjectClassMeans ()
 
 
 
+void CMISODATAClusterDialog::OnSampleSeededCenters ()
+
+{                                                          
+	UpdateOptionSettings ();
+	
+}	// end "OnSampleSeededCenters"
+
+
+
 void CMISODATAClusterDialog::OnSelendokClassCombo (void)
 
 {
@@ -26,7 +26,7 @@
 //	Brief description:	Header file for the CMISODATAClusterDialog class
 //
 //	Written By:				Larry L. Biehl			Date: ??/??/2019
-//	Revised By:				Larry L. Biehl			Date: 12/05/2019
+//	Revised By:				agent						Date: 10/18/2026
 //
 //------------------------------------------------------------------------------------
 
@@ -82,6 +82,8 @@ class CMISODATAClusterDialog : public CMDialog
 	
 		afx_msg void OnProjectClassMeans ();
 	
+		afx_msg void OnSampleSeededCenters ();
+	
 		afx_msg void OnSelendokClassCombo ();
 	
 		afx_msg void On1stCovEigenvector ();
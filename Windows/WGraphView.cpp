@@ -119,8 +119,13 @@ CMGraphView::CMGraphView ()
 			selectionIOPtr->channelStatsHandle = NULL;
 			selectionIOPtr->sumSquaresHandle = NULL;
 			selectionIOPtr->ioBufferHandle = NULL;
+			selectionIOPtr->profileCacheHandle = NULL;
+			selectionIOPtr->profileCacheWindow = NULL;
 			selectionIOPtr->bufferSize = 0;
 			selectionIOPtr->outputBufferOffset = 0;
+			selectionIOPtr->profileCacheNextSlot = 0;
+			for (int index=0; index<kProfileCacheNumberBlocks; index++)
+				selectionIOPtr->profileCacheLine[index] = -1;
 			selectionIOPtr->checkIOMemoryFlag = TRUE;
 			selectionIOPtr->memoryWarningFlag = FALSE;
 							
@@ -300,6 +305,7 @@ CMGraphView::~CMGraphView ()
 		UnlockAndDispose (selectionIOPtr->channelStatsHandle); 
 		UnlockAndDispose (selectionIOPtr->sumSquaresHandle);
 		UnlockAndDispose (selectionIOPtr->ioBufferHandle); 
+		UnlockAndDispose (selectionIOPtr->profileCacheHandle);
 		
 		s_selectionIOInfoHandle = UnlockAndDispose (s_selectionIOInfoHandle);
 		
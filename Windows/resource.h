@@ -1502,6 +1502,7 @@
 #define IDS_Cluster51                   1751
 #define IDC_OrientationAngle            1752
 #define IDS_Cluster52                   1752
+#define IDS_Cluster53                   1753
 #define IDC_CoordinateUnits             1753
 #define IDC_Preview                     1754
 #define IDC_StartLCCheckBox             1755
@@ -1701,6 +1702,9 @@
 #define IDC_SVM_P_INFO                  1919
 #define IDC_SVM_PROBABILITY             1920
 #define IDC_SVM_PROBABILITY_INFO        1921
+#define IDC_SampleSeededCenters         1923
+#define IDC_BatchTargets                1924
+#define IDC_Float32Compute              1925
 #define IDS_ListData1                   2001
 #define IDS_ListData2                   2002
 #define IDS_ListData3                   2003
@@ -2045,6 +2049,11 @@
 #define IDS_FileIO201                   2701
 #define IDS_FileIO202                   2702
 #define IDS_FileIO203                   2703
+#define IDS_FileIO204                   2704
+#define IDS_FileIO205                   2705
+#define IDS_FileIO206                   2706
+#define IDS_FileIO207                   2707
+#define IDS_FileIO208                   2708
 #define IDS_InstrumentName01            3001
 #define IDS_InstrumentName02            3002
 #define IDS_InstrumentName03            3003
@@ -2237,6 +2246,7 @@
 #define IDS_FileType44                  5744
 #define IDS_STRING5745                  5745
 #define IDS_FileType45                  5745
+#define IDS_FileType46                  5746
 #define IDS_Compression01               5801
 #define IDS_Compression02               5802
 #define IDS_Compression03               5803
@@ -2412,7 +2422,7 @@
 #ifndef APSTUDIO_READONLY_SYMBOLS
 #define _APS_NEXT_RESOURCE_VALUE        271
 #define _APS_NEXT_COMMAND_VALUE         32931
-#define _APS_NEXT_CONTROL_VALUE         1923
+#define _APS_NEXT_CONTROL_VALUE         1926
 #define _APS_NEXT_SYMED_VALUE           111
 #endif
 #endif